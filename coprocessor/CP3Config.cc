@@ -72,6 +72,10 @@ CP3Config::CP3Config(const std::string& presetOptions) // add new options here!
     opt_randInp       (_cat, "randInp",         "Randomize Inprocessing", true,                                                                    optionListPtr, &opt_inprocess),
     opt_inc_inp       (_cat, "inc-inp",         "increase technique limits per inprocess step", false,                                             optionListPtr, &opt_inprocess),
     opt_remL_inp      (_cat, "inp-remL",        "remove all learned clauses for first inprocessing", false,                                        optionListPtr, &opt_inprocess),
+    opt_isched        (_cat, "cp3_isched",      "choose inprocessing techniques by their payoff (removed clauses per second), instead of cp3_itechs", false, optionListPtr, &opt_inprocess),
+    opt_isched_techs  (_cat, "cp3_isched_techs","techniques to choose from, in execution order (V = vivification of the search)", "Vsepv",   optionListPtr, &opt_isched),
+    opt_isched_share  (_cat, "cp3_isched_share","fraction of the search time that is given to inprocessing", 0.1, DoubleRange(0, false, 1, true), optionListPtr, &opt_isched),
+    opt_isched_decay  (_cat, "cp3_isched_decay","weight of previous rounds in the payoff of a technique", 0.5, DoubleRange(0, true, 1, false),   optionListPtr, &opt_isched),
 
     opt_whiteList     (_cat2, "whiteList",      "variables whose set of solution is not touched", 0,                                               optionListPtr, &opt_enabled),
 
@@ -105,6 +109,7 @@ CP3Config::CP3Config(const std::string& presetOptions) // add new options here!
     opt_hbr            (_cat2, "hbr",           "Use hyper binary resolution", false,                                             optionListPtr, &opt_enabled),
 
     stepbystepoutput   (_cat2, "debugCNFbase",  "CNF filename prefix for step by step formulas", 0,                            optionListPtr, &opt_enabled),
+    opt_profile        (_cat2, "cp3_profile",   "write time, steps and memory per technique call to this file (JSON for *.json, CSV otherwise) #NoAutoT", 0, optionListPtr, &opt_enabled),
 
     opt_ptechs         (_cat2, "cp3_ptechs",    "techniques for preprocessing", 0,                                             optionListPtr, &opt_enabled),
     opt_itechs         (_cat2, "cp3_itechs",    "techniques for inprocessing",  0,                                             optionListPtr, &opt_inprocess),
@@ -479,6 +484,7 @@ CP3Config::CP3Config(const std::string& presetOptions) // add new options here!
     pr_opt_inpStepInc2(_cat_pr, "cp3_viv_inpInc", "increase for steps per inprocess call", 1000000, IntRange(0, INT32_MAX),                                         optionListPtr, &pr_vivi),
     pr_keepLHBRs      (_cat_pr, "pr-keepLHBR",    "keep clauses that have been created during LHBR during probing/vivification (0=no,1=learnt)", 0, IntRange(0, 1), optionListPtr, &opt_probe),
     pr_necBinaries    (_cat_pr, "pr-nce",         "generate L2 necessary assignments as binary clauses", true,                                                      optionListPtr, &opt_probe),
+    pr_parallel       (_cat_pr, "pr-par",         "probe and vivify with the threads of cp3_threads (no LHBR, double look-ahead)", false,                           optionListPtr, &opt_probe),
     opt_probe_vars    (_cat,    "cp3_probe_vars", "variable limit to enable PROBING", 3000000, IntRange(0, INT32_MAX),                                              optionListPtr, &pr_probe),
     opt_probe_cls     (_cat,    "cp3_probe_cls",  "clause limit to enable PROBING",   3000000, IntRange(0, INT32_MAX),                                              optionListPtr, &pr_probe),
     opt_probe_lits    (_cat,    "cp3_probe_lits", "total literal limit to enable PROBING",   30000000, IntRange(0, INT32_MAX),                                      optionListPtr, &pr_probe),
@@ -57,6 +57,10 @@ class CP3Config : public Riss::Config
     Riss::BoolOption opt_randInp     ;
     Riss::BoolOption opt_inc_inp     ;
     Riss::BoolOption opt_remL_inp    ;
+    Riss::BoolOption opt_isched      ;  // schedule inprocessing techniques by their payoff
+    Riss::StringOption opt_isched_techs; // techniques the scheduler chooses from
+    Riss::DoubleOption opt_isched_share; // fraction of the search time for inprocessing
+    Riss::DoubleOption opt_isched_decay; // weight of previous rounds in the payoff
 
     Riss::StringOption opt_whiteList ;
 
@@ -95,6 +99,7 @@ class CP3Config : public Riss::Config
 
 
     Riss::StringOption stepbystepoutput; // prefix of CNF filename to be printed after executing a given technique (adds technique to name, but not iteration)
+    Riss::StringOption opt_profile;      // file to write time, steps and memory of each technique call to
 
     Riss::StringOption opt_ptechs ;
     Riss::StringOption opt_itechs ;
@@ -494,6 +499,7 @@ class CP3Config : public Riss::Config
     Riss::IntOption  pr_opt_inpStepInc2      ;
     Riss::IntOption  pr_keepLHBRs  ;
     Riss::BoolOption pr_necBinaries  ;
+    Riss::BoolOption pr_parallel   ;
     Riss::IntOption opt_probe_vars;    // variable limit to enable
     Riss::IntOption opt_probe_cls;     // clause limit to enable
     Riss::IntOption opt_probe_lits;    // total literals limit to enable
@@ -127,7 +127,7 @@ void Circuit::getANDGates(const Var& v, vector< Coprocessor::Circuit::Gate >& ga
             bool foundBlockedCandidate = false;
             if (config.circ_genAND) {
                 // cerr << "c genMethod" << endl;
-                const vector<CRef>& cList = data.list(pos);  // all clauses C with pos \in C
+                const OccList& cList = data.list(pos);  // all clauses C with pos \in C
                 for (int i = 0 ; i < cList.size(); ++i) {    // there can be multiple full encoded gates per variable
                     const Clause& c = ca[ cList[i] ];
                     if (c.can_be_deleted() || c.size() < 3 || c.size() > data.lits.size() + 1) { continue; }    // new clauses that provide not too much literals
@@ -254,7 +254,7 @@ void Circuit::getExOGates(const Var& v, vector< Coprocessor::Circuit::Gate >& ga
 {
     for (int p = 0; p < 2 ; ++ p) {
         Lit pos = mkLit(v, p == 1);
-        vector<CRef>& list = data.list(pos);
+        OccList& list = data.list(pos);
         for (int i = 0 ; i < list.size(); ++ i) {
             const Clause& c = ca[list[i]];
             if (c.can_be_deleted() || c.size() == 2) { continue; }
@@ -272,7 +272,7 @@ void Circuit::getExOGates(const Var& v, vector< Coprocessor::Circuit::Gate >& ga
                 int count = 0 ;
                 for (int j = 0 ; j < c.size(); ++ j) {
                     const Lit& l = c[j];
-                    vector<CRef>& lList = data.list(l);
+                    OccList& lList = data.list(l);
                     count = 0 ;
                     for (int k = 0 ; k < lList.size(); ++ k) {
                         const Clause& ck = ca[lList[k]];
@@ -345,7 +345,7 @@ void Circuit::getExOGates(const Var& v, vector< Coprocessor::Circuit::Gate >& ga
         int count = 0;
         for (int j = 0 ; j < data.lits.size(); ++ j) {
             const Lit& l = data.lits[j];
-            vector<CRef>& lList = data.list(l);
+            OccList& lList = data.list(l);
             count = 0 ;
             for (int k = 0 ; k < lList.size(); ++ k) {
                 const Clause& ck = ca[lList[k]];
@@ -493,7 +493,7 @@ void Circuit::getFASUMGates(const Var& v, vector< Coprocessor::Circuit::Gate >&
                 if (blockLit == lit_Undef) { continue; }   // no opportunity for blocking!
 
                 // check whether the literal "blockLit" appears exactly four times in quad clauses, and not else!
-                vector<CRef>& list = data.list(blockLit);
+                OccList& list = data.list(blockLit);
                 int count = 0;
                 for (int j = 0 ; j < list.size(); ++ j) {
                     const Clause& c = ca[ list[j] ];
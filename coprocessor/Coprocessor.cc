@@ -63,9 +63,12 @@ Preprocessor::Preprocessor(Solver* _solver, CP3Config& _config, int32_t _threads
     , modprep(config, solver->ca, controller, data, *solver)
     , shuffler(config)
     , sls(config, data, solver->ca, controller)
+    , profiler(config.opt_profile)
+    , scheduler(config.opt_isched ? scheduledTechniques().c_str() : "", config.opt_isched_share, config.opt_isched_decay)
     , shuffleVariable(-1)
 {
     controller.init();
+    if (scheduler.schedules('V')) { solver->vivification.scheduled = true; }   // vivification is run during inprocessing only
 }
 
 Preprocessor::~Preprocessor()
@@ -133,7 +136,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_up) {
             if (config.opt_verbose > 0) { cerr << "c up ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") propagate" << endl; }
-            if (status == l_Undef) { status = propagation.process(data, true); }
+            if (status == l_Undef) { profileStart('u'); status = propagation.process(data, true); profileStop('u'); }
             if (config.opt_verbose > 1)  { printStatistics(cerr); propagation.printStatistics(cerr); }
         }
 
@@ -146,7 +149,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_xor) {
             if (config.opt_verbose > 0) { cerr << "c xor ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") XOR" << endl; }
-            if (status == l_Undef) { xorReasoning.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('x'); xorReasoning.process(); profileStop('x'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); xorReasoning.printStatistics(cerr); }
             if (! data.ok()) {
                 status = l_False;
@@ -164,7 +167,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_ent) {
             if (config.opt_verbose > 0) { cerr << "c ent ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") entailed redundancy" << endl; }
-            if (status == l_Undef) { entailedRedundant.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('1'); entailedRedundant.process(); profileStop('1'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); entailedRedundant.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-ENT.cnf").c_str(), 0););
         }
@@ -177,7 +180,7 @@ lbool Preprocessor::performSimplification()
 
         if (config.opt_ternResolve) {
             if (config.opt_verbose > 0) { cerr << "c res3 ..." << endl; }
-            resolving.process(false);
+            profileStart('3'); resolving.process(false); profileStop('3');
             if (config.opt_verbose > 1)  { printStatistics(cerr); resolving.printStatistics(cerr); }
             DOUT(if (printTernResolve || config.opt_debug || (config.printAfter != 0 && strlen(config.printAfter) > 0 && config.printAfter[0] == '3')) printFormula("after TernResolve"););
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-3RES.cnf").c_str(), 0););
@@ -192,7 +195,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_subsimp) {
             if (config.opt_verbose > 0) { cerr << "c subsimp ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") subsume/strengthen" << endl; }
-            if (status == l_Undef) { subsumption.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('s'); subsumption.process(); profileStop('s'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); subsumption.printStatistics(cerr); }
             if (! solver->okay()) {
                 status = l_False;
@@ -211,7 +214,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_FM) {
             if (config.opt_verbose > 0) { cerr << "c FM ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") fourier motzkin" << endl; }
-            if (status == l_Undef) { fourierMotzkin.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('f'); fourierMotzkin.process(); profileStop('f'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); fourierMotzkin.printStatistics(cerr); }
             if (! data.ok()) {
                 status = l_False;
@@ -229,7 +232,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_rew) {
             if (config.opt_verbose > 0) { cerr << "c rew ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") rewriting" << endl; }
-            if (status == l_Undef) { rewriter.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('r'); rewriter.process(); profileStop('r'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); rewriter.printStatistics(cerr); }
             if (! data.ok()) {
                 status = l_False;
@@ -247,7 +250,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_ee) {  // before this technique nothing should be run that alters the structure of the formula (e.g. BVE;BVA)
             if (config.opt_verbose > 0) { cerr << "c ee ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") equivalence elimination" << endl; }
-            if (status == l_Undef) { ee.process(data); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('e'); ee.process(data); profileStop('e'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); ee.printStatistics(cerr); }
             if (! data.ok()) {
                 status = l_False;
@@ -266,7 +269,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_unhide) {
             if (config.opt_verbose > 0) { cerr << "c unhide ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") unhiding" << endl; }
-            if (status == l_Undef) { unhiding.process(); }
+            if (status == l_Undef) { profileStart('g'); unhiding.process(); profileStop('g'); }
             if (config.opt_verbose > 1)  { printStatistics(cerr); unhiding.printStatistics(cerr); }
             if (!data.ok()) { status = l_False; }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-UNHIDE.cnf").c_str(), 0););
@@ -282,7 +285,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_hte) {
             if (config.opt_verbose > 0) { cerr << "c hte ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") hidden tautology elimination" << endl; }
-            if (status == l_Undef) { hte.process(data); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('h'); hte.process(data); profileStop('h'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); hte.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-HTE.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -297,7 +300,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_probe) {
             if (config.opt_verbose > 0) { cerr << "c probe ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") probing" << endl; }
-            if (status == l_Undef) { probing.process(); }
+            if (status == l_Undef) { profileStart('p'); probing.process(); profileStop('p'); }
             if (!data.ok()) { status = l_False; }
             if (config.opt_verbose > 1)  { printStatistics(cerr); probing.printStatistics(cerr); }
 
@@ -314,7 +317,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_bve) {
             if (config.opt_verbose > 0) { cerr << "c bve ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") bounded variable elimination" << endl; }
-            if (status == l_Undef) { status = bve.process(data); }   // can change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('v'); status = bve.process(data); profileStop('v'); }   // can change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); bve.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-BVE.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -329,7 +332,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_bva) {
             if (config.opt_verbose > 0) { cerr << "c bva ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") blocked variable addition" << endl; }
-            if (status == l_Undef) { bva.process(); }
+            if (status == l_Undef) { profileStart('w'); bva.process(); profileStop('w'); }
             if (config.opt_verbose > 1)  { printStatistics(cerr); bva.printStatistics(cerr); }
             if (!data.ok()) { status = l_False; }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-BVA.cnf").c_str(), 0););
@@ -345,7 +348,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_bce) {
             if (config.opt_verbose > 0) { cerr << "c bce ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") blocked clause elimination" << endl; }
-            if (status == l_Undef) { bce.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('b'); bce.process(); profileStop('b'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); bce.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-BCE.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -360,7 +363,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_la) {
             if (config.opt_verbose > 0) { cerr << "c la ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") blocked clause elimination" << endl; }
-            if (status == l_Undef) { la.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('l'); la.process(); profileStop('l'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); la.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-LA.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -375,7 +378,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_cce) {
             if (config.opt_verbose > 0) { cerr << "c cce ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") (covered) clause elimination" << endl; }
-            if (status == l_Undef) { cce.process(data); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('c'); cce.process(data); profileStop('c'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); cce.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-CCE.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -390,7 +393,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_rate) {
             if (config.opt_verbose > 0) { cerr << "c rate ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") resolution asymmetric tautology elimination" << endl; }
-            if (status == l_Undef) { rate.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('t'); rate.process(); profileStop('t'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); rate.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-RATE.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -405,7 +408,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_hbr) {
             if (config.opt_verbose > 0) { cerr << "c hbr ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") hyper binary resolution" << endl; }
-            if (status == l_Undef) { hbr.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('H'); hbr.process(); profileStop('H'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); hbr.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-HBR.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -417,7 +420,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_exp) {
             if (config.opt_verbose > 0) { cerr << "c exp ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") experimental techniques" << endl; }
-            if (status == l_Undef) { experimental.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('X'); experimental.process(); profileStop('X'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); experimental.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-EXP.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -429,7 +432,7 @@ lbool Preprocessor::performSimplification()
         if (config.opt_modprep) {
             if (config.opt_verbose > 0) { cerr << "c modprep ..." << endl; }
             if (config.opt_verbose > 4) { cerr << "c coprocessor(" << data.ok() << ") modprep techniques" << endl; }
-            if (status == l_Undef) { modprep.process(); }   // cannot change status, can generate new unit clauses
+            if (status == l_Undef) { profileStart('m'); modprep.process(); profileStop('m'); }   // cannot change status, can generate new unit clauses
             if (config.opt_verbose > 1)  { printStatistics(cerr); modprep.printStatistics(cerr); }
             DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-MODPREP.cnf").c_str(), 0););
             data.checkGarbage(); // perform garbage collection
@@ -446,7 +449,7 @@ lbool Preprocessor::performSimplification()
 
     if (config.opt_addRedBins) {
         if (config.opt_verbose > 0) { cerr << "c add2 ..." << endl; }
-        resolving.process(true);
+        profileStart('a'); resolving.process(true); profileStop('a');
         if (config.opt_verbose > 1)  { printStatistics(cerr); resolving.printStatistics(cerr); }
         DOUT(if ((const char*)config.stepbystepoutput != nullptr) outputFormula(string(string(config.stepbystepoutput) + "-ADD2.cnf").c_str(), 0););
         DOUT(if (printAddRedBin || config.opt_debug || (config.printAfter != 0 && strlen(config.printAfter) > 0 && config.printAfter[0] == 'a')) printFormula("after Add2"););
@@ -457,7 +460,9 @@ lbool Preprocessor::performSimplification()
         if (config.opt_verbose > 0) { cerr << "c sls ..." << endl; }
         if (config.opt_verbose > 4) { cerr << "c coprocessor sls" << endl; }
         if (status == l_Undef) {
+            profileStart('S');
             bool solvedBySls = sls.solve(data.getClauses(), config.opt_sls_flips == -1 ? (uint64_t)4000000000000000 : (uint64_t)config.opt_sls_flips);     // cannot change status, can generate new unit clauses
+            profileStop('S');
             cerr << "c sls returned " << solvedBySls << endl;
             if (solvedBySls) {
                 cerr << "c formula was solved with SLS!" << endl;
@@ -492,7 +497,9 @@ lbool Preprocessor::performSimplification()
     // dense only if not inprocessing, or if enabled explicitly
     if (config.opt_dense && (!data.isInprocessing() || config.opt_dense_inprocess)) {
         // do as very last step -- not nice, if there are units on the trail!
+        profileStart('d');
         dense.compress(false);
+        profileStop('d');
     }
 
     moh.cont();
@@ -537,6 +544,8 @@ lbool Preprocessor::performSimplification()
         if (config.opt_symm) { symmetry.printStatistics(cerr); }
     }
 
+    profiler.write(); // rewrite the profile with the calls of this simplification
+
     // destroy preprocessor data
     if (config.opt_verbose > 4) { cerr << "c coprocessor free data structures" << endl; }
     data.destroy();
@@ -693,7 +702,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // unit propagation has letter "u"
         if (execute == 'u' && config.opt_up && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c up" << endl; }
+            profileStart(execute);
             propagation.process(data, true);
+            profileStop(execute);
             change = propagation.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c UP changed formula: " << change << endl; }
         }
@@ -701,7 +712,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // subsumption has letter "s"
         else if (execute == 's' && config.opt_subsimp && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c subsimp" << endl; }
+            profileStart(execute);
             subsumption.process();
+            profileStop(execute);
             change = subsumption.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c Subsumption changed formula: " << change << endl; }
         }
@@ -709,7 +722,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // addRed2 "a"
         else if (execute == 'a' && config.opt_addRedBins && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c addRed2" << endl; }
+            profileStart(execute);
             resolving.process(true);
+            profileStop(execute);
             change = resolving.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c AddRed2 changed formula: " << change << endl; }
         }
@@ -717,7 +732,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // ternRes "3"
         else if (execute == '3' && config.opt_ternResolve && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c ternRes" << endl; }
+            profileStart(execute);
             resolving.process(false);
+            profileStop(execute);
             change = resolving.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c TernRes changed formula: " << change << endl; }
         }
@@ -725,7 +742,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // xorReasoning "x"
         else if (execute == 'x' && config.opt_xor && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c xor" << endl; }
+            profileStart(execute);
             xorReasoning.process();
+            profileStop(execute);
             change = xorReasoning.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c XOR changed formula: " << change << endl; }
         }
@@ -733,7 +752,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // probing "p"
         else if (execute == 'p' && config.opt_probe && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c probing" << endl; }
+            profileStart(execute);
             probing.process();
+            profileStop(execute);
             change = probing.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c Probing changed formula: " << change << endl; }
         }
@@ -741,7 +762,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // unhide "g"
         else if (execute == 'g' && config.opt_unhide && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c unhiding" << endl; }
+            profileStart(execute);
             unhiding.process();
+            profileStop(execute);
             change = unhiding.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c Unhiding changed formula: " << change << endl; }
         }
@@ -749,7 +772,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // bva "w"
         else if (execute == 'w' && config.opt_bva && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c bva" << endl; }
+            profileStart(execute);
             bva.process();
+            profileStop(execute);
             change = bva.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c BVA changed formula: " << change << endl; }
         }
@@ -757,7 +782,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // bve "v"
         else if (execute == 'v' && config.opt_bve && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c bve" << endl; }
+            profileStart(execute);
             bve.process(data);
+            profileStop(execute);
             change = bve.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c BVE changed formula: " << change << endl; }
         }
@@ -765,7 +792,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // ee "e"
         else if (execute == 'e' && config.opt_ee && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c ee" << endl; }
+            profileStart(execute);
             ee.process(data);
+            profileStop(execute);
             change = ee.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c EE changed formula: " << change << endl; }
         }
@@ -773,7 +802,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // bce "b"
         else if (execute == 'b' && config.opt_bce && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c bce" << endl; }
+            profileStart(execute);
             bce.process();
+            profileStop(execute);
             change = bce.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c BCE changed formula: " << change << endl; }
         }
@@ -781,7 +812,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // literaladdition "l"
         else if (execute == 'l' && config.opt_la && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c la" << endl; }
+            profileStart(execute);
             la.process();
+            profileStop(execute);
             change = la.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c LA changed formula: " << change << endl; }
         }
@@ -789,7 +822,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // entailedRedundant "1"
         else if (execute == '1' && config.opt_ent && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c ent" << endl; }
+            profileStart(execute);
             entailedRedundant.process();
+            profileStop(execute);
             change = entailedRedundant.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c ENT changed formula: " << change << endl; }
         }
@@ -797,7 +832,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // cce "c"
         else if (execute == 'c' && config.opt_cce && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c cce" << endl; }
+            profileStart(execute);
             cce.process(data);
+            profileStop(execute);
             change = cce.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c CCE changed formula: " << change << endl; }
         }
@@ -805,7 +842,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // rate "t"
         else if (execute == 't' && config.opt_rate && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c rate" << endl; }
+            profileStart(execute);
             rate.process();
+            profileStop(execute);
             change = rate.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c RATE changed formula: " << change << endl; }
         }
@@ -813,7 +852,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // HBR "H"
         else if (execute == 'H' && config.opt_hbr && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c HBR" << endl; }
+            profileStart(execute);
             hbr.process();
+            profileStop(execute);
             change = hbr.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c HBR changed formula: " << change << endl; }
         }
@@ -821,7 +862,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // EXP "X"
         else if (execute == 'X' && config.opt_exp && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c EXP" << endl; }
+            profileStart(execute);
             experimental.process();
+            profileStop(execute);
             change = experimental.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c EXP changed formula: " << change << endl; }
         }
@@ -829,7 +872,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // MODPREP "m"
         else if (execute == 'm' && config.opt_modprep && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c MODPREP" << endl; }
+            profileStart(execute);
             modprep.process();
+            profileStop(execute);
             change = modprep.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c MODPREP changed formula: " << change << endl; }
         }
@@ -837,7 +882,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // hte "h"
         else if (execute == 'h' && config.opt_hte && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c hte" << endl; }
+            profileStart(execute);
             hte.process(data);
+            profileStop(execute);
             change = hte.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c HTE changed formula: " << change << endl; }
         }
@@ -845,7 +892,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // rewriting "r"
         else if (execute == 'r' && config.opt_rew && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c rew" << endl; }
+            profileStart(execute);
             rewriter.process();
+            profileStop(execute);
             change = rewriter.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c REW changed formula: " << change << endl; }
         }
@@ -853,7 +902,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // fourier motzkin "f"
         else if (execute == 'f' && config.opt_FM && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c fm" << endl; }
+            profileStart(execute);
             fourierMotzkin.process();
+            profileStop(execute);
             change = fourierMotzkin.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c FM changed formula: " << change << endl; }
         }
@@ -861,7 +912,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         // f "d"
         else if (execute == 'd' && config.opt_dense && status == l_Undef && data.ok()) {
             if (config.opt_verbose > 2) { cerr << "c dense" << endl; }
+            profileStart(execute);
             dense.compress(true);
+            profileStop(execute);
             change = dense.appliedSomething() || change;
             if (config.opt_verbose > 1) { cerr << "c Dense changed formula: " << change << endl; }
         }
@@ -905,7 +958,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         if (config.opt_verbose > 0) { cerr << "c sls ..." << endl; }
         if (config.opt_verbose > 4) { cerr << "c coprocessor sls" << endl; }
         if (status == l_Undef) {
+            profileStart('S');
             bool solvedBySls = sls.solve(data.getClauses(), config.opt_sls_flips == -1 ? (uint64_t)4000000000000000 : (uint64_t)config.opt_sls_flips);     // cannot change status, can generate new unit clauses
+            profileStop('S');
             if (solvedBySls) {
                 cerr << "c formula was solved with SLS!" << endl;
                 cerr // << endl
@@ -939,7 +994,9 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
     // dense only if not inprocessing, or if enabled explicitly
     if (config.opt_dense && (!data.isInprocessing() || config.opt_dense_inprocess)) {
         // do as very last step -- not nice, if there are units on the trail!
+        profileStart('d');
         dense.compress(false);
+        profileStop('d');
     }
 
     moh.cont();
@@ -982,6 +1039,8 @@ lbool Preprocessor::performSimplificationScheduled(string techniques)
         if (config.opt_symm) { symmetry.printStatistics(cerr); }
     }
 
+    profiler.write(); // rewrite the profile with the calls of this simplification
+
     // destroy preprocessor data
     if (config.opt_verbose > 4) { cerr << "c coprocessor free data structures" << endl; }
     data.destroy();
@@ -1006,7 +1065,9 @@ lbool Preprocessor::preprocess()
     }
 
     if (config.opt_symm && config.opt_enabled) {  // do only if preprocessor is enabled
+        profileStart('y');
         symmetry.process();
+        profileStop('y');
         if (config.opt_verbose > 1)  { printStatistics(cerr); symmetry.printStatistics(cerr); }
     }
 
@@ -1050,6 +1111,8 @@ bool Preprocessor::wantsToInprocess()
     if (lastInpConflicts + config.opt_inprocessInt > solver->conflicts) {
         return false;
     }
+    // with the scheduler, the conflict interval is the minimal distance, and some technique has to have enough credit
+    if (config.opt_isched) { return scheduler.due(wallClockTime()); }
     return true;
 }
 
@@ -1076,6 +1139,22 @@ lbool Preprocessor::inprocess()
         /* make sure the solver is at level 0 - not guarantueed with partial restarts!*/
         solver->cancelUntil(0);
 
+        // techniques of this round, vivification works on the data structures of the search, before the preprocessor takes the clauses
+        lbool ret = l_Undef;
+        string scheduled = config.opt_isched ? scheduler.select() : string();
+        if (config.opt_isched && config.opt_verbose > 0) { cerr << "c scheduled inprocessing techniques: " << scheduled << endl; }
+        const size_t vivify = scheduled.find('V');
+        if (vivify != string::npos) {
+            scheduled.erase(vivify, 1);
+            ret = vivifySearch();
+            if (scheduled.empty()) {   // no technique of the preprocessor is due, so do not set up its data structures
+                scheduler.finishRound(wallClockTime());
+                lastInpConflicts = solver->conflicts;
+                meltSearchVariables();
+                return ret;
+            }
+        }
+
         if (config.opt_verbose > 3) { cerr << "c start inprocessing after another " << solver->conflicts - lastInpConflicts << endl; }
         data.inprocessing();
         const bool wasDoingER = solver->getExtendedResolution();
@@ -1097,8 +1176,10 @@ lbool Preprocessor::inprocess()
         if (config.opt_randInp) { data.randomized(); }
         if (config.opt_inc_inp) { giveMoreSteps(); }
 
-        lbool ret = l_Undef;
-        if (config.opt_itechs  && string(config.opt_itechs).size() > 0) { ret = performSimplificationScheduled(string(config.opt_itechs)); }
+        if (config.opt_isched) {
+            if (ret == l_Undef && !scheduled.empty()) { ret = performSimplificationScheduled(scheduled); }
+            scheduler.finishRound(wallClockTime());
+        } else if (config.opt_itechs  && string(config.opt_itechs).size() > 0) { ret = performSimplificationScheduled(string(config.opt_itechs)); }
         else { ret = performSimplification(); }
 
         lastInpConflicts = solver->conflicts;
@@ -1135,6 +1216,84 @@ void Preprocessor::giveMoreSteps()
     modprep.giveMoreSteps();
 }
 
+void Preprocessor::getStepUsage(char technique, int64_t& steps, int64_t& limit) const
+{
+    switch (technique) {
+    case 's': subsumption.getStepUsage(steps, limit); break;
+    case 'v': bve.getStepUsage(steps, limit); break;
+    case 'p': probing.getStepUsage(steps, limit); break;
+    case 'r': rewriter.getStepUsage(steps, limit); break;
+    case 'f': fourierMotzkin.getStepUsage(steps, limit); break;
+    default:  steps = -1; limit = -1; break;    // technique does not count steps
+    }
+}
+
+void Preprocessor::profileStart(char technique)
+{
+    if (config.opt_isched && data.isInprocessing() && scheduler.schedules(technique)) {
+        int64_t clauses = 0, literals = 0;
+        formulaSize(clauses, literals);
+        scheduler.start(technique, wallClockTime(), clauses, literals);
+    }
+    if (!profiler.enabled()) { return; }
+    int64_t steps = -1, limit = -1;
+    getStepUsage(technique, steps, limit);
+    profiler.start(technique, data, ca, steps, limit);
+}
+
+void Preprocessor::profileStop(char technique)
+{
+    if (config.opt_isched && data.isInprocessing() && scheduler.schedules(technique)) {
+        int64_t clauses = 0, literals = 0;
+        formulaSize(clauses, literals);
+        scheduler.stop(wallClockTime(), clauses, literals);
+    }
+    if (!profiler.enabled()) { return; }
+    int64_t steps = -1, limit = -1;
+    getStepUsage(technique, steps, limit);
+    profiler.stop(data, ca, steps);
+}
+
+string Preprocessor::scheduledTechniques() const
+{
+    string letters;
+    for (const char* l = config.opt_isched_techs; l != 0 && *l != 0; ++ l) {
+        bool enabled = false;
+        switch (*l) {
+        case 's': enabled = config.opt_subsimp; break;
+        case 'e': enabled = config.opt_ee; break;
+        case 'p': enabled = config.opt_probe; break;
+        case 'v': enabled = config.opt_bve; break;
+        case 'g': enabled = config.opt_unhide; break;
+        case 'h': enabled = config.opt_hte; break;
+        case 'w': enabled = config.opt_bva; break;
+        case 'b': enabled = config.opt_bce; break;
+        case 'c': enabled = config.opt_cce; break;
+        case 'V': enabled = solver->vivification.enabled; break;
+        default:  enabled = false; break;   // the scheduler does not handle this technique
+        }
+        if (enabled) { letters += *l; }
+        else if (config.opt_verbose > 0) { cerr << "c inprocessing scheduler ignores technique " << *l << endl; }
+    }
+    return letters;
+}
+
+void Preprocessor::formulaSize(int64_t& clauses, int64_t& literals)
+{
+    // counters that are maintained by the techniques anyway, scanning the formula twice per call would be too expensive
+    clauses = data.nCls();
+    literals = (int64_t)ca.size() - ca.wasted();   // live part of the clause arena, freed clauses and literals are counted as wasted
+}
+
+lbool Preprocessor::vivifySearch()
+{
+    // the search maintains the size of its formula, so there is no need to scan it
+    scheduler.start('V', wallClockTime(), solver->nClauses(), solver->clauses_literals);
+    const bool ok = solver->vivifyIrredundant();
+    scheduler.stop(wallClockTime(), solver->nClauses(), solver->clauses_literals);
+    return ok ? l_Undef : l_False;
+}
+
 lbool Preprocessor::preprocessScheduled()
 {
     // TODO execute preprocessing techniques in specified order
@@ -1210,6 +1369,14 @@ void Preprocessor::printStatistics(ostream& stream)
            << thisClauses - data.getClauses().size() << " rem-cls, "
            << thisLearnts - data.getLEarnts().size() << " rem-learnts, "
            << endl;
+
+    stream << "c [STAT] CP3(3) "
+           << data.getOccurrences().bytes() << " occ-bytes, "
+           << data.getOccurrences().usedBytes() << " occ-used-bytes, "
+           << data.getOccurrences().getCompactions() << " occ-compactions, "
+           << endl;
+
+    if (config.opt_isched) { scheduler.printStatistics(stream); }
 }
 
 void Preprocessor::extendModel(vec< lbool >& model)
@@ -1239,6 +1406,25 @@ void Preprocessor::extendModel(vec< lbool >& model)
     }
 }
 
+bool Preprocessor::localSearchPhases(vec<char>& polarity, uint64_t flips, bool& foundModel)
+{
+    foundModel = false;
+    data.init(solver->nVars());
+    if (sls.formulaTooLarge()) {
+        data.destroy();
+        return false;
+    }
+
+    // the clauses stay attached in the solver, sls only reads them
+    foundModel = sls.solve(data.getClauses(), flips, &polarity);
+    polarity.growTo(solver->nVars(), 2);
+    for (Var v = 0 ; v < solver->nVars(); ++ v) { polarity[v] = sls.getModelPolarity(v) == 1 ? 1 : 0; } // minisat uses sign instead of polarity!
+
+    sls.destroy();
+    data.destroy();
+    return true;
+}
+
 
 void Preprocessor::initializePreprocessor()
 {
@@ -1281,6 +1467,7 @@ void Preprocessor::initializePreprocessor()
         }
         clss.shrink_(clss.size() - thisClss);   // remove redundant clauses from vector!
     }
+    data.checkOccurrenceCompaction(0.25);   // the lists grew clause by clause, store them one after the other
 
     if (config.opt_whiteList != 0 && string(config.opt_whiteList).size() != 0) {
         // parse white list file, and set all existing variables to "do not touch"
@@ -1395,11 +1582,13 @@ void Preprocessor::destroyTechniques()
 void Preprocessor::cleanSolver()
 {
     solver->watches.cleanAll();
+    solver->watchesBin.cleanAll();
 
     // clear all watches!
     for (int v = 0; v < solver->nVars(); v++)
         for (int s = 0; s < 2; s++) {
             solver->watches[ mkLit(v, s) ].clear();
+            solver->watchesBin[ mkLit(v, s) ].clear();
         }
 
     solver->learnts_literals = 0;
@@ -1638,7 +1827,7 @@ void Preprocessor::scanCheck(const string& headline)
     for (Var v = 0 ; v < data.nVars(); ++v) {
         for (int p = 0 ; p < 2; ++ p) {
             const Lit l = mkLit(v, p == 0);
-            vector<CRef>& list = data.list(l);
+            OccList& list = data.list(l);
             for (int i = 0 ; i < list.size(); ++ i) {
                 const Clause& c = ca[ list[i] ];
                 bool found = false;
@@ -1675,12 +1864,8 @@ void Preprocessor::fullCheck(const string& headline)
             else {
                 for (int j = 0 ; j < 2; ++ j) {
                     const Lit l = ~c[j];
-                    vec<Watcher>&  ws  = solver->watches[l];
-                    bool didFind = false;
-                    for (int j = 0 ; j < ws.size(); ++ j) {
-                        CRef     wcr        = ws[j].cref();
-                        if (wcr  == cr) { didFind = true; break; }
-                    }
+                    BinWatchLists::List wbin = solver->watchesBin[l];
+                    const bool didFind = c.size() == 2 ? find(wbin, Watcher(cr, c[1 - j], 0)) : find(solver->watches[l], Watcher(cr, c[1 - j], 1));
                     if (! didFind) { cerr << "could not find clause[" << cr << "] " << c << " in watcher for lit " << l << endl; }
 //                     assert( didFind && "clause should be in watch list of its two first literals" );
                 }
@@ -1750,6 +1935,11 @@ void Preprocessor::printSolver(ostream& s, int verbose)
     for (Var v = 0 ; v < solver->nVars(); ++ v) {
         for (int pl = 0 ; pl < 2; ++ pl) {
             const Lit p = mkLit(v, pl == 1);
+            BinWatchLists::List  wbin  = solver->watchesBin[p];
+            for (int i = 0 ; i <  wbin.size();  i ++) {
+                cerr << "c binary watch for " << p << " clause [" << wbin[i].cref() << "] with implied literal " << wbin[i].blocker() << endl;
+            }
+
             vec<Riss::Watcher>&  ws  = solver->watches[p];
 
             for (int i = 0 ; i <  ws.size();  i ++) {
@@ -36,6 +36,8 @@ Copyright (c) 2012, Norbert Manthey, LGPL v2, see LICENSE
 #include "coprocessor/techniques/Experimental.h"
 #include "coprocessor/techniques/ModPrep.h"
 #include "coprocessor/Shuffler.h"
+#include "coprocessor/TechniqueProfiler.h"
+#include "coprocessor/InprocessScheduler.h"
 
 #include "coprocessor/techniques/SLS.h"
 
@@ -100,6 +102,14 @@ class Preprocessor
     /** take a given model and modify it such that its a model for the actual input formula again */
     void extendModel(Riss::vec<Riss::lbool>& model);
 
+    /** run local search on the irredundant clauses of the solver to improve the given phases
+     * @param polarity phases to start from (solver polarity, 1 = false, 2 = no phase), contains the final assignment afterwards
+     * @param flips number of flips the local search is allowed to perform
+     * @param foundModel is set to true, if the final assignment satisfies all considered clauses
+     * @return false, if local search has not been executed (formula too large)
+     */
+    bool localSearchPhases(Riss::vec<char>& polarity, uint64_t flips, bool& foundModel);
+
     /* TODO:
      - extra classes for each extra techniques, which are friend of coprocessor class
      - extend model
@@ -123,12 +133,23 @@ class Preprocessor
      */
     bool parseUndoInfo(const std::string& filename);
 
+    /** parse model extend information and variable map from a binary CNF file (the formula itself is not used)
+     * @return false, if some error happened
+     */
+    bool parseBinaryUndoInfo(const std::string& filename);
+
     /** write model extend information to specified file
      * @param originalVariables variables that are present in the actual problem (tool might have added variables from the outside)
      * @return false, if some error happened
      */
     bool writeUndoInfo(const std::string& filename, int originalVariables = -1);
 
+    /** write the formula, the model extend information and the variable map into a single binary CNF file
+     * @param originalVariables variables that are present in the actual problem (tool might have added variables from the outside)
+     * @return false, if some error happened
+     */
+    bool writeBinaryFormula(const std::string& filename, int originalVariables = -1);
+
     /** return info about formula to be writtern*/
     void getCNFinfo(int& vars, int& cls);
 
@@ -155,6 +176,9 @@ class Preprocessor
 
     int importLit(const int& lit) const;
 
+    /** measurements of the technique calls so far (only collected with cp3_profile) */
+    const TechniqueProfiler& getProfiler() const { return profiler; }
+
   protected:
     //
     // techniques
@@ -185,6 +209,9 @@ class Preprocessor
 
     SLS sls;
 
+    TechniqueProfiler profiler;  // measure each call of a technique, if enabled
+    InprocessScheduler scheduler; // choose the techniques for inprocessing by their payoff, if enabled
+
     int shuffleVariable;  // number of variables that have been present when the formula has been shuffled
     Riss::vec<Riss::Var> specialFrozenVariables;
 
@@ -200,6 +227,16 @@ class Preprocessor
 
     void giveMoreSteps();
 
+    // profiling of single techniques
+    void profileStart(char technique);           // start measuring a call to the technique with the given letter
+    void profileStop(char technique);            // finish measuring the call, and remember the measurement
+    void getStepUsage(char technique, int64_t& steps, int64_t& limit) const; // steps and step limit of the technique with the given letter
+
+    // payoff driven inprocessing
+    std::string scheduledTechniques() const;     // letters of cp3_isched_techs, whose techniques are enabled
+    void formulaSize(int64_t& clauses, int64_t& literals);            // size of the formula in the preprocessor, from the maintained counters
+    Riss::lbool vivifySearch();                  // vivify the irredundant clauses with the search, measured by the scheduler
+
     void shuffle();           // shuffle the formula
     void unshuffle(Riss::vec< Riss::lbool >& model);      // unshuffle the formula
 
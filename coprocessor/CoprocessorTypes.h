@@ -12,6 +12,7 @@ Copyright (c) 2012, Norbert Manthey, LGPL v2, see LICENSE
 
 #include "riss/utils/LockCollection.h"
 #include "riss/utils/AutoDelete.h"
+#include "coprocessor/OccurrenceLists.h"
 
 #include <vector>
 #include <ostream>
@@ -25,7 +26,7 @@ const bool global_debug_out = false;
 //forward declaration
 class VarGraphUtils;
 
-typedef std::vector<std::vector <Riss::CRef> > ComplOcc;
+typedef OccurrenceLists ComplOcc;
 
 /** class that measures the time between creation and destruction of the object, and adds it*/
 class MethodTimer
@@ -96,7 +97,7 @@ class CoprocessorData
     int countLitOcc(Riss::Lit l)
     {
         int count = 0;
-        std::vector<Riss::CRef>& list = occs[Riss::toInt(l)];
+        OccList& list = occs[Riss::toInt(l)];
         for (int i = 0; i < list.size(); ++i) {
             Riss::CRef cr = list[i];
             if (cr == Riss::CRef_Undef) { continue; }
@@ -140,8 +141,8 @@ class CoprocessorData
 
     int32_t& operator[](const Riss::Lit& l);                            // return the number of occurrences of literal l
     int32_t operator[](const Riss::Var& v) const;                       // return the number of occurrences of variable v
-    std::vector<Riss::CRef>& list(const Riss::Lit& l);                  // return the list of clauses, which have literal l
-    const std::vector< Riss::CRef >& list(const Riss::Lit& l) const;    // return the list of clauses, which have literal l
+    OccList& list(const Riss::Lit& l);                  // return the list of clauses, which have literal l
+    const OccList& list(const Riss::Lit& l) const;    // return the list of clauses, which have literal l
 
     Riss::vec<Riss::CRef>& getClauses();   // return the std::vector of clauses in the solver object
     Riss::vec<Riss::CRef>& getLEarnts();   // return the std::vector of learnt clauses in the solver object
@@ -221,6 +222,11 @@ class CoprocessorData
     void checkGarbage(std::vector<Riss::CRef> ** updateVectors = 0, int size = 0) { return checkGarbage(solver->garbage_frac, updateVectors, size); }
     void checkGarbage(double gf, std::vector<Riss::CRef> ** updateVectors = 0, int size = 0) {  if (ca.wasted() > ca.size() * gf) { garbageCollect(updateVectors, size); }  }
 
+    // Occurrence list memory
+    void checkOccurrenceCompaction(double fraction) { occs.checkCompact(fraction); }  // store lists contiguously again, if too much of their memory is unused
+    const ComplOcc& getOccurrences() const { return occs; }
+    void resetOccurrencePeak() { occs.resetPeak(); }   // track the peak memory of the lists from now on
+
     void updateClauseAfterDelLit(const Riss::Clause& clause)
     {
         if (global_debug_out) {
@@ -427,6 +433,12 @@ class BIG
 
     uint32_t duringCreationVariables; // number of variables for the last construction call
 
+    std::vector<Riss::Lit> pendingEdges; // binary clauses that have been added since the last construction, two literals per clause
+    uint32_t lastStamp;                  // largest stamp that has been assigned so far
+
+    /** forget the pending edges, as the construction adds all binary clauses of the formula, and memorize the number of variables */
+    void startConstruction(uint32_t nVars);
+
     uint32_t stampLiteral(const Riss::Lit& literal, uint32_t stamp, int32_t* index, std::deque< Riss::Lit >& stampQueue);
     void shuffle(Riss::Lit* adj, int size) const;
 
@@ -445,6 +457,20 @@ class BIG
     /** return the number of variables that are known by the BIG */
     uint32_t getVars() const { return duringCreationVariables; }
 
+    /** memorize the binary clause [l0, l1], which is added to the graph during the next call to integratePendingEdges
+     *  Note: clauses with variables that are not known by the BIG are ignored
+     */
+    void addEdge(const Riss::Lit& l0, const Riss::Lit& l1);
+
+    /** return true, if there are binary clauses that have not been integrated into the graph yet */
+    bool hasPendingEdges() const { return !pendingEdges.empty(); }
+
+    /** add all pending binary clauses to the graph, without looking at any other clause, and recompute the stamps
+     *  only for the connected components that received new edges
+     *  Note: as edges are never removed, this is only sound as long as all added clauses are implied by the formula
+     */
+    void integratePendingEdges(uint32_t nVars, Riss::vec<Riss::Lit>& tmpLits);
+
     /** removes an edge from the graph again */
     void removeEdge(const Riss::Lit& l0, const Riss::Lit& l1);
 
@@ -635,7 +661,7 @@ inline void CoprocessorData::init(uint32_t nVars)
 
 inline void CoprocessorData::destroy()
 {
-    ComplOcc().swap(occs); // free physical space of the std::vector
+    occs.clear(); // free physical space of the lists
     std::vector<int32_t>().swap(lit_occurrence_count);
     modTimer.destroy();
 }
@@ -702,6 +728,11 @@ inline void CoprocessorData::moveVar(Riss::Var from, Riss::Var to, bool final)
         solver->varFlags[to].frozen = solver->varFlags[from].frozen; solver->varFlags[from].frozen = false;
 
         solver->eqInfo.replacedBy[to] = solver->eqInfo.replacedBy[from]; solver->eqInfo.replacedBy[from] = Riss::mkLit(from, false);
+        if (solver->rephasing.enabled) {
+            solver->rephasing.original[to] = solver->rephasing.original[from];
+            solver->rephasing.target[to] = solver->rephasing.target[from]; solver->rephasing.target[from] = 2;
+            solver->rephasing.best[to] = solver->rephasing.best[from]; solver->rephasing.best[from] = 2;
+        }
 
         // cp3 structures
         lit_occurrence_count[Riss::toInt(Riss::mkLit(to, false))] = lit_occurrence_count[Riss::toInt(Riss::mkLit(from, false))];
@@ -715,6 +746,11 @@ inline void CoprocessorData::moveVar(Riss::Var from, Riss::Var to, bool final)
         solver->vardata.shrink_(solver->vardata.size() - to - 1);
         solver->activity.shrink_(solver->activity.size() - to - 1);
         solver->varFlags.shrink_(solver->varFlags.size() - to - 1);
+        if (solver->rephasing.enabled) {
+            solver->rephasing.original.shrink_(solver->rephasing.original.size() - to - 1);
+            solver->rephasing.target.shrink_(solver->rephasing.target.size() - to - 1);
+            solver->rephasing.best.shrink_(solver->rephasing.best.size() - to - 1);
+        }
 
         solver->rebuildOrderHeap();
 
@@ -866,7 +902,7 @@ inline void CoprocessorData::addClause(const Riss::CRef& cr, Riss::Heap<VarOrder
 
 inline bool CoprocessorData::removeClauseFrom(const Riss::CRef& cr, const Riss::Lit& l)
 {
-    std::vector<Riss::CRef>& list = occs[Riss::toInt(l)];
+    OccList& list = occs[Riss::toInt(l)];
     for (int i = 0 ; i < list.size(); ++ i) {
         if (list[i] == cr) {
             list[i] = list[ list.size() - 1 ];
@@ -879,7 +915,7 @@ inline bool CoprocessorData::removeClauseFrom(const Riss::CRef& cr, const Riss::
 
 inline void CoprocessorData::removeClauseFrom(const Riss::CRef& cr, const Riss::Lit& l, const int index)
 {
-    std::vector<Riss::CRef>& list = occs[Riss::toInt(l)];
+    OccList& list = occs[Riss::toInt(l)];
     assert(list[index] == cr);
     list[index] = list[ list.size() - 1 ];
     list.pop_back();
@@ -891,7 +927,7 @@ inline void CoprocessorData::removeClauseFrom(const Riss::CRef& cr, const Riss::
 inline bool CoprocessorData::removeClauseFromThreadSafe(const Riss::CRef& cr, const Riss::Lit& l)
 {
     assert(cr != Riss::CRef_Undef);
-    std::vector<Riss::CRef>& list = occs[Riss::toInt(l)];
+    OccList& list = occs[Riss::toInt(l)];
     for (int i = 0 ; i < list.size(); ++ i) {
         if (list[i] == cr) {
             list[i] = Riss::CRef_Undef;
@@ -910,7 +946,7 @@ inline void CoprocessorData::cleanUpOccurrences(const Riss::MarkArray& dirtyOccs
 {
     for (int l = 0 ; l < dirtyOccs.size() ; ++ l) {
         if (dirtyOccs.getIndex(l) >= timer) {
-            std::vector<Riss::CRef>& list = occs[l];
+            OccList& list = occs[l];
             int i = 0;
             while (i < list.size()) {
                 if (list[i] == Riss::CRef_Undef) {
@@ -1359,12 +1395,12 @@ inline int32_t CoprocessorData::operator[](const Riss::Var& v) const
     return lit_occurrence_count[Riss::toInt(Riss::mkLit(v, 0))] + lit_occurrence_count[Riss::toInt(Riss::mkLit(v, 1))];
 }
 
-inline std::vector< Riss::CRef >& CoprocessorData::list(const Riss::Lit& l)
+inline OccList& CoprocessorData::list(const Riss::Lit& l)
 {
     return occs[ Riss::toInt(l) ];
 }
 
-inline const std::vector< Riss::CRef >& CoprocessorData::list(const Riss::Lit& l) const
+inline const OccList& CoprocessorData::list(const Riss::Lit& l) const
 {
     return occs[ Riss::toInt(l) ];
 }
@@ -1465,7 +1501,7 @@ inline void CoprocessorData::relocAll(Riss::ClauseAllocator& to, std::vector<Ris
     // All Occurrences
     for (int v = 0 ; v < nVars(); ++ v) {
         for (int i = 0 ; i < 2; ++i) {
-            std::vector<Riss::CRef>& litOccs = list(Riss::mkLit(v, ((i == 0) ? false : true)));
+            OccList& litOccs = list(Riss::mkLit(v, ((i == 0) ? false : true)));
             int j, k;
             for (j = k = 0; j < litOccs.size(); ++j) {
                 if (litOccs[j] == Riss::CRef_Undef) {
@@ -1482,6 +1518,7 @@ inline void CoprocessorData::relocAll(Riss::ClauseAllocator& to, std::vector<Ris
             litOccs.resize(k);
         }
     }
+    occs.checkCompact(0.5);   // lists are traversed in order after a garbage collection, keep them close to each other
     // Watches are clean!
 
     // All reasons:
@@ -1556,20 +1593,14 @@ inline void CoprocessorData::relocAll(Riss::ClauseAllocator& to, std::vector<Ris
  */
 inline void CoprocessorData::mark1(Riss::Var x, Riss::MarkArray& array)
 {
-    std::vector<Riss::CRef>& clauses = occs[Riss::toInt(Riss::mkLit(x, true))];
-    for (int i = 0; i < clauses.size(); ++i) {
-        Riss::CRef cr = clauses[i];
-        Riss::Clause& c = ca[cr];
-        for (int j = 0; j < c.size(); ++j) {
-            array.setCurrentStep(var(c[j]));
-        }
-    }
-    clauses = occs[Riss::toInt(Riss::mkLit(x, false))];
-    for (int i = 0; i < clauses.size(); ++i) {
-        Riss::CRef cr = clauses[i];
-        Riss::Clause& c = ca[cr];
-        for (int j = 0; j < c.size(); ++j) {
-            array.setCurrentStep(var(c[j]));
+    for (int p = 0 ; p < 2; ++ p) {
+        const OccList& clauses = occs[Riss::toInt(Riss::mkLit(x, p == 0))];
+        for (int i = 0; i < clauses.size(); ++i) {
+            Riss::CRef cr = clauses[i];
+            Riss::Clause& c = ca[cr];
+            for (int j = 0; j < c.size(); ++j) {
+                array.setCurrentStep(var(c[j]));
+            }
         }
     }
 }
@@ -1586,27 +1617,18 @@ inline void CoprocessorData::mark1(Riss::Var x, Riss::MarkArray& array)
 inline void CoprocessorData::mark2(Riss::Var x, Riss::MarkArray& array, Riss::MarkArray& tmp)
 {
     tmp.nextStep();
-    // for negative literal
-    std::vector<Riss::CRef>& clauses = occs[Riss::toInt(Riss::mkLit(x, true))];
-    for (int i = 0; i < clauses.size(); ++i) {
-        Riss::Clause& c = ca[clauses[i]];
-        // for l in C
-        for (int l = 0; l < c.size(); ++l) {
-            if (!tmp.isCurrentStep(var(c[l]))) {
-                mark1(var(c[l]), array);
-            }
-            tmp.setCurrentStep(var(c[l]));
-        }
-    }
-    // for positive literal
-    clauses = occs[Riss::toInt(Riss::mkLit(x, false))];
-    for (int i = 0; i < clauses.size(); ++i) {
-        Riss::Clause& c = ca[clauses[i]];
-        for (int l = 0; l < c.size(); ++l) {
-            if (!tmp.isCurrentStep(var(c[l]))) {
-                mark1(var(c[l]), array);
+    // for negative literal, then for positive literal
+    for (int p = 0 ; p < 2; ++ p) {
+        const OccList& clauses = occs[Riss::toInt(Riss::mkLit(x, p == 0))];
+        for (int i = 0; i < clauses.size(); ++i) {
+            Riss::Clause& c = ca[clauses[i]];
+            // for l in C
+            for (int l = 0; l < c.size(); ++l) {
+                if (!tmp.isCurrentStep(var(c[l]))) {
+                    mark1(var(c[l]), array);
+                }
+                tmp.setCurrentStep(var(c[l]));
             }
-            tmp.setCurrentStep(var(c[l]));
         }
     }
 }
@@ -1880,7 +1902,7 @@ bool inline CoprocessorData::removeClauseThreadSafe(const Riss::CRef& cr)
 }
 
 inline BIG::BIG()
-    : storage(0), sizes(0), big(0), start(0), stop(0), duringCreationVariables(0)
+    : storage(0), sizes(0), big(0), start(0), stop(0), duringCreationVariables(0), lastStamp(0)
 {}
 
 inline BIG::~BIG()
@@ -1893,9 +1915,15 @@ inline BIG::~BIG()
 
 }
 
+inline void BIG::startConstruction(uint32_t nVars)
+{
+    pendingEdges.clear();
+    duringCreationVariables = nVars;
+}
+
 inline void BIG::create(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec< Riss::CRef >& list)
 {
-    duringCreationVariables = nVars; // memorize the number of present variables
+    startConstruction(nVars);
     sizes = (int*) malloc(sizeof(int) * nVars * 2);
     memset(sizes, 0, sizeof(int) * nVars * 2);
 
@@ -1934,7 +1962,7 @@ inline void BIG::create(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec< Ri
 
 inline void BIG::create(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec< Riss::CRef >& list1, Riss::vec< Riss::CRef >& list2)
 {
-    duringCreationVariables = nVars; // memorize the number of present variables
+    startConstruction(nVars);
     sizes = (int*) malloc(sizeof(int) * nVars * 2);
     memset(sizes, 0, sizeof(int) * nVars * 2);
 
@@ -1981,7 +2009,7 @@ inline void BIG::create(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec< Ri
 
 inline void BIG::recreate(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec< Riss::CRef >& list)
 {
-    duringCreationVariables = nVars; // memorize the number of present variables
+    startConstruction(nVars);
     sizes = sizes == 0 ? (int*) malloc(sizeof(int) * nVars * 2) : (int*) realloc(sizes, sizeof(int) * nVars * 2);
     memset(sizes, 0, sizeof(int) * nVars * 2);
 
@@ -2024,7 +2052,7 @@ inline void BIG::recreate(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec<
 
 inline void BIG::recreate(Riss::ClauseAllocator& ca, uint32_t nVars, Riss::vec< Riss::CRef >& list1, Riss::vec< Riss::CRef >& list2)
 {
-    duringCreationVariables = nVars; // memorize the number of present variables
+    startConstruction(nVars);
     sizes = sizes == 0 ? (int*) malloc(sizeof(int) * nVars * 2) : (int*) realloc(sizes, sizeof(int) * nVars * 2);
     memset(sizes, 0, sizeof(int) * nVars * 2);
 
@@ -2202,6 +2230,7 @@ inline void BIG::generateImplied(CoprocessorData& data)
     for (uint32_t i = 0 ; i < ts2; ++ i) {
         stamp = stampLiteral(data.lits[i], stamp, index, stampQueue);
     }
+    lastStamp = stamp;
     free(index);
 }
 
@@ -2257,6 +2286,107 @@ inline void BIG::generateImplied(uint32_t nVars, Riss::vec<Riss::Lit>& tmpLits)
     for (uint32_t i = 0 ; i < ts2; ++ i) {
         stamp = stampLiteral(tmpLits[i], stamp, index, stampQueue);
     }
+    lastStamp = stamp;
+
+    tmpLits.clear(); // clean up
+    free(index);
+}
+
+inline void BIG::addEdge(const Riss::Lit& l0, const Riss::Lit& l1)
+{
+    if (var(l0) >= duringCreationVariables || var(l1) >= duringCreationVariables) { return; }   // the next construction takes care of these
+    pendingEdges.push_back(l0);
+    pendingEdges.push_back(l1);
+}
+
+inline void BIG::integratePendingEdges(uint32_t nVars, Riss::vec<Riss::Lit>& tmpLits)
+{
+    if (pendingEdges.empty()) { return; }
+    const uint32_t lits = 2 * duringCreationVariables;
+
+    // copy the current lists into a new storage, that has space for the new edges
+    int* newSizes = (int*) malloc(sizeof(int) * lits);
+    uint64_t sum = 0;
+    for (uint32_t i = 0 ; i < lits; ++ i) { newSizes[i] = sizes[i]; sum += sizes[i]; }
+    for (size_t i = 0 ; i < pendingEdges.size(); ++ i) { newSizes[ Riss::toInt(~pendingEdges[i]) ] ++; sum ++; }
+    Riss::Lit* newStorage = (Riss::Lit*) malloc(sizeof(Riss::Lit) * (sum == 0 ? 1 : sum));
+    sum = 0;
+    for (uint32_t i = 0 ; i < lits; ++ i) {
+        if (sizes[i] > 0) { memcpy(newStorage + sum, big[i], sizeof(Riss::Lit) * sizes[i]); }
+        big[i] = newStorage + sum;
+        sum += newSizes[i];
+    }
+    free(storage);
+    free(newSizes);
+    storage = newStorage;
+
+    // add the edges, and remove duplicates in the lists that have been touched
+    for (size_t i = 0 ; i < pendingEdges.size(); i += 2) {
+        const Riss::Lit l0 = pendingEdges[i], l1 = pendingEdges[i + 1];
+        big[ Riss::toInt(~l0) ][ sizes[ Riss::toInt(~l0) ] ++ ] = l1;
+        big[ Riss::toInt(~l1) ][ sizes[ Riss::toInt(~l1) ] ++ ] = l0;
+    }
+    for (size_t i = 0 ; i < pendingEdges.size(); ++ i) {
+        const Riss::Lit l = ~pendingEdges[i];
+        if (getSize(l) < 2) { continue; }
+        Riss::sort(getArray(l), getSize(l));
+        int j = 0;
+        for (int k = 1; k < getSize(l); ++k) {
+            if (getArray(l)[k] != getArray(l)[j]) { getArray(l)[++j] = getArray(l)[k]; }
+        }
+        sizes[ Riss::toInt(l) ] = j + 1;
+    }
+
+    const uint32_t maxVar = duringCreationVariables < nVars ? duringCreationVariables : nVars; // use only known variables
+    if (start == 0 || stop == 0 || maxVar < duringCreationVariables) { pendingEdges.clear(); return; }  // there are no stamps that could be updated
+    if (lastStamp > UINT32_MAX - 2 * lits) { pendingEdges.clear(); generateImplied(nVars, tmpLits); return; }  // stamps could overflow
+
+    // collect the connected components of the new edges, edges are followed in both directions
+    std::vector<char> seen(lits, 0);
+    std::vector<Riss::Lit> component;
+    for (size_t i = 0 ; i < pendingEdges.size(); ++ i) {
+        for (int p = 0 ; p < 2; ++ p) {
+            const Riss::Lit l = p == 0 ? pendingEdges[i] : ~pendingEdges[i];
+            if (seen[ Riss::toInt(l) ]) { continue; }
+            seen[ Riss::toInt(l) ] = 1;
+            const size_t first = component.size();
+            component.push_back(l);
+            for (size_t k = first ; k < component.size(); ++ k) {
+                const Riss::Lit c = component[k];
+                for (int s = 0 ; s < 2; ++ s) {   // successors of c, and complements of the successors of ~c (which are the predecessors of c)
+                    const Riss::Lit source = s == 0 ? c : ~c;
+                    for (int j = 0 ; j < getSize(source); ++ j) {
+                        const Riss::Lit next = s == 0 ? getArray(source)[j] : ~getArray(source)[j];
+                        if (!seen[ Riss::toInt(next) ]) { seen[ Riss::toInt(next) ] = 1; component.push_back(next); }
+                    }
+                }
+            }
+        }
+    }
+    pendingEdges.clear();
+
+    // stamp the components again, with stamps that are larger than all stamps of the other components
+    int32_t* index = (int32_t*)malloc(lits * sizeof(int32_t));
+    for (size_t i = 0 ; i < component.size(); ++ i) {
+        start[ Riss::toInt(component[i]) ] = 0;
+        stop[ Riss::toInt(component[i]) ] = 0;
+        index[ Riss::toInt(component[i]) ] = 0;
+    }
+    std::deque< Riss::Lit > stampQueue;
+    uint32_t stamp = lastStamp;
+    for (int round = 0 ; round < 2; ++ round) {   // stamp roots first, afterwards all remaining literals
+        tmpLits.clear();
+        for (size_t i = 0 ; i < component.size(); ++ i) {
+            const Riss::Lit l = component[i];
+            if (start[ Riss::toInt(l) ] == 0 && (round == 1 || getSize(~l) == 0)) { tmpLits.push(l); }
+        }
+        const uint32_t ts = tmpLits.size();
+        for (uint32_t i = 0 ; i < ts; i++) { const uint32_t rnd = rand() % ts; const Riss::Lit tmp = tmpLits[i]; tmpLits[i] = tmpLits[rnd]; tmpLits[rnd] = tmp; }
+        for (uint32_t i = 0 ; i < ts; ++ i) {
+            stamp = stampLiteral(tmpLits[i], stamp, index, stampQueue);
+        }
+    }
+    lastStamp = stamp;
 
     tmpLits.clear(); // clean up
     free(index);
@@ -0,0 +1,128 @@
+/***************************************************************************[InprocessScheduler.cc]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#include "coprocessor/InprocessScheduler.h"
+#include "coprocessor/TechniqueProfiler.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace std;
+
+namespace Coprocessor
+{
+
+InprocessScheduler::InprocessScheduler(const char* letters, double _share, double _decay)
+    : share(_share)
+    , decay(_decay)
+    , lastAccount(-1)
+    , rounds(0)
+    , current(-1)
+    , startTime(0)
+    , clausesBefore(0)
+    , literalsBefore(0)
+{
+    for (const char* l = letters; l != 0 && *l != 0; ++ l) {
+        if (find(*l) == -1) { techniques.push_back(Technique(*l)); }
+    }
+}
+
+int InprocessScheduler::find(char letter) const
+{
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        if (techniques[i].letter == letter) { return i; }
+    }
+    return -1;
+}
+
+bool InprocessScheduler::due(double now)
+{
+    if (techniques.empty()) { return false; }
+    if (lastAccount < 0) { lastAccount = now; }   // the first call, search time is counted from here
+    const double budget = share * max(0.0, now - lastAccount);
+    lastAccount = now;
+
+    // techniques that have not been called yet get the weight of the best technique, and no technique gets less
+    // than a small fraction of it, so that its payoff is measured again from time to time
+    double maxPayoff = 0;
+    for (size_t i = 0 ; i < techniques.size(); ++ i) { maxPayoff = max(maxPayoff, techniques[i].payoff); }
+    const double minWeight = 0.05 * max(maxPayoff, 1.0);
+    double weights = 0;
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        weights += techniques[i].calls == 0 ? max(maxPayoff, 1.0) : max(techniques[i].payoff, minWeight);
+    }
+
+    bool runnable = false;
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        Technique& t = techniques[i];
+        const double weight = t.calls == 0 ? max(maxPayoff, 1.0) : max(t.payoff, minWeight);
+        t.credit = min(t.credit + budget * weight / weights, 2 * t.cost + budget);   // do not save credit for many rounds
+        runnable = runnable || t.credit >= t.cost;
+    }
+    return runnable;
+}
+
+string InprocessScheduler::select() const
+{
+    string letters;
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        if (techniques[i].credit >= techniques[i].cost) { letters += techniques[i].letter; }
+    }
+    return letters;
+}
+
+void InprocessScheduler::start(char letter, double now, int64_t clauses, int64_t literals)
+{
+    assert(current == -1 && "cannot measure two techniques at the same time");
+    current = find(letter);
+    startTime = now;
+    clausesBefore = clauses;
+    literalsBefore = literals;
+}
+
+void InprocessScheduler::stop(double now, int64_t clauses, int64_t literals)
+{
+    if (current == -1) { return; }
+    Technique& t = techniques[current];
+    current = -1;
+
+    // removed literals count as the fraction of an average clause, so that strengthening pays off as well
+    const double seconds = max(now - startTime, 0.0);
+    const double averageSize = clausesBefore == 0 ? 1 : (double)literalsBefore / clausesBefore;
+    const double removed = max(0.0, max((double)(clausesBefore - clauses), (literalsBefore - literals) / averageSize));
+    const double payoff = removed / max(seconds, 0.001);
+
+    t.payoff = t.calls == 0 ? payoff : decay * t.payoff + (1 - decay) * payoff;
+    t.cost = t.calls == 0 ? seconds : decay * t.cost + (1 - decay) * seconds;
+    t.credit -= seconds;
+    t.time += seconds;
+    t.removedClauses += clausesBefore - clauses;
+    t.removedLiterals += literalsBefore - literals;
+    t.calls ++;
+}
+
+void InprocessScheduler::finishRound(double now)
+{
+    rounds ++;
+    lastAccount = now;
+}
+
+void InprocessScheduler::printStatistics(ostream& stream) const
+{
+    stream << "c [STAT] ISCHED " << rounds << " rounds, " << share << " share" << endl;
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        const Technique& t = techniques[i];
+        stream << "c [STAT] ISCHED(" << t.letter << ") "
+               << TechniqueProfiler::techniqueName(t.letter) << ", "
+               << t.calls << " calls, "
+               << t.time << " s, "
+               << t.removedClauses << " rem-cls, "
+               << t.removedLiterals << " rem-lits, "
+               << t.payoff << " payoff, "
+               << t.credit << " s-credit, "
+               << endl;
+    }
+}
+
+}
@@ -0,0 +1,93 @@
+/****************************************************************************[InprocessScheduler.h]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#ifndef RISS_INPROCESSSCHEDULER_HH
+#define RISS_INPROCESSSCHEDULER_HH
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Coprocessor
+{
+
+/** decide which simplification techniques are run during inprocessing, based on their payoff in previous rounds
+ *
+ *  Techniques are identified by their letter in the cp3_itechs grammar. The wall clock time spent in search since
+ *  the last round is turned into credit, a fixed share of it is distributed among the techniques in proportion to
+ *  their payoff (removed clauses per second). A technique runs once its credit covers its expected cost, and pays
+ *  the time it used from its credit. Hence, inprocessing takes a bounded share of the run time, and techniques that
+ *  do not pay off are run less frequently, but are never disabled completely.
+ */
+class InprocessScheduler
+{
+  public:
+
+    /** state of a single technique */
+    struct Technique {
+        char letter;          // letter of the technique
+        int calls;            // number of calls so far
+        double credit;        // seconds the technique is allowed to use
+        double cost;          // decayed seconds per call
+        double payoff;        // decayed removed clauses per second, negative if the technique has not been called yet
+        double time;          // seconds used in all calls
+        int64_t removedClauses, removedLiterals; // removed in all calls
+        Technique(char _letter) : letter(_letter), calls(0), credit(0), cost(0), payoff(-1), time(0), removedClauses(0), removedLiterals(0) {}
+    };
+
+  private:
+
+    std::vector<Technique> techniques; // techniques to choose from, in the order they should be executed
+    double share;                      // fraction of the search time that is distributed as credit
+    double decay;                      // weight of the previous payoff and cost, when a new call is measured
+    double lastAccount;                // wall clock time, when the search time has been turned into credit last time
+    int rounds;                        // number of rounds with at least one technique
+
+    int current;                       // index of the technique that is currently measured, -1 if there is none
+    double startTime;                  // wall clock time, when the current call started
+    int64_t clausesBefore, literalsBefore; // size of the formula, when the current call started
+
+    /** index of the technique with the given letter, -1 if there is no such technique */
+    int find(char letter) const;
+
+  public:
+
+    /**
+     * @param letters techniques to schedule, in the order they should be executed
+     * @param _share fraction of the search time that should be used for inprocessing
+     * @param _decay weight of older measurements in the payoff and cost of a technique
+     */
+    InprocessScheduler(const char* letters, double _share, double _decay);
+
+    /** turn the time since the last round into credit of the techniques
+     * @return true, if at least one technique has enough credit to be run
+     */
+    bool due(double now);
+
+    /** letters of the techniques with enough credit, in execution order, empty if there is no such technique */
+    std::string select() const;
+
+    /** start measuring a call of the given technique, ignored for techniques that are not scheduled
+     * @param clauses,literals size of the formula, the payoff is based on its reduction until stop
+     */
+    void start(char letter, double now, int64_t clauses, int64_t literals);
+
+    /** finish measuring the call, update payoff and cost, and pay the used time from the credit */
+    void stop(double now, int64_t clauses, int64_t literals);
+
+    /** the round is finished, the time until the next call of due is search time */
+    void finishRound(double now);
+
+    /** return true, if the technique with the given letter is scheduled */
+    bool schedules(char letter) const { return find(letter) != -1; }
+
+    const std::vector<Technique>& getTechniques() const { return techniques; }
+
+    void printStatistics(std::ostream& stream) const;
+};
+
+}
+
+#endif
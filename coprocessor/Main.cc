@@ -76,16 +76,18 @@ int main(int argc, char** argv)
         IntOption    verb("MAIN", "verb",   "Verbosity level (0=silent, 1=some, 2=more).", 1, IntRange(0, 2));
         BoolOption   pre("MAIN", "pre",    "Completely turn on/off any preprocessing.", true);
         StringOption dimacs("MAIN", "dimacs", "If given, stop after preprocessing and write the result to this file.");
+        StringOption bcnf("MAIN", "bcnf", "If given, write the result, undo information and variable map to this file in binary CNF format.");
         IntOption    cpu_lim("MAIN", "cpu-lim", "Limit on CPU time allowed in seconds.\n", INT32_MAX, IntRange(0, INT32_MAX));
         IntOption    mem_lim("MAIN", "mem-lim", "Limit on memory usage in megabytes.\n", INT32_MAX, IntRange(0, INT32_MAX));
         StringOption opt_config("MAIN", "config", "Use a preset configuration", "505");
+        IntOption    opt_parseThreads("MAIN", "parseThreads", "Threads to parse uncompressed input files (0=all cores, -1=stream parser only)", 0, IntRange(-1, 256));
         BoolOption   opt_cmdLine("MAIN", "cmd", "print the relevant options", false);
 
         StringOption drupFile("PROOF", "drup", "Write a proof trace into the given file", 0);
         StringOption opt_proofFormat("PROOF", "proofFormat", "Do print the proof format (print o line with the given format, should be DRUP)", "DRUP");
 
         const char* _cat = "COPROCESSOR 3";
-        StringOption undoFile(_cat, "undo",   "write information about undoing simplifications into given file (and var map into X.map file)");
+        StringOption undoFile(_cat, "undo",   "write information about undoing simplifications into given file (and var map into X.map file), a -bcnf file can be read as well");
         BoolOption   post(_cat, "post",   "perform post processing", false);
         StringOption modelFile(_cat, "model",  "read model from SAT solver from this file");
         IntOption    opt_search(_cat, "search", "perform search until the given number of conflicts", 1, IntRange(0, INT32_MAX));
@@ -170,7 +172,7 @@ int main(int argc, char** argv)
             S.proofFile = (drupFile) ? fopen((const char*) drupFile, "wb") : nullptr;
             if (opt_proofFormat && strlen(opt_proofFormat) > 0 &&  S.proofFile != nullptr) { fprintf(S.proofFile, "o proof %s\n", (const char*)opt_proofFormat); }    // we are writing proofs of the given format!
 
-            parse_DIMACS(in, S);
+            parse_DIMACS(argc == 1 ? nullptr : argv[1], in, S, opt_parseThreads);
             gzclose(in);
 
             if (S.verbosity > 0) {
@@ -208,6 +210,13 @@ int main(int argc, char** argv)
                 preprocessor.outputFormula((const char*) dimacs);
             }
 
+            if (bcnf) {
+                if (S.verbosity > 0) {
+                    printf("c ============================[ Writing Binary CNF ]=======================================================\n");
+                }
+                preprocessor.writeBinaryFormula(string(bcnf));
+            }
+
             if ((const char*)undoFile != 0) {
                 if (S.verbosity > 0) {
                     printf("c =============================[ Writing Undo Info ]=======================================================\n");
@@ -0,0 +1,329 @@
+/*******************************************************************************[OccurrenceLists.h]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#ifndef RISS_OCCURRENCELISTS_H
+#define RISS_OCCURRENCELISTS_H
+
+#include "riss/core/SolverTypes.h"
+#include "riss/utils/LockCollection.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace Coprocessor
+{
+
+class OccArena;
+
+/** list of clause references of a single literal, stored as a segment of an OccArena
+ *
+ *  The list behaves like a std::vector<CRef> for all operations that are used on occurrence lists. Pointers into
+ *  a list stay valid until this list grows beyond its capacity or the arena is compacted, like for std::vector.
+ *  Lists cannot be copied (they would share a segment), use the explicit conversion to std::vector<CRef> instead.
+ */
+class OccList
+{
+    Riss::CRef* elements;  // segment in the arena
+    uint32_t sz;           // number of elements in the list
+    uint32_t cap;          // size of the segment
+    OccArena* arena;       // arena that owns the segment
+
+    friend class OccArena;
+    friend class OccurrenceLists;
+
+    /** move the list into a larger segment */
+    void grow(uint32_t minCapacity);
+
+  public:
+    typedef Riss::CRef value_type;
+    typedef Riss::CRef* iterator;
+    typedef const Riss::CRef* const_iterator;
+
+    OccList() : elements(0), sz(0), cap(0), arena(0) {}
+    OccList(OccList&& other) noexcept : elements(other.elements), sz(other.sz), cap(other.cap), arena(other.arena)
+    {
+        other.elements = 0; other.sz = 0; other.cap = 0;
+    }
+    OccList& operator=(OccList&& other) noexcept
+    {
+        std::swap(elements, other.elements); std::swap(sz, other.sz); std::swap(cap, other.cap); std::swap(arena, other.arena);
+        return *this;
+    }
+    OccList(const OccList&) = delete;
+    OccList& operator=(const OccList&) = delete;
+
+    int size() const { return sz; }
+    bool empty() const { return sz == 0; }
+    uint32_t capacity() const { return cap; }
+
+    Riss::CRef& operator[](int index)             { assert(index < (int)sz && "index out of bounds"); return elements[index]; }
+    const Riss::CRef& operator[](int index) const { assert(index < (int)sz && "index out of bounds"); return elements[index]; }
+    Riss::CRef& back()             { assert(sz > 0 && "list is empty"); return elements[sz - 1]; }
+    const Riss::CRef& back() const { assert(sz > 0 && "list is empty"); return elements[sz - 1]; }
+
+    iterator begin()             { return elements; }
+    iterator end()               { return elements + sz; }
+    const_iterator begin() const { return elements; }
+    const_iterator end()   const { return elements + sz; }
+
+    void push_back(const Riss::CRef& cr)
+    {
+        if (sz == cap) {
+            const Riss::CRef copy = cr; // cr might be an element of this list
+            grow(sz + 1);
+            elements[sz++] = copy;
+        } else { elements[sz++] = cr; }
+    }
+
+    void pop_back() { assert(sz > 0 && "cannot pop from an empty list"); --sz; }
+
+    /** remove all elements, keep the segment */
+    void clear() { sz = 0; }
+
+    /** remove all elements, and give the segment back to the arena */
+    void release();
+
+    void resize(int newSize, const Riss::CRef& fill = Riss::CRef_Undef)
+    {
+        if (newSize > (int)cap) { grow(newSize); }
+        for (int i = sz; i < newSize; ++ i) { elements[i] = fill; }
+        sz = newSize;
+    }
+
+    /** exchange the content of two lists of the same arena */
+    void swap(OccList& other)
+    {
+        std::swap(elements, other.elements); std::swap(sz, other.sz); std::swap(cap, other.cap); std::swap(arena, other.arena);
+    }
+
+    friend std::ostream& operator<<(std::ostream& other, const OccList& list)
+    {
+        for (int i = 0 ; i < list.size(); ++ i) { other << " " << list[i]; }
+        return other;
+    }
+
+    /** copy the content into a std::vector */
+    explicit operator std::vector<Riss::CRef>() const { return std::vector<Riss::CRef>(begin(), end()); }
+};
+
+/** memory for the segments of all occurrence lists
+ *
+ *  Memory is taken from large blocks, that are never moved, so that lists can grow concurrently. Segments have a
+ *  power of two size, released segments are reused for lists of the same size class. Compacting the arena copies
+ *  all lists into a single block, one list after the other (compressed sparse row form), with a little slack per
+ *  list, so that a few additions do not move a list immediately.
+ */
+class OccArena
+{
+    std::vector<Riss::CRef*> blocks;                      // all memory of the arena
+    std::vector<uint64_t> blockSizes;                     // number of elements per block
+    Riss::CRef* head;                                     // next free element in the last block
+    uint64_t headFree;                                    // free elements behind head
+    std::vector< std::vector<Riss::CRef*> > freeSegments; // released segments, per size class
+    SpinLock lock;                                        // lists can grow in parallel techniques
+
+    uint64_t totalElements;                               // elements in all blocks
+    uint64_t releasedElements;                            // elements in released segments and unused block ends
+    uint64_t peakElements;                                // most elements in all blocks since the peak has been reset
+
+    friend class OccurrenceLists;
+
+    static const uint64_t defaultBlockSize = 1 << 20;
+
+    static int sizeClass(uint32_t capacity)
+    {
+        int c = 0;
+        while ((2u << c) <= capacity) { ++ c; }
+        return c;
+    }
+
+    void addBlock(uint64_t elements)
+    {
+        releasedElements += headFree;   // the remaining part of the previous block cannot be used any more
+        blocks.push_back(new Riss::CRef [ elements ]);
+        blockSizes.push_back(elements);
+        head = blocks.back();
+        headFree = elements;
+        totalElements += elements;
+        if (totalElements > peakElements) { peakElements = totalElements; }
+    }
+
+  public:
+    OccArena() : head(0), headFree(0), totalElements(0), releasedElements(0), peakElements(0) {}
+    ~OccArena() { clear(); }
+
+    /** free all memory, all segments become invalid (the peak is kept) */
+    void clear()
+    {
+        for (size_t i = 0 ; i < blocks.size(); ++ i) { delete [] blocks[i]; }
+        blocks.clear();
+        blockSizes.clear();
+        freeSegments.clear();
+        head = 0;
+        headFree = 0;
+        totalElements = 0;
+        releasedElements = 0;
+    }
+
+    /** return a segment with at least the given capacity, the capacity is updated to the size of the segment */
+    Riss::CRef* allocate(uint32_t& capacity)
+    {
+        uint32_t segment = 4;
+        while (segment < capacity) { segment *= 2; }
+        capacity = segment;
+        const int c = sizeClass(segment);
+
+        lock.lock();
+        Riss::CRef* memory = 0;
+        if (c < (int)freeSegments.size() && !freeSegments[c].empty()) {
+            memory = freeSegments[c].back();
+            freeSegments[c].pop_back();
+            releasedElements -= segment;
+        } else {
+            if (headFree < segment) { addBlock(segment > defaultBlockSize ? segment : defaultBlockSize); }
+            memory = head;
+            head += segment;
+            headFree -= segment;
+        }
+        lock.unlock();
+        return memory;
+    }
+
+    /** give a segment back to the arena, so that it can be reused */
+    void release(Riss::CRef* memory, uint32_t capacity)
+    {
+        if (memory == 0 || capacity < 4) { return; }
+        const int c = sizeClass(capacity);   // segments of compacted lists might be larger than their class
+        lock.lock();
+        if (c >= (int)freeSegments.size()) { freeSegments.resize(c + 1); }
+        freeSegments[c].push_back(memory);
+        releasedElements += (1u << c);
+        lock.unlock();
+    }
+
+    /** number of bytes that are allocated by the arena */
+    uint64_t bytes() const { return totalElements * sizeof(Riss::CRef); }
+
+    /** number of bytes in released segments and unusable block ends */
+    uint64_t releasedBytes() const { return releasedElements * sizeof(Riss::CRef); }
+};
+
+inline void OccList::grow(uint32_t minCapacity)
+{
+    assert(arena != 0 && "list has to belong to an arena");
+    uint32_t newCapacity = cap * 2 > minCapacity ? cap * 2 : minCapacity;
+    Riss::CRef* memory = arena->allocate(newCapacity);
+    if (sz > 0) { memcpy(memory, elements, sizeof(Riss::CRef) * sz); }
+    arena->release(elements, cap);
+    elements = memory;
+    cap = newCapacity;
+}
+
+inline void OccList::release()
+{
+    if (arena != 0) { arena->release(elements, cap); }
+    elements = 0;
+    sz = 0;
+    cap = 0;
+}
+
+/** occurrence lists for all literals, indexed by the integer value of the literal */
+class OccurrenceLists
+{
+    OccArena arena;
+    std::vector<OccList> lists;
+    uint64_t compactions;   // number of compactions so far
+    uint64_t peakHeaders;   // most bytes of list headers since the peak has been reset
+
+  public:
+    OccurrenceLists() : compactions(0), peakHeaders(0) {}
+
+    OccList& operator[](int index)             { return lists[index]; }
+    const OccList& operator[](int index) const { return lists[index]; }
+    int size() const { return lists.size(); }
+
+    void resize(int newSize)
+    {
+        for (int i = newSize; i < (int)lists.size(); ++ i) {
+            arena.release(lists[i].elements, lists[i].cap);
+            lists[i].elements = 0; lists[i].sz = 0; lists[i].cap = 0;
+        }
+        const int oldSize = lists.size();
+        lists.resize(newSize);
+        for (int i = oldSize; i < newSize; ++ i) { lists[i].arena = &arena; }
+        if (lists.capacity() * sizeof(OccList) > peakHeaders) { peakHeaders = lists.capacity() * sizeof(OccList); }
+    }
+
+    /** free all memory */
+    void clear()
+    {
+        lists.clear();
+        arena.clear();
+    }
+
+    /** number of clause references that are stored in all lists */
+    uint64_t elements() const
+    {
+        uint64_t count = 0;
+        for (size_t i = 0 ; i < lists.size(); ++ i) { count += lists[i].sz; }
+        return count;
+    }
+
+    /** copy all lists one after the other into a single block, keep size/8 slack per list */
+    void compact()
+    {
+        uint64_t needed = 0;
+        for (size_t i = 0 ; i < lists.size(); ++ i) { needed += lists[i].sz == 0 ? 0 : lists[i].sz + (lists[i].sz >> 3) + 1; }
+
+        Riss::CRef* block = needed == 0 ? 0 : new Riss::CRef [ needed ];
+        Riss::CRef* pos = block;
+        for (size_t i = 0 ; i < lists.size(); ++ i) {
+            OccList& list = lists[i];
+            if (list.sz == 0) { list.elements = 0; list.cap = 0; continue; }
+            memcpy(pos, list.elements, sizeof(Riss::CRef) * list.sz);
+            list.elements = pos;
+            list.cap = list.sz + (list.sz >> 3) + 1;
+            pos += list.cap;
+        }
+
+        if (arena.totalElements + needed > arena.peakElements) { arena.peakElements = arena.totalElements + needed; } // both copies exist for a moment
+        arena.clear();
+        if (block != 0) {
+            arena.blocks.push_back(block);
+            arena.blockSizes.push_back(needed);
+            arena.totalElements = needed;
+        }
+        compactions ++;
+    }
+
+    /** compact the lists, if more than the given fraction of the arena is not used by any list */
+    void checkCompact(double fraction)
+    {
+        const uint64_t used = elements();
+        if (arena.totalElements > 0 && (double)(arena.totalElements - used) > arena.totalElements * fraction) { compact(); }
+    }
+
+    /** memory of all lists in bytes, including the list headers */
+    uint64_t bytes() const { return arena.bytes() + lists.capacity() * sizeof(OccList); }
+
+    /** most memory of all lists in bytes since the last call to resetPeak, including the list headers */
+    uint64_t peakBytes() const { return arena.peakElements * sizeof(Riss::CRef) + peakHeaders; }
+
+    /** start tracking the peak memory from the current memory */
+    void resetPeak()
+    {
+        arena.peakElements = arena.totalElements;
+        peakHeaders = lists.capacity() * sizeof(OccList);
+    }
+
+    /** memory in bytes that is required to store the elements of all lists */
+    uint64_t usedBytes() const { return elements() * sizeof(Riss::CRef); }
+
+    uint64_t getCompactions() const { return compactions; }
+};
+
+} // namespace Coprocessor
+
+#endif
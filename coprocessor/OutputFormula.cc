@@ -3,6 +3,7 @@ Copyright (c) 2012, Kilian Gebhardt, Norbert Manthey, LGPL v2, see LICENSE
 **************************************************************************************************/
 
 #include "coprocessor/Coprocessor.h"
+#include "riss/utils/BinaryCNF.h"
 #include <stdio.h>
 
 #include <sstream>
@@ -246,6 +247,7 @@ int Preprocessor::parseModel(const string& filename)
 
 bool Preprocessor::parseUndoInfo(const string& filename)
 {
+    if (BinaryCNF::isBinaryCNFFile(filename)) { return parseBinaryUndoInfo(filename); }
 
     vector<Lit> literals;
     string line;
@@ -344,4 +346,77 @@ bool Preprocessor::writeUndoInfo(const string& filename, int originalVariables)
     return dense.writeCompressionMap(filename + ".map");
 }
 
+bool Preprocessor::parseBinaryUndoInfo(const string& filename)
+{
+    BinaryCNF formula;
+    if (!formula.read(filename)) { return false; }
+
+    formulaVariables = formula.formulaVariables;
+
+    vector<Lit> literals;
+    for (size_t i = 0 ; i < formula.undo.size(); ++ i) {
+        if (formula.undo[i] != lit_Undef) { literals.push_back(formula.undo[i]); continue; }
+        if (literals.size() == 0) {
+            cerr << "c ERROR: empty clause in undo information of " << filename << endl;
+            return false;
+        }
+        data.addToExtension(literals, literals[0]);
+        literals.clear();
+    }
+
+    if (formula.mapping.size() > 0) {   // same as reading the map file of Dense
+        data.getCompression().reset();
+        data.getCompression().update(formula.mapping, formula.trail);
+    }
+
+    return true;
+}
+
+bool Preprocessor::writeBinaryFormula(const string& filename, int originalVariables)
+{
+    assert(solver->decisionLevel() == 0 && "cannot write binary formula during search!");
+
+    BinaryCNF formula;
+
+    // formula, as in printFormula
+    if (!data.ok()) {   // unsat
+        formula.clauses.push_back(lit_Undef);   // the empty clause
+    } else {
+        formula.vars = solver->nVars();
+        vec<Lit>& trail = solver->trail;
+        for (int i = 0; i < trail.size(); ++i) {
+            if ((solver->level)(var(trail[i])) == 0) { formula.addClause(&trail[i], 1); }
+        }
+        vec<CRef>& clauses = solver->clauses;
+        for (int i = 0; i < clauses.size(); ++i) {
+            const Clause& c = solver->ca[clauses[i]];
+            if (c.can_be_deleted() || c.mark()) { continue; }
+            formula.addClause(c, c.size());
+        }
+    }
+
+    // undo information, as in writeUndoInfo
+    formula.formulaVariables = (originalVariables == -1 || (formulaVariables < originalVariables)) ? formulaVariables : originalVariables;
+    const vector<Lit>& undo = data.getUndo();
+    assert((undo.size() == 0 || undo[0] == lit_Undef) && "first undo symbol has to be a lit_Undef");
+    if (undo.size() > 1) {
+        formula.undo.assign(undo.begin() + 1, undo.end());    // drop the leading separator, and terminate the last clause
+        formula.undo.push_back(lit_Undef);
+    }
+    const Compression& compression = data.getCompression();
+    for (int i = 0; i < solver->trail.size(); ++ i) {
+        formula.undo.push_back(compression.exportLit(solver->trail[i]));
+        formula.undo.push_back(lit_Undef);
+    }
+
+    // variable map, as in Compression::serialize
+    for (Var v = 0 ; v < (Var)compression.nvars(); ++ v) {
+        formula.mapping.push_back(compression.importVar(v));
+        formula.trail.push_back(compression.value(v));
+    }
+
+    cerr << "c write binary formula with " << formula.vars << " variables, and undo information for " << formula.undo.size() << " literals" << endl;
+    return formula.write(filename);
+}
+
 } // namespace Coprocessor
@@ -141,6 +141,11 @@ class Technique
     /** per call to the inprocess method of the preprocessor, allow a technique to have this number more steps */
     void giveMoreSteps();
 
+    /** report the steps used so far and the current step limit, both are -1 if the technique does not count steps
+     *  This method should be overwritten by all techniques that control their run time with a step limit
+     */
+    void getStepUsage(int64_t& steps, int64_t& limit) const { steps = -1; limit = -1; }
+
   protected:
 
     /** reset counter, so that complete propagation is executed next time
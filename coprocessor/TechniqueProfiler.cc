@@ -0,0 +1,143 @@
+/****************************************************************************[TechniqueProfiler.cc]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#include "coprocessor/TechniqueProfiler.h"
+
+#include <cstdio>
+#include <iostream>
+
+using namespace std;
+using namespace Riss;
+
+namespace Coprocessor
+{
+
+TechniqueProfiler::TechniqueProfiler(const char* _filename)
+    : filename(_filename == 0 ? "" : _filename)
+    , calls(256, 0)
+    , running(false)
+    , stepsBefore(-1)
+    , arenaBefore(0)
+    , occBefore(0)
+{}
+
+void TechniqueProfiler::countFormula(CoprocessorData& data, ClauseAllocator& ca, int64_t& clauses, int64_t& literals) const
+{
+    clauses = 0;
+    literals = 0;
+    for (int p = 0 ; p < 2; ++ p) {
+        const vec<CRef>& list = p == 0 ? data.getClauses() : data.getLEarnts();
+        for (int i = 0 ; i < list.size(); ++ i) {
+            const Clause& c = ca[ list[i] ];
+            if (c.can_be_deleted()) { continue; }
+            clauses ++;
+            literals += c.size();
+        }
+    }
+}
+
+void TechniqueProfiler::start(char technique, CoprocessorData& data, ClauseAllocator& ca, int64_t steps, int64_t limit)
+{
+    if (!enabled()) { return; }
+    assert(!running && "cannot measure two techniques at the same time");
+
+    current = Measurement();
+    current.technique = technique;
+    current.call = ++ calls[(unsigned char)technique];
+    current.inprocessing = data.isInprocessing();
+    current.budget = (steps < 0 || limit < 0) ? -1 : limit - steps;
+    countFormula(data, ca, current.clausesBefore, current.literalsBefore);
+
+    stepsBefore = steps;
+    arenaBefore = (int64_t)ca.size() * ClauseAllocator::Unit_Size;
+    occBefore = data.getOccurrences().bytes();
+    data.resetOccurrencePeak();
+    current.wallTime = wallClockTime();
+    current.cpuTime = cpuTime();
+    running = true;
+}
+
+void TechniqueProfiler::stop(CoprocessorData& data, ClauseAllocator& ca, int64_t steps)
+{
+    if (!running) { return; }
+    current.wallTime = wallClockTime() - current.wallTime;
+    current.cpuTime = cpuTime() - current.cpuTime;
+    current.steps = (steps < 0 || stepsBefore < 0) ? -1 : steps - stepsBefore;
+    current.arenaGrowth = (int64_t)ca.size() * ClauseAllocator::Unit_Size - arenaBefore;
+    current.occGrowth = (int64_t)data.getOccurrences().peakBytes() - occBefore;   // lists are often freed before the call returns
+    countFormula(data, ca, current.clausesAfter, current.literalsAfter);
+    measurements.push_back(current);
+    running = false;
+}
+
+bool TechniqueProfiler::write() const
+{
+    if (!enabled()) { return true; }
+
+    FILE* f = fopen(filename.c_str(), "w");
+    if (f == nullptr) {
+        cerr << "c WARNING: could not open profile file " << filename << endl;
+        return false;
+    }
+
+    const bool json = filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+    if (json) { fprintf(f, "[\n"); }
+    else { fprintf(f, "technique,call,phase,wall,cpu,steps,budget,clauses_before,clauses_after,literals_before,literals_after,arena_growth,occ_growth\n"); }
+
+    for (size_t i = 0 ; i < measurements.size(); ++ i) {
+        const Measurement& m = measurements[i];
+        const char* phase = m.inprocessing ? "inprocessing" : "preprocessing";
+        if (json) {
+            fprintf(f, "  {\"technique\": \"%s\", \"call\": %d, \"phase\": \"%s\", \"wall\": %.6f, \"cpu\": %.6f, "
+                    "\"steps\": %lld, \"budget\": %lld, \"clauses_before\": %lld, \"clauses_after\": %lld, "
+                    "\"literals_before\": %lld, \"literals_after\": %lld, \"arena_growth\": %lld, \"occ_growth\": %lld}%s\n",
+                    techniqueName(m.technique), m.call, phase, m.wallTime, m.cpuTime,
+                    (long long)m.steps, (long long)m.budget, (long long)m.clausesBefore, (long long)m.clausesAfter,
+                    (long long)m.literalsBefore, (long long)m.literalsAfter, (long long)m.arenaGrowth, (long long)m.occGrowth,
+                    i + 1 < measurements.size() ? "," : "");
+        } else {
+            fprintf(f, "%s,%d,%s,%.6f,%.6f,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%lld\n",
+                    techniqueName(m.technique), m.call, phase, m.wallTime, m.cpuTime,
+                    (long long)m.steps, (long long)m.budget, (long long)m.clausesBefore, (long long)m.clausesAfter,
+                    (long long)m.literalsBefore, (long long)m.literalsAfter, (long long)m.arenaGrowth, (long long)m.occGrowth);
+        }
+    }
+    if (json) { fprintf(f, "]\n"); }
+
+    return fclose(f) == 0;
+}
+
+const char* TechniqueProfiler::techniqueName(char technique)
+{
+    switch (technique) {
+    case 'u': return "up";
+    case 's': return "subsimp";
+    case 'a': return "addRed2";
+    case '3': return "3resolve";
+    case 'x': return "xor";
+    case 'p': return "probe";
+    case 'g': return "unhide";
+    case 'w': return "bva";
+    case 'v': return "bve";
+    case 'e': return "ee";
+    case 'b': return "bce";
+    case 'l': return "la";
+    case '1': return "ent";
+    case 'c': return "cce";
+    case 't': return "rate";
+    case 'H': return "hbr";
+    case 'X': return "exp";
+    case 'm': return "modprep";
+    case 'h': return "hte";
+    case 'r': return "rew";
+    case 'f': return "fm";
+    case 'd': return "dense";
+    case 'S': return "sls";     // not part of the grammar, runs after the other techniques
+    case 'y': return "symm";    // not part of the grammar, runs before the other techniques
+    case 'V': return "vivi";    // vivification of the search, scheduled during inprocessing
+    default:  return "unknown";
+    }
+}
+
+}
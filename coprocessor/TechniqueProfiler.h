@@ -0,0 +1,86 @@
+/*****************************************************************************[TechniqueProfiler.h]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#ifndef RISS_TECHNIQUEPROFILER_HH
+#define RISS_TECHNIQUEPROFILER_HH
+
+#include <string>
+#include <vector>
+
+#include "riss/core/Solver.h"
+#include "coprocessor/CoprocessorTypes.h"
+
+namespace Coprocessor
+{
+
+/** collect time, steps and memory of each call to a simplification technique, and write them to a file
+ *
+ *  Techniques are identified by their letter in the cp3_ptechs grammar, SLS and symmetry breaking, which are not
+ *  part of the grammar, use 'S' and 'y'. The file is written as JSON, if its name ends with ".json", and as CSV
+ *  otherwise. It is rewritten after each simplification, so that it is complete even if the solver is killed during
+ *  search.
+ */
+class TechniqueProfiler
+{
+  public:
+
+    /** measurements of a single call of a technique */
+    struct Measurement {
+        char technique;          // letter of the technique
+        int call;                // number of calls of this technique so far, including this one
+        bool inprocessing;       // true, if the call happened during inprocessing
+        double wallTime;         // seconds wall clock time
+        double cpuTime;          // seconds cpu time
+        int64_t steps;           // steps used during the call, -1 if the technique does not count steps
+        int64_t budget;          // steps that have been left when the call started, -1 if unknown
+        int64_t clausesBefore, clausesAfter;   // clauses, including learnt clauses
+        int64_t literalsBefore, literalsAfter; // literals in these clauses
+        int64_t arenaGrowth;     // bytes the clause allocator grew during the call (before garbage collection)
+        int64_t occGrowth;       // bytes the occurrence lists grew during the call, at their peak
+        Measurement() : technique(0), call(0), inprocessing(false), wallTime(0), cpuTime(0), steps(-1), budget(-1),
+            clausesBefore(0), clausesAfter(0), literalsBefore(0), literalsAfter(0), arenaGrowth(0), occGrowth(0) {}
+    };
+
+  private:
+
+    std::string filename;                  // file to write to, empty if profiling is disabled
+    std::vector<Measurement> measurements; // all calls so far
+    std::vector<int> calls;                // calls per technique letter
+    Measurement current;                   // call that is currently measured
+    bool running;                          // a call is currently measured
+    int64_t stepsBefore;                   // step counter of the technique when the call started
+    int64_t arenaBefore, occBefore;        // memory when the call started
+
+    /** count clauses and literals of the formula, that are not marked as deleted */
+    void countFormula(CoprocessorData& data, Riss::ClauseAllocator& ca, int64_t& clauses, int64_t& literals) const;
+
+  public:
+
+    TechniqueProfiler(const char* _filename);
+
+    /** return true, if the calls of techniques should be measured */
+    bool enabled() const { return !filename.empty(); }
+
+    /** start measuring a call of the given technique
+     * @param steps,limit current step counter and step limit of the technique, -1 if it does not count steps
+     */
+    void start(char technique, CoprocessorData& data, Riss::ClauseAllocator& ca, int64_t steps, int64_t limit);
+
+    /** finish the measurement that has been started last */
+    void stop(CoprocessorData& data, Riss::ClauseAllocator& ca, int64_t steps);
+
+    /** write all measurements to the file
+     * @return false, if the file could not be written
+     */
+    bool write() const;
+
+    /** name of the option that enables the technique with the given letter */
+    static const char* techniqueName(char technique);
+
+    const std::vector<Measurement>& getMeasurements() const { return measurements; }
+};
+
+}
+
+#endif
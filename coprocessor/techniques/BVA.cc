@@ -396,7 +396,7 @@ bool BoundedVariableAddition::andBVA()
 
             assert(max <= data.list(left).size());
             const vector<CRef>& rightList = bvaMatchingClauses[ 0 ];
-            vector<CRef>& leftList = data.list(left);  // will be sorted below
+            OccList& leftList = data.list(left);  // will be sorted below
             uint32_t foundCurrentMatches = 0;
             // for each clause in Mcls, find matching clause in list of clauses with literal "left"
             for (uint32_t i = 0 ; i < rightList.size(); ++i) {
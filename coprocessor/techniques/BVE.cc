@@ -302,7 +302,7 @@ static void printLitVec(const vec<Lit>& litvec)
 
 }
 
-static void printClauses(ClauseAllocator& ca, vector<CRef>& list, bool skipDeleted)
+static void printClauses(ClauseAllocator& ca, OccList& list, bool skipDeleted)
 {
     for (unsigned i = 0; i < list.size(); ++i) {
         if (skipDeleted && ca[list[i]].can_be_deleted()) {
@@ -447,8 +447,8 @@ void BoundedVariableElimination::bve_worker(CoprocessorData& data, Stepper& work
         if (doStatistics) { ++testedVars; }
 
         // if( data.value( mkLit(v,true) ) != l_Undef ) continue;
-        vector<CRef>& pos = data.list(mkLit(v, false));
-        vector<CRef>& neg = data.list(mkLit(v, true));
+        OccList& pos = data.list(mkLit(v, false));
+        OccList& neg = data.list(mkLit(v, true));
 
         // ---Printing all Clauses with v --------------------------//
         if (config.opt_bve_verbose > 2) {
@@ -586,8 +586,8 @@ void BoundedVariableElimination::bve_worker(CoprocessorData& data, Stepper& work
                 removeClauses(data, neg, lit_Undef, n_limit, doStatistics); // add these clauses to the undo stack
             }
 
-            vector<CRef>().swap(pos); //free physical memory of occs
-            vector<CRef>().swap(neg); //free physical memory of occs
+            pos.release(); // free physical memory of occs
+            neg.release(); // free physical memory of occs
             if (config.opt_bve_verbose > 0) { cerr << "c Resolved " << v + 1 << endl; }
             //subsumption with new clauses!!
             if (doStatistics) { subsimpTime = cpuTime() - subsimpTime; }
@@ -641,7 +641,7 @@ void BoundedVariableElimination::bve_worker(CoprocessorData& data, Stepper& work
  *      remove it from data-Objects statistics
  *      mark it for deletion
  */
-inline void BoundedVariableElimination::removeClauses(Coprocessor::CoprocessorData& data, const vector< Riss::CRef >& list,
+inline void BoundedVariableElimination::removeClauses(Coprocessor::CoprocessorData& data, const OccList& list,
         const Lit& l, const int limit, const bool doStatistics)
 {
     for (int cr_i = 0; cr_i < list.size(); ++cr_i) {
@@ -692,8 +692,8 @@ inline void BoundedVariableElimination::removeClauses(Coprocessor::CoprocessorDa
  *  @return l_False if the empty clause was produced, l_Undef, if the procedure reached its end, l_True, if we had an
  *                  early abort due to too many resolvents
  */
-inline lbool BoundedVariableElimination::anticipateElimination(CoprocessorData& data, vector<CRef>& positive,
-        vector<CRef>& negative, const int v, const int p_limit,
+inline lbool BoundedVariableElimination::anticipateElimination(CoprocessorData& data, OccList& positive,
+        OccList& negative, const int v, const int p_limit,
         const int n_limit, vec<int32_t>& pos_stats,
         vec<int32_t>& neg_stats, int& lit_clauses,
         int& lit_learnts, int& resolvents, Stepper& bveStepper,
@@ -890,7 +890,7 @@ inline lbool BoundedVariableElimination::anticipateElimination(CoprocessorData&
  *          -> this is already done in anticipateElimination
  */
 lbool BoundedVariableElimination::resolveSet(CoprocessorData& data,
-        vector<CRef>& positive, vector<CRef>& negative, const int v,
+        OccList& positive, OccList& negative, const int v,
         const int p_limit, const int n_limit, Stepper& bveStepper,
         const bool keepLearntResolvents, const bool force,
         const bool doStatistics)
@@ -1050,7 +1050,7 @@ lbool BoundedVariableElimination::resolveSet(CoprocessorData& data,
  * this function removes Clauses that have no resolvents
  * i.e. all resolvents are tautologies
  */
-inline void BoundedVariableElimination::removeBlockedClauses(CoprocessorData& data, const vector< Riss::CRef >& list,
+inline void BoundedVariableElimination::removeBlockedClauses(CoprocessorData& data, const OccList& list,
         const int32_t stats[], const Lit& l, const int limit,
         const bool doStatistics)
 {
@@ -1099,7 +1099,7 @@ inline void BoundedVariableElimination::removeBlockedClauses(CoprocessorData& da
         Clause & c = ca[modified_list[i]];
         for (int l = 0; l < c.size(); l++)
         {
-            vector<CRef> & clauses = data.list(c[l]);
+            OccList& clauses = data.list(c[l]);
             for (int j = 0; j < clauses.size(); ++j)
             {
                 Clause & d = ca[clauses[j]];
@@ -1126,7 +1126,7 @@ void BoundedVariableElimination::touchedVarsForSubsumption(CoprocessorData& data
     }
 }
 
-inline void BoundedVariableElimination::addClausesToSubsumption(const vector<CRef>& clauses)
+inline void BoundedVariableElimination::addClausesToSubsumption(const OccList& clauses)
 {
     for (int j = 0; j < clauses.size(); ++j) {
         assert(clauses[j] != CRef_Undef);
@@ -1151,8 +1151,8 @@ bool BoundedVariableElimination::findGates(CoprocessorData& data, const Var v, i
     MarkArray& markArray = (helper == 0 ? data.ma : *helper);
 
     for (uint32_t pn = 0; pn < 2; ++pn) {
-        vector<CRef>& pList = data.list(mkLit(v, pn != 0));
-        vector<CRef>& nList = data.list(mkLit(v, pn == 0));
+        OccList& pList = data.list(mkLit(v, pn != 0));
+        OccList& nList = data.list(mkLit(v, pn == 0));
         const Lit pLit = mkLit(v, pn != 0);
         const Lit nLit = mkLit(v, pn == 0);
         int& pClauses = pn == 0 ? p_limit : n_limit;
@@ -107,6 +107,7 @@ class BoundedVariableElimination : public Technique<BoundedVariableElimination>
 
     void destroy();
     void giveMoreSteps();
+    void getStepUsage(int64_t& steps, int64_t& limit) const { steps = stepper.getCurrentSteps(); limit = stepper.getCurrentLimit(); }
     void printStatistics(std::ostream& stream);
     inline void initializeTechnique(CoprocessorData& data);
 
@@ -122,17 +123,17 @@ class BoundedVariableElimination : public Technique<BoundedVariableElimination>
     /** remove clauses from data structures and add to extension lists
      *  @param l literal that has been used to remove the clauses during elimination (if l == Riss::lit_Undef, clauses are not added to extension stack)
      */
-    inline void removeClauses(CoprocessorData& data, const std::vector<Riss::CRef>& list, const Riss::Lit& l, const int limit, const bool doStatistics = true);
+    inline void removeClauses(CoprocessorData& data, const OccList& list, const Riss::Lit& l, const int limit, const bool doStatistics = true);
 
 
     /** ths method applies unit propagation during resolution, if possible! */
-    inline Riss::lbool resolveSet(CoprocessorData& data, std::vector<Riss::CRef>& positive, std::vector<Riss::CRef>& negative,
+    inline Riss::lbool resolveSet(CoprocessorData& data, OccList& positive, OccList& negative,
                                   const int v, const int p_limit, const int n_limit, Stepper& bveStepper,
                                   const bool keepLearntResolvents = false, const bool force = false, const bool doStatistics = true);
-    inline Riss::lbool anticipateElimination(CoprocessorData& data, std::vector<Riss::CRef>& positive, std::vector<Riss::CRef>& negative,
+    inline Riss::lbool anticipateElimination(CoprocessorData& data, OccList& positive, OccList& negative,
             const int v, const int p_limit, const int n_limit, Riss::vec<int32_t>& pos_stats, Riss::vec<int32_t>& neg_stats,
             int& lit_clauses, int& lit_learnts, int& resolvents, Stepper& bveStepper, const bool doStatistics = true);
-    inline void addClausesToSubsumption(const std::vector<Riss::CRef>& clauses);
+    inline void addClausesToSubsumption(const OccList& clauses);
     void touchedVarsForSubsumption(CoprocessorData& data, const std::vector<Riss::Var>& touched_vars);
 
 
@@ -155,7 +156,7 @@ class BoundedVariableElimination : public Technique<BoundedVariableElimination>
     };
 
     /** This function removes Clauses that have no resolvents i.e. all resolvents are tautologies */
-    inline void removeBlockedClauses(CoprocessorData& data, const std::vector< Riss::CRef>& list,
+    inline void removeBlockedClauses(CoprocessorData& data, const OccList& list,
                                      const int32_t stats[], const Riss::Lit& l, const int limit, const bool doStatistics = true);
 
     // parallel functions:
@@ -172,10 +173,10 @@ class BoundedVariableElimination : public Technique<BoundedVariableElimination>
     /** run parallel bve with all available threads */
     void parallelBVE(CoprocessorData& data, const bool doStatistics = true);
 
-    inline void removeClausesThreadSafe(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const std::vector<Riss::CRef>& list, const Riss::Lit& l, const int limit, SpinLock& data_lock, SpinLock& heap_lock, ParBVEStats& stats, int& garbageCounter, const bool doStatistics);
-    inline Riss::lbool resolveSetThreadSafe(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, std::vector<Riss::CRef>& positive, std::vector<Riss::CRef>& negative, const int v, const int p_limit, const int n_limit, Riss::vec < Riss::Lit >& ps, Riss::AllocatorReservation& memoryReservation, std::deque<Riss::CRef>& strengthQueue, ParBVEStats& stats, SpinLock& data_lock, SpinLock& heap_lock, int expectedResolvents, int64_t& bveChecks, const bool doStatistics, const bool keepLearntResolvents = false);
-    inline Riss::lbool anticipateEliminationThreadsafe(CoprocessorData& data, std::vector<Riss::CRef>& positive, std::vector<Riss::CRef>& negative, const int v, const int p_limit, const int n_limit, Riss::vec<Riss::Lit>& resolvent, Riss::vec < int32_t >& pos_stats, Riss::vec < int32_t >& neg_stats, int& lit_clauses, int& lit_learnts, int& new_clauses, int& new_learnts, SpinLock& data_lock, ParBVEStats& stats, int64_t& bveChecks, const bool doStatistics);
-    inline void removeBlockedClausesThreadSafe(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const std::vector< Riss::CRef>& list, const int32_t _stats[], const Riss::Lit& l, const int limit, SpinLock& data_lock, SpinLock& heap_lock, ParBVEStats& stats, int& garbageCounter, const bool doStatistics);
+    inline void removeClausesThreadSafe(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const OccList& list, const Riss::Lit& l, const int limit, SpinLock& data_lock, SpinLock& heap_lock, ParBVEStats& stats, int& garbageCounter, const bool doStatistics);
+    inline Riss::lbool resolveSetThreadSafe(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, OccList& positive, OccList& negative, const int v, const int p_limit, const int n_limit, Riss::vec < Riss::Lit >& ps, Riss::AllocatorReservation& memoryReservation, std::deque<Riss::CRef>& strengthQueue, ParBVEStats& stats, SpinLock& data_lock, SpinLock& heap_lock, int expectedResolvents, int64_t& bveChecks, const bool doStatistics, const bool keepLearntResolvents = false);
+    inline Riss::lbool anticipateEliminationThreadsafe(CoprocessorData& data, OccList& positive, OccList& negative, const int v, const int p_limit, const int n_limit, Riss::vec<Riss::Lit>& resolvent, Riss::vec < int32_t >& pos_stats, Riss::vec < int32_t >& neg_stats, int& lit_clauses, int& lit_learnts, int& new_clauses, int& new_learnts, SpinLock& data_lock, ParBVEStats& stats, int64_t& bveChecks, const bool doStatistics);
+    inline void removeBlockedClausesThreadSafe(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const OccList& list, const int32_t _stats[], const Riss::Lit& l, const int limit, SpinLock& data_lock, SpinLock& heap_lock, ParBVEStats& stats, int& garbageCounter, const bool doStatistics);
 
     // Special subsimp implementations for par bve:
     void par_bve_strengthening_worker(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const Riss::Var ignore, std::vector< SpinLock >& var_lock, ReadersWriterLock& rwlock, std::deque<Riss::CRef>& sharedStrengthQueue, std::deque<Riss::CRef>& localQueue, Riss::MarkArray& dirtyOccs, ParBVEStats& stats, int& rwlock_count, int& garbageCounter, const bool strength_resolvents, const bool doStatistics);
@@ -183,9 +184,9 @@ class BoundedVariableElimination : public Technique<BoundedVariableElimination>
     // Special propagation for par bve
     Riss::lbool par_bve_propagate(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const Riss::Var ignore, std::vector< SpinLock >& var_lock, ReadersWriterLock& rwlock, Riss::MarkArray& dirtyOccs, std::deque <Riss::CRef>& sharedSubsimpQueue, ParBVEStats& stats, int& rwlock_count, int& garbageCounter, const bool doStatistics);
 
-    inline Riss::lbool strength_check_pos(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const Riss::Var ignore, std::vector < Riss::CRef >& list, std::deque<Riss::CRef>& sharedStrengthQueue, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Var fst, std::vector < SpinLock >& var_lock, Riss::MarkArray& dirtyOccs, ParBVEStats& stats, int& garbageCounter, const bool strength_resolvents, const bool doStatistics);
+    inline Riss::lbool strength_check_pos(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const Riss::Var ignore, OccList& list, std::deque<Riss::CRef>& sharedStrengthQueue, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Var fst, std::vector < SpinLock >& var_lock, Riss::MarkArray& dirtyOccs, ParBVEStats& stats, int& garbageCounter, const bool strength_resolvents, const bool doStatistics);
 
-    inline Riss::lbool strength_check_neg(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const Riss::Var ignore, std::vector < Riss::CRef >& list, std::deque<Riss::CRef>& sharedStrengthQueue, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Lit min, Riss::Var fst, std::vector < SpinLock >& var_lock, Riss::MarkArray& dirtyOccs, ParBVEStats& stats, int& garbageCounter, const bool strength_resolvents, const bool doStatistics);
+    inline Riss::lbool strength_check_neg(CoprocessorData& data, Riss::Heap<VarOrderBVEHeapLt>& heap, const Riss::Var ignore, OccList& list, std::deque<Riss::CRef>& sharedStrengthQueue, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Lit min, Riss::Var fst, std::vector < SpinLock >& var_lock, Riss::MarkArray& dirtyOccs, ParBVEStats& stats, int& garbageCounter, const bool strength_resolvents, const bool doStatistics);
     // Helpers for both par and seq
     inline bool resolve(const Riss::Clause& c, const Riss::Clause& d, const int v, Riss::vec<Riss::Lit>& ps);
     inline int  tryResolve(const Riss::Clause& c, const Riss::Clause& d, const int v);
@@ -33,7 +33,7 @@ static void printLitVec(const vec<Lit>& litvec)
 
 }
 
-static void printClauses(ClauseAllocator& ca, vector<CRef>& list, bool skipDeleted)
+static void printClauses(ClauseAllocator& ca, OccList& list, bool skipDeleted)
 {
     for (unsigned i = 0; i < list.size(); ++i) {
         if (list[i] == CRef_Undef || (skipDeleted && ca[list[i]].can_be_deleted())) {
@@ -195,8 +195,8 @@ void BoundedVariableElimination::par_bve_worker(CoprocessorData& data,
         rwlock_count++;
         rwlock.readLock();
         // Get the clauses with v
-        vector<CRef>& pos = data.list(mkLit(v, false));
-        vector<CRef>& neg = data.list(mkLit(v, true));
+        OccList& pos = data.list(mkLit(v, false));
+        OccList& neg = data.list(mkLit(v, true));
 
         int locked_neigbors = 0;
         Var reason = var_Undef;
@@ -564,8 +564,8 @@ void BoundedVariableElimination::par_bve_worker(CoprocessorData& data,
                                     garbageCounter, doStatistics);
             removeClausesThreadSafe(data, heap, neg, mkLit(v, true), n_limit, data_lock, heap_lock, stats,
                                     garbageCounter, doStatistics);
-            vector<CRef>().swap(pos); // free physical memory of pos-occ
-            vector<CRef>().swap(neg); // free physical memory of neg-occ
+            pos.release(); // free physical memory of pos-occ
+            neg.release(); // free physical memory of neg-occ
             if (config.opt_bve_verbose > 0) { cerr << "c Resolved " << v + 1 << endl; }
             if (doStatistics) { ++stats.eliminatedVars; }
 
@@ -618,7 +618,7 @@ void BoundedVariableElimination::par_bve_worker(CoprocessorData& data,
  *
  *      TODO don't use the data_lock, since we already have the global writeLock
  */
-inline void BoundedVariableElimination::removeClausesThreadSafe(Coprocessor::CoprocessorData& data, Heap< Coprocessor::VarOrderBVEHeapLt >& heap, const vector< Riss::CRef >& list, const Lit& l, const int limit, SpinLock& data_lock, SpinLock& heap_lock, Coprocessor::BoundedVariableElimination::ParBVEStats& stats, int& garbageCounter, const bool doStatistics)
+inline void BoundedVariableElimination::removeClausesThreadSafe(Coprocessor::CoprocessorData& data, Heap< Coprocessor::VarOrderBVEHeapLt >& heap, const OccList& list, const Lit& l, const int limit, SpinLock& data_lock, SpinLock& heap_lock, Coprocessor::BoundedVariableElimination::ParBVEStats& stats, int& garbageCounter, const bool doStatistics)
 {
     const Var ignore = var(l);
     for (int cr_i = 0; cr_i < list.size(); ++cr_i) {
@@ -681,8 +681,8 @@ inline void BoundedVariableElimination::removeClausesThreadSafe(Coprocessor::Cop
  *
  */
 inline lbool BoundedVariableElimination::anticipateEliminationThreadsafe(CoprocessorData& data,
-        vector<Riss::CRef>& positive,
-        vector<Riss::CRef>& negative, const int v,
+        OccList& positive,
+        OccList& negative, const int v,
         const int p_limit, const int n_limit,
         vec<Lit>& resolvent, vec<int32_t>& pos_stats,
         vec<int32_t>& neg_stats, int& lit_clauses,
@@ -831,7 +831,7 @@ inline lbool BoundedVariableElimination::anticipateEliminationThreadsafe(Coproce
  *          -> this is already done in anticipateElimination
  */
 lbool BoundedVariableElimination::resolveSetThreadSafe(CoprocessorData& data, Heap<VarOrderBVEHeapLt>& heap,
-        vector<CRef>& positive, vector<CRef>& negative, const int v,
+        OccList& positive, OccList& negative, const int v,
         const int p_limit, const int n_limit, vec<Lit>& ps,
         AllocatorReservation& memoryReservation,
         deque<CRef>& strengthQueue, ParBVEStats& stats,
@@ -942,7 +942,7 @@ lbool BoundedVariableElimination::resolveSetThreadSafe(CoprocessorData& data, He
  */
 inline void BoundedVariableElimination::removeBlockedClausesThreadSafe(CoprocessorData& data,
         Heap<VarOrderBVEHeapLt>& heap,
-        const vector<CRef>& list, const int32_t _stats[],
+        const OccList& list, const int32_t _stats[],
         const Lit& l, const int limit,
         SpinLock& data_lock, SpinLock& heap_lock,
         ParBVEStats& stats, int& garbageCounter,
@@ -1326,8 +1326,8 @@ void BoundedVariableElimination::par_bve_strengthening_worker(CoprocessorData& d
         nmin = ~minT;
 
         assert(min != nmin && "min and nmin should be different");
-        vector<CRef>& list = data.list(min);        // occurrences of minlit from strengthener
-        vector<CRef>& list_neg = data.list(nmin);   // occurrences of negated minlit from strengthener
+        OccList& list = data.list(min);        // occurrences of minlit from strengthener
+        OccList& list_neg = data.list(nmin);   // occurrences of negated minlit from strengthener
 
         lbool state = strength_check_pos(data, heap, ignore, list, sharedStrengthQueue, localQueue, strengthener, cr,
                                          fst, var_lock, dirtyOccs, stats, garbageCounter, strength_resolvents,
@@ -1373,7 +1373,7 @@ void BoundedVariableElimination::par_bve_strengthening_worker(CoprocessorData& d
  *
  */
 inline lbool BoundedVariableElimination::strength_check_pos(CoprocessorData& data, Heap<VarOrderBVEHeapLt>& heap,
-        const Var ignore, vector<CRef>& list,
+        const Var ignore, OccList& list,
         deque<CRef>& sharedStrengthQueue, deque<CRef>& localQueue,
         Clause& strengthener, CRef cr, Var fst,
         vector<SpinLock>& var_lock, MarkArray& dirtyOccs,
@@ -1576,7 +1576,7 @@ inline lbool BoundedVariableElimination::strength_check_pos(CoprocessorData& dat
  *
  */
 inline lbool BoundedVariableElimination::strength_check_neg(CoprocessorData& data, Heap<VarOrderBVEHeapLt>& heap,
-        const Var ignore, vector<CRef>& list,
+        const Var ignore, OccList& list,
         deque<CRef>& sharedStrengthQueue, deque<CRef>& localQueue,
         Clause& strengthener, CRef cr, Lit min, Var fst,
         vector<SpinLock>& var_lock, MarkArray& dirtyOccs,
@@ -1793,7 +1793,7 @@ lbool BoundedVariableElimination::par_bve_propagate(CoprocessorData& data, Heap<
         rwlock.readLock();
 
         // remove positives
-        vector<CRef>& positive = data.list(l);
+        OccList& positive = data.list(l);
         for (int i = 0; i < positive.size(); ++i) {
             const CRef cr = positive[i];
             if (CRef_Undef == cr) {
@@ -1844,7 +1844,7 @@ lbool BoundedVariableElimination::par_bve_propagate(CoprocessorData& data, Heap<
         const Lit nl = ~l;
         int countO = 0;
         int countL = 0;
-        vector<CRef>& negative = data.list(nl);
+        OccList& negative = data.list(nl);
 
         for (int i = 0; i < negative.size(); ++i) {
             const CRef cr = negative[i];
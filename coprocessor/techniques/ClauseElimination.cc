@@ -116,7 +116,7 @@ bool ClauseElimination::eliminate(CoprocessorData& data, ClauseElimination::Work
             const Lit l = wData.toProcess[i];
             assert(l != lit_Undef && l != lit_Error && "only real literals can be in the queue");
             DOUT(if (config.cce_debug_out > 1) cerr << "ALA check list of literal " << l << endl;);
-            const vector<CRef>& lList = data.list(l);
+            const OccList& lList = data.list(l);
             for (int j = 0 ; j < lList.size(); ++ j) {   // TODO: add step counter here!
                 if (lList[j] == cr) { continue; }                                             // to not work on the same clause twice!
                 const Clause& cj = ca[lList[j]];
@@ -176,7 +176,7 @@ bool ClauseElimination::eliminate(CoprocessorData& data, ClauseElimination::Work
             });
 
 
-            const vector<CRef>& lList = data.list(l);
+            const OccList& lList = data.list(l);
             int beforeCla = wData.cla.size();
             for (int j = 0 ; j < lList.size(); ++ j) {   // TODO: add step counter here!
                 const Clause& cj = ca[lList[j]];
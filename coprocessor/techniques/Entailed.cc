@@ -58,7 +58,7 @@ bool EntailedRedundant::process()
         DOUT(if (config.entailed_debug > 1) cerr << "c work on clause " << c << " with min literal " << min << " toRemoveSoFar: " << data.clss.size() << endl;);
 
         // all clauses that contain this literal are candidate - all literals except one have to be part of the clause!
-        vector<CRef>& clss = data.list(min);
+        OccList& clss = data.list(min);
         for (int i = 0 ; i < clss.size(); ++i) {
             if (cr == clss[i]) { continue; }
             Clause& candidate = ca[clss[i]];
@@ -117,7 +117,7 @@ bool EntailedRedundant::process()
                 // find a clause that contains all literals in the vector data.lits, and furthermore contains only literals that appear in the clause c
                 Lit min2 = data.lits[0];
                 for (int j = 1 ; j < data.lits.size(); ++ j) { min2 = data[min2] <= data[data.lits[j]] ? min2 : data.lits[j]; }
-                const vector<CRef>& matches = data.list(min2);
+                const OccList& matches = data.list(min2);
                 for (int j = 0 ; j < matches.size(); ++ j) {
                     const CRef cr2 = matches[j];
                     if (cr2 == cr || cr2 == clss[i]) { continue; }   // do not handle same clause twice!
@@ -2154,7 +2154,7 @@ bool EquivalenceElimination::applyEquivalencesToFormula(CoprocessorData& data, b
                         // if( getReplacement(l) == repr )  continue;
                         // TODO handle equivalence here (detect inconsistency, replace literal in all clauses, check for clause duplicates!)
                         for (int pol = 0; pol < 2; ++ pol) {   // do for both polarities!
-                            vector<CRef>& list = pol == 0 ? data.list(l) : data.list(~l);
+                            OccList& list = pol == 0 ? data.list(l) : data.list(~l);
                             DOUT(if (config.ee_debug_out > 2) cerr << "c rewrite clauses of lit " << (pol == 0 ? l : ~l) << endl;);
                             for (int k = 0 ; k < list.size(); ++ k) {
                                 Clause& c = ca[list[k]];
@@ -2374,7 +2374,7 @@ static bool ordered_subsumes(const Clause& c, const Clause& other)
     }
 }
 
-bool EquivalenceElimination::hasDuplicate(CoprocessorData& data, vector<CRef>& list, const Clause& c)
+bool EquivalenceElimination::hasDuplicate(CoprocessorData& data, OccList& list, const Clause& c)
 {
     bool irredundant = !c.learnt();
 //   cerr << "c check for duplicates: " << c << " (" << c.size() << ") against " << list.size() << " candidates" << endl;
@@ -111,7 +111,7 @@ class EquivalenceElimination : public Technique<EquivalenceElimination>
      *  Note: assumes that all clauses are sorted!
      *  @return true, if there are duplicates, so that c can be deleted
      */
-    bool hasDuplicate(CoprocessorData& data, std::vector< Riss::CRef >& list, const Riss::Clause& c);
+    bool hasDuplicate(CoprocessorData& data, OccList& list, const Riss::Clause& c);
 
     /** check whether this gate can be processed for equivalence checks */
     bool allInputsStamped(Circuit::Gate& g, std::vector< unsigned int >& bitType);
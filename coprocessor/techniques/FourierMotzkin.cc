@@ -1904,7 +1904,7 @@ bool FourierMotzkin::hasDuplicate(const vector<Lit>& c)
     Lit min = c[0];
     for (int i = 1; i < c.size(); ++ i) if (data[min] < data[c[i]]) { min = c[i]; }
 
-    vector<CRef>& list = data.list(min);
+    OccList& list = data.list(min);
     for (int i = 0 ; i < list.size(); ++ i) {
         Clause& d = ca[list[i]];
         if (d.can_be_deleted()) { continue; }
@@ -2077,16 +2077,19 @@ void FourierMotzkin::cleanSolver()
 {
     // clear all watches!
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     // clear all watches!
     for (int v = 0; v < solver.nVars(); v++)
         for (int s = 0; s < 2; s++) {
             solver.watches[ mkLit(v, s) ].clear();
+            solver.watchesBin[ mkLit(v, s) ].clear();
         }
 
     solver.learnts_literals = 0;
     solver.clauses_literals = 0;
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     for (int i = 0 ; i < solver.learnts.size(); ++ i) {
         ca[ solver.learnts[i] ].sort();
@@ -142,6 +142,7 @@ class FourierMotzkin : public Technique<FourierMotzkin>
     void printStatistics(std::ostream& stream);
 
     void giveMoreSteps();
+    void getStepUsage(int64_t& _steps, int64_t& limit) const { _steps = steps; limit = fmLimit; }
 
     void destroy();
 
@@ -254,7 +254,7 @@ bool HiddenTautologyElimination::hiddenTautologyElimination(Var v, CoprocessorDa
         });
 
         // iterate over binary clauses with occurences of the literal i
-        vector<CRef>& iList = data.list(i);
+        OccList& iList = data.list(i);
 
         // transitive reduction of BIG
         if (!doLock) {
@@ -549,7 +549,7 @@ bool HiddenTautologyElimination::alaMarkClause(vec<Lit>& clause, CoprocessorData
         const Lit l = queue.front(); queue.pop_front();
         helpArray.reset(toInt(l));
 
-        vector<CRef>& list = data.list(l);
+        OccList& list = data.list(l);
         for (int i = 0 ; i < list.size(); ++ i) {
             const Clause& c = ca[ list[i] ];
             Lit l1 = lit_Undef;
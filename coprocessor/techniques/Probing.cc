@@ -179,7 +179,7 @@ bool Probing::process()
         for (Var v = 0 ; v < data.nVars(); ++ v) {
                 for (int p = 0 ; p < 2; ++p) {
                     const Lit l = mkLit(v, p == 1);
-                    vector<CRef>& list  = data.list(l);
+                    OccList& list  = data.list(l);
                     cerr << "c data list for lit " << l << ": " << endl;
                     for (int i = 0 ; i < list.size(); ++ i) {
                         cerr << "c [" << list[i] << "] : " << ca[ list[i] ] << " - " << (ca[ list[i] ].can_be_deleted() ? "del " : "keep") << endl;
@@ -217,6 +217,7 @@ CRef Probing::prPropagate(bool doDouble)
     CRef    confl     = CRef_Undef;
     int     num_props = 0;
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     DOUT(if (config.pr_debug_out > 1) cerr << "c head: " << solver.qhead << " trail elements: " << solver.trail.size() << endl;);
     solver.clssToBump.clear();
@@ -236,10 +237,9 @@ CRef Probing::prPropagate(bool doDouble)
 
         // First, Propagate binary clauses
         if (config.opt_pr_probeBinary) {   // option to disable propagating binary clauses in probing
-            const vec<Watcher>&  wbin  = solver.watches[p]; // this code needs to be added to the usual probing version!
+            const BinWatchLists::List  wbin  = solver.watchesBin[p]; // this code needs to be added to the usual probing version!
 
             for (int k = 0; k < wbin.size(); k++) {
-                if (!wbin[k].isBinary()) { continue; }
                 const Lit& imp = wbin[k].blocker();
                 assert(ca[ wbin[k].cref() ].size() == 2 && "in this list there can only be binary clauses");
                 if (solver.value(imp) == l_False) {
@@ -253,7 +253,6 @@ CRef Probing::prPropagate(bool doDouble)
         }
 
         for (i = j = (Watcher*)ws, end = i + ws.size();  i != end;) {
-            if (i->isBinary()) { *j++ = *i++; continue; }   // skip binary clauses (have been propagated before already!}
             // Try to avoid inspecting the clause:
             const Lit blocker = i->blocker();
             if (solver.value(blocker) == l_True) {
@@ -793,17 +792,20 @@ void Probing::cleanSolver()
 {
     // clear all watches!
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     // clear all watches!
     for (int v = 0; v < solver.nVars(); v++) {
         for (int s = 0; s < 2; s++) {
             solver.watches[ mkLit(v, s) ].clear();
+            solver.watchesBin[ mkLit(v, s) ].clear();
         }
     }
 
     solver.learnts_literals = 0;
     solver.clauses_literals = 0;
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     DOUT(if (config.pr_debug_out > 1) {
     cerr << "c formula before resetup: " << endl;
@@ -933,6 +935,11 @@ void Probing::probing()
     bool globalModify = modifiedFormula;
     do {
         modifiedFormula = false;
+        if (useParallelProbing()) {   // probe the whole heap with all threads, results are added at the end
+            parallelProbing();
+            globalModify = globalModify || modifiedFormula;
+            continue;
+        }
         for (int index = 0;  index < variableHeap.size() && !data.isInterupted()  && (probeLimit > probeChecks || data.unlimited()) && data.ok(); ++ index) {
             // repeat variable, if demanded - otherwise take next from heap!
             Var v = var(repeatLit);
@@ -1139,6 +1146,7 @@ void Probing::probing()
 
     // clean data structures
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 }
 
 void Probing::clauseVivificationLCM()
@@ -1221,12 +1229,8 @@ void Probing::clauseVivification()
                 else {
                     for (int j = 0 ; j < 2; ++ j) {
                         const Lit l = ~c[j];
-                        vec<Watcher>&  ws  = solver.watches[l];
-                        bool didFind = false;
-                        for (int j = 0 ; j < ws.size(); ++ j) {
-                            CRef     wcr        = ws[j].cref();
-                            if (wcr  == cr) { didFind = true; break; }
-                        }
+                        BinWatchLists::List wbin = solver.watchesBin[l];
+                        const bool didFind = c.size() == 2 ? find(wbin, Watcher(cr, c[1 - j], 0)) : find(solver.watches[l], Watcher(cr, c[1 - j], 1));
                         if (! didFind) { cerr << "could not find clause[" << cr << "] " << c << " in watcher for lit " << l << endl; }
                     }
 
@@ -1254,6 +1258,11 @@ void Probing::clauseVivification()
 
     DOUT(if (config.pr_debug_out)cerr << "c final viviSize: " << viviSize << endl;);
 
+    if (useParallelProbing()) {
+        parallelVivification(maxSize);
+        return;
+    }
+
     for (uint32_t i = 0 ; i < data.getClauses().size() && (data.unlimited() || viviLimit > viviChecks)  && !data.isInterupted() ; ++ i) {
         const CRef ref = data.getClauses()[i];
         Clause& clause = ca[ ref ];
@@ -1381,48 +1390,9 @@ void Probing::clauseVivification()
 
         Clause& sameClause = ca[ ref ]; // update the reference, because it could have changed in the mean time!
         if (subClauseLimit != sameClause.size()) {
-            // TODO: remove clause and data structures so that they meet the sub clause!
-            viviLits += sameClause.size() - subClauseLimit;
-            viviCls ++;
-
             data.lits.resize(subClauseLimit);
-
             if (!viviConflict) { data.lits.push_back(removedLit); }
-
-            DOUT(if (config.pr_debug_out > 1) {
-            cerr << "c replace clause " << sameClause << " with ";
-            for (int j = 0 ; j < data.lits.size(); ++ j) {
-                    cerr << " " << ~data.lits[j];
-                }
-                cerr << endl;
-            });
-            data.addCommentToProof("shrinked by vivification"); // delete clause that has been shrinked by vivification
-            if (data.outputsProof()) {
-                for (int j = 0 ; j < data.lits.size(); ++ j) { data.lits[j] = ~data.lits[j]; }
-                data.addToProof(data.lits);   // delete clause that has been shrinked by vivification
-                for (int j = 0 ; j < data.lits.size(); ++ j) { data.lits[j] = ~data.lits[j]; }
-            }
-            data.addToProof(sameClause, true);   // delete clause that has been shrinked by vivification
-
-            data.ma.nextStep();
-            for (int j = 0 ; j < data.lits.size(); ++ j) {
-                data.ma.setCurrentStep(toInt(~data.lits[j]));
-            }
-
-            int keptLits = 0;
-            for (int j = 0 ; j < sameClause.size(); ++ j) {
-                // if literal is not there any more, remove clause index from structure
-                if (!data.ma.isCurrentStep(toInt(sameClause[j]))) {
-                    data.removeClauseFrom(ref, sameClause[j]) ;
-                } else {
-                    // otherwise, keep literal inside clause
-                    sameClause[keptLits++] = sameClause[j];
-                }
-            }
-            sameClause.shrink(sameClause.size() - keptLits);
-            sameClause.sort();
-            modifiedFormula = true;
-            DOUT(if (config.pr_debug_out > 1) cerr << "c new clause: " << sameClause << endl;);
+            replaceVivifiedClause(ref);
         }
 
         // detach this clause, so that it cannot be used for unit propagation
@@ -1446,6 +1416,320 @@ void Probing::clauseVivification()
     });
 }
 
+void Probing::replaceVivifiedClause(const CRef ref)
+{
+    Clause& sameClause = ca[ ref ];
+    // TODO: remove clause and data structures so that they meet the sub clause!
+    viviLits += sameClause.size() - data.lits.size();
+    viviCls ++;
+
+    DOUT(if (config.pr_debug_out > 1) {
+    cerr << "c replace clause " << sameClause << " with ";
+    for (int j = 0 ; j < data.lits.size(); ++ j) {
+            cerr << " " << ~data.lits[j];
+        }
+        cerr << endl;
+    });
+    data.addCommentToProof("shrinked by vivification"); // delete clause that has been shrinked by vivification
+    if (data.outputsProof()) {
+        for (int j = 0 ; j < data.lits.size(); ++ j) { data.lits[j] = ~data.lits[j]; }
+        data.addToProof(data.lits);   // delete clause that has been shrinked by vivification
+        for (int j = 0 ; j < data.lits.size(); ++ j) { data.lits[j] = ~data.lits[j]; }
+    }
+    data.addToProof(sameClause, true);   // delete clause that has been shrinked by vivification
+
+    data.ma.nextStep();
+    for (int j = 0 ; j < data.lits.size(); ++ j) {
+        data.ma.setCurrentStep(toInt(~data.lits[j]));
+    }
+
+    int keptLits = 0;
+    for (int j = 0 ; j < sameClause.size(); ++ j) {
+        // if literal is not there any more, remove clause index from structure
+        if (!data.ma.isCurrentStep(toInt(sameClause[j]))) {
+            data.removeClauseFrom(ref, sameClause[j]) ;
+        } else {
+            // otherwise, keep literal inside clause
+            sameClause[keptLits++] = sameClause[j];
+        }
+    }
+    sameClause.shrink(sameClause.size() - keptLits);
+    sameClause.sort();
+    modifiedFormula = true;
+    DOUT(if (config.pr_debug_out > 1) cerr << "c new clause: " << sameClause << endl;);
+}
+
+void Probing::ProbeWorker::reset(Solver& solver)
+{
+    assigns.resize(solver.nVars());
+    for (Var v = 0 ; v < solver.nVars(); ++ v) { assigns[v] = solver.value(v); }   // start with the top level assignment
+    trail.clear();
+    qhead = 0;
+    positive.assign(2 * solver.nVars(), 0);
+    stamp = 0;
+    units.clear();
+    equivalences.clear();
+    vivified.clear();
+    subClauses.clear();
+    failed = false;
+    steps = 0;
+    assignments = 0;
+    probes = failedLits = impliedLits = eeLits = candidates = 0;
+}
+
+void Probing::ProbeWorker::backtrack(int level)
+{
+    for (int i = level; i < trail.size(); ++ i) { assigns[ var(trail[i]) ] = l_Undef; }
+    trail.resize(level);
+    qhead = level;
+}
+
+bool Probing::workerPropagate(ProbeWorker& worker, const CRef ignore)
+{
+    while (worker.qhead < worker.trail.size()) {
+        const Lit p = worker.trail[ worker.qhead++ ];
+        const OccList& list = data.list(~p);   // clauses that might have become unit
+        for (int i = 0 ; i < list.size(); ++ i) {
+            if (list[i] == ignore) { continue; }
+            const Clause& c = ca[ list[i] ];
+            if (c.can_be_deleted()) { continue; }
+            worker.steps ++;
+            Lit unit = lit_Undef;
+            int unassigned = 0;
+            bool satisfied = false;
+            for (int k = 0 ; k < c.size(); ++ k) {
+                const lbool v = worker.value(c[k]);
+                if (v == l_True) { satisfied = true; break; }
+                if (v == l_Undef) {
+                    unit = c[k];
+                    if (++ unassigned > 1) { break; }
+                }
+            }
+            if (satisfied || unassigned > 1) { continue; }
+            if (unassigned == 0) { return false; }   // conflict
+            worker.assign(unit);
+        }
+    }
+    return true;
+}
+
+void Probing::workerUnit(ProbeWorker& worker, const Lit& l)
+{
+    assert(worker.qhead == worker.trail.size() && "units can only be added on the top level");
+    worker.units.push_back(l);
+    if (worker.value(l) == l_False) { worker.failed = true; }
+    else if (worker.value(l) == l_Undef) {
+        worker.assign(l);
+        if (!workerPropagate(worker)) { worker.failed = true; }
+    }
+}
+
+void Probing::workerProbe(ProbeWorker& worker, const Var v)
+{
+    if (worker.assigns[v] != l_Undef) { return; }   // no need to check assigned variable!
+    const Lit posLit = mkLit(v, false), negLit = mkLit(v, true);
+    const int level = worker.trail.size();
+
+    worker.probes ++;
+    worker.assign(posLit);
+    if (!workerPropagate(worker)) {
+        worker.backtrack(level);
+        worker.failedLits ++;
+        workerUnit(worker, negLit);
+        return;
+    }
+    worker.stamp ++;
+    for (int i = level; i < worker.trail.size(); ++ i) { worker.positive[ toInt(worker.trail[i]) ] = worker.stamp; }
+    worker.backtrack(level);
+
+    worker.probes ++;
+    worker.assign(negLit);
+    if (!workerPropagate(worker)) {
+        worker.backtrack(level);
+        worker.failedLits ++;
+        workerUnit(worker, posLit);
+        return;
+    }
+
+    // look for necessary literals, and equivalent literals (do not add literal itself)
+    const int unitsBefore = worker.units.size();
+    worker.lits.clear();
+    worker.lits.push_back(negLit);
+    for (int i = level + 1; i < worker.trail.size(); ++ i) {
+        const Lit l = worker.trail[i];
+        if (worker.positive[ toInt(l) ] == worker.stamp) {
+            worker.units.push_back(l);
+            worker.impliedLits ++;
+        } else if (config.pr_EE && worker.positive[ toInt(~l) ] == worker.stamp) {
+            worker.lits.push_back(l);
+            worker.eeLits ++;
+        }
+    }
+    worker.backtrack(level);
+
+    if (worker.lits.size() > 1) {
+        worker.equivalences.insert(worker.equivalences.end(), worker.lits.begin(), worker.lits.end());
+        worker.equivalences.push_back(lit_Undef);
+    }
+
+    // move implied literals to the top level
+    const int unitsAfter = worker.units.size();
+    for (int i = unitsBefore; i < unitsAfter && !worker.failed; ++ i) {
+        const Lit l = worker.units[i];
+        if (worker.value(l) == l_False) { worker.failed = true; }
+        else if (worker.value(l) == l_Undef) {
+            worker.assign(l);
+            if (!workerPropagate(worker)) { worker.failed = true; }
+        }
+    }
+}
+
+void Probing::workerVivify(ProbeWorker& worker, const CRef ref)
+{
+    const Clause& clause = ca[ ref ];
+    worker.candidates ++;
+    vector<Lit>& lits = worker.lits;
+    lits.clear();
+    for (int j = 0 ; j < clause.size(); ++ j) {
+        lits.push_back(~clause[j]);
+        if (worker.value(lits[j]) != l_Undef) { return; }   // do not consider those clauses!
+    }
+
+    // remove one literal, because otherwise this would fail always!
+    unsigned subClauseLimit = lits.size(); // usually, nothing can be removed
+    const Lit removedLit = lits[ lits.size() - 1 ];
+    lits.pop_back();
+
+    const int level = worker.trail.size();
+    bool viviConflict = false;
+    for (int j = 0; j < lits.size(); ++ j) {
+        // check whether one of the other literals is already "broken"
+        bool viviNextLit = false;
+        for (int k = j; k < lits.size(); ++ k) {
+            if (worker.value(lits[k]) == l_False) {
+                lits[j] = lits[k];
+                subClauseLimit = j + 1;
+                viviConflict = true;
+                break;
+            } else if (worker.value(lits[k]) == l_True) {
+                lits[k] = lits[ lits.size() - 1 ];
+                if (j == k) { --j; }
+                lits.pop_back();
+                subClauseLimit --;
+                viviNextLit = true;
+                break;
+            }
+        }
+        if (viviConflict) { break; }   // found a subsuming sub clause -> stop
+        else if (viviNextLit) { continue; }   // found a tautologic literal -> continue with next literal!
+
+        worker.assign(lits[j]);
+        if (!workerPropagate(worker, ref)) {   // the clause itself must not be used for propagation
+            subClauseLimit = j + 1;
+            viviConflict = true;
+            break;
+        }
+    }
+    worker.backtrack(level);
+
+    if (subClauseLimit != clause.size()) {
+        lits.resize(subClauseLimit);
+        if (!viviConflict) { lits.push_back(removedLit); }
+        worker.vivified.push_back(ref);
+        worker.subClauses.insert(worker.subClauses.end(), lits.begin(), lits.end());
+        worker.subClauses.push_back(lit_Undef);
+    }
+}
+
+void Probing::parallelProbing()
+{
+    workers.resize(controller.size());
+    for (int i = 0 ; i < workers.size(); ++ i) { workers[i].reset(solver); }
+
+    // each thread probes its own part of the heap, and steals from the others once it is done
+    volatile int64_t steps = 0;
+    controller.parallelFor(0, variableHeap.size(), 16, [&](unsigned id, unsigned start, unsigned end) {
+        ProbeWorker& worker = workers[id];
+        for (unsigned i = start; i < end && !worker.failed && !data.isInterupted() && (data.unlimited() || probeChecks + steps < probeLimit); ++ i) {
+            const uint64_t before = worker.steps;
+            workerProbe(worker, variableHeap[i]);
+            __sync_fetch_and_add(&steps, worker.steps - before);
+        }
+    });
+    probeChecks += steps;
+
+    // merge the results of all threads
+    if (data.outputsProof()) { printDRUPwarning(cerr, "necessary assignments and equivalences from Probing cannot be handled easily with DRAT"); }
+    data.addCommentToProof("unit clauses that have been learned during parallel probing");
+    for (int i = 0 ; i < workers.size() && data.ok(); ++ i) {
+        ProbeWorker& worker = workers[i];
+        probes += worker.probes;
+        l1failed += worker.failedLits;
+        l1learntUnit += worker.failedLits;
+        l1implied += worker.impliedLits;
+        l1ee += worker.eeLits;
+        if (worker.failed) { data.setFailed(); break; }
+        for (int j = 0 ; j < worker.units.size(); ++ j) {
+            if (data.enqueue(worker.units[j]) == l_False) { break; }
+            data.addUnitToProof(worker.units[j]);
+        }
+        for (int j = 0 ; j < worker.equivalences.size(); ++ j) {
+            data.lits.clear();
+            for (; worker.equivalences[j] != lit_Undef; ++ j) { data.lits.push_back(worker.equivalences[j]); }
+            data.addEquivalences(data.lits);
+            modifiedFormula = true;
+        }
+    }
+
+    // propagate implied(necessary) literals inside solver
+    if (data.ok() && solver.propagate() != CRef_Undef) {
+        data.setFailed();
+    }
+}
+
+void Probing::parallelVivification(uint32_t maxSize)
+{
+    workers.resize(controller.size());
+    for (int i = 0 ; i < workers.size(); ++ i) { workers[i].reset(solver); }
+
+    // each thread vivifies its own part of the clauses, and steals from the others once it is done
+    const vec<CRef>& clauses = data.getClauses();
+    volatile int64_t steps = 0;
+    controller.parallelFor(0, clauses.size(), 64, [&](unsigned id, unsigned start, unsigned end) {
+        ProbeWorker& worker = workers[id];
+        for (unsigned i = start; i < end && !data.isInterupted() && (data.unlimited() || viviChecks + steps < viviLimit); ++ i) {
+            const Clause& clause = ca[ clauses[i] ];
+            if (clause.can_be_deleted() || clause.size() < maxSize) { continue; }
+            const uint64_t before = worker.assignments + worker.candidates;   // same measure as sequential vivification
+            workerVivify(worker, clauses[i]);
+            __sync_fetch_and_add(&steps, worker.assignments + worker.candidates - before);
+        }
+    });
+    viviChecks += steps;
+
+    // replace the vivified clauses, each sub clause is implied by the formula without the original clause
+    for (int i = 0 ; i < workers.size() && data.ok(); ++ i) {
+        ProbeWorker& worker = workers[i];
+        viviCands += worker.candidates;
+        int pos = 0;
+        for (int j = 0 ; j < worker.vivified.size() && data.ok(); ++ j) {
+            const CRef ref = worker.vivified[j];
+            data.lits.clear();
+            for (; worker.subClauses[pos] != lit_Undef; ++ pos) { data.lits.push_back(worker.subClauses[pos]); }
+            ++ pos;
+
+            solver.detachClause(ref, true);
+            replaceVivifiedClause(ref);
+            const Clause& sameClause = ca[ ref ];
+            if (sameClause.size() == 0) {
+                data.setFailed();
+            } else if (sameClause.size() == 1) {
+                data.enqueue(sameClause[0]);
+            } else { solver.attachClause(ref); }
+        }
+    }
+}
+
 void Probing::destroy()
 {
     vector<Var>().swap(variableHeap);
@@ -1455,6 +1739,7 @@ void Probing::destroy()
     vector<Lit>().swap(doubleLiterals);
     vector<CRef>().swap(l2conflicts);
     vector<CRef> ().swap(l2implieds);
+    vector<ProbeWorker>().swap(workers);
 }
 
 } // namespace Coprocessor
@@ -38,6 +38,34 @@ class Probing : public Technique<Probing>
     std::vector<Riss::CRef> l2conflicts;
     std::vector<Riss::CRef> l2implieds;
 
+    /** private state of a thread in parallel probing and vivification, only reads the formula */
+    class ProbeWorker
+    {
+      public:
+        std::vector<Riss::lbool> assigns;   // private assignment, starts with the top level assignment of the solver
+        std::vector<Riss::Lit> trail;       // private trail
+        int qhead;                          // next literal to propagate
+        std::vector<uint32_t> positive;     // per literal, stamp of the probe of the positive literal that implied it
+        uint32_t stamp;                     // stamp of the current probe
+        std::vector<Riss::Lit> lits;        // literals of the current probe or vivified clause
+
+        std::vector<Riss::Lit> units;        // found unit clauses
+        std::vector<Riss::Lit> equivalences; // found groups of equivalent literals, each group is terminated by lit_Undef
+        std::vector<Riss::CRef> vivified;    // clauses that can be replaced by a sub clause
+        std::vector<Riss::Lit> subClauses;   // negated literals of the sub clause for each vivified clause, terminated by lit_Undef
+        bool failed;                         // found that the formula is unsatisfiable
+
+        uint64_t steps;                      // inspected clauses
+        uint64_t assignments;                // assigned literals
+        unsigned probes, failedLits, impliedLits, eeLits, candidates;
+
+        Riss::lbool value(const Riss::Lit& l) const { return assigns[ Riss::var(l) ] ^ Riss::sign(l); }
+        void assign(const Riss::Lit& l) { assigns[ Riss::var(l) ] = Riss::lbool(!Riss::sign(l)); trail.push_back(l); ++ assignments; }
+        void backtrack(int level);
+        void reset(Riss::Solver& solver);
+    };
+    std::vector<ProbeWorker> workers;
+
 
   public:
     Probing(CP3Config& _config, Riss::ClauseAllocator& _ca, Riss::ThreadController& _controller, CoprocessorData& _data, Propagation& _propagation, EquivalenceElimination& _ee, Riss::Solver& _solver);
@@ -54,6 +82,7 @@ class Probing : public Technique<Probing>
     void destroy();
 
     void giveMoreSteps();
+    void getStepUsage(int64_t& steps, int64_t& limit) const { steps = (int64_t)probeChecks + viviChecks; limit = (int64_t)probeLimit + viviLimit; }
 
   protected:
 
@@ -80,6 +109,34 @@ class Probing : public Technique<Probing>
     /** perform LCM on each clause of the formula (very similar to vivification) */
     void clauseVivificationLCM();
 
+    /** whether probing and vivification should run in parallel */
+    bool useParallelProbing() const { return config.pr_parallel && controller.size() > 0; }
+
+    /** probe all literals of the variable heap with all threads, each thread on its own copy of the assignment
+     *  afterwards, add all found units and equivalences to the formula
+     */
+    void parallelProbing();
+
+    /** vivify all clauses with at least maxSize literals with all threads, replace the clauses afterwards */
+    void parallelVivification(uint32_t maxSize);
+
+    /** propagate the trail of the worker by scanning occurrence lists, does not use the clause ignore
+     * @return false, if a conflict has been found
+     */
+    bool workerPropagate(ProbeWorker& worker, const Riss::CRef ignore = Riss::CRef_Undef);
+
+    /** probe both polarities of v with the private assignment of the worker */
+    void workerProbe(ProbeWorker& worker, const Riss::Var v);
+
+    /** add a unit to the top level of the private assignment of the worker */
+    void workerUnit(ProbeWorker& worker, const Riss::Lit& l);
+
+    /** vivify the given clause with the private assignment of the worker */
+    void workerVivify(ProbeWorker& worker, const Riss::CRef ref);
+
+    /** replace the clause by the sub clause whose negated literals are stored in data.lits */
+    void replaceVivifiedClause(const Riss::CRef ref);
+
     /** add all clauses to solver object -- code taken from @see Preprocessor::reSetupSolver, but without deleting clauses */
     void reSetupSolver();
 
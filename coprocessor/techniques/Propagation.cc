@@ -43,7 +43,7 @@ lbool Propagation::process(CoprocessorData& data, bool sort, Heap<VarOrderBVEHea
         DOUT(if (config.up_debug_out > 0) cerr << "c UP propagating " << l << endl;);
         data.log.log(upLevel, "propagate literal", l);
         // remove positives
-        vector<CRef>& positive = data.list(l);
+        OccList& positive = data.list(l);
         for (int i = 0 ; i < positive.size(); ++i) {
 
             Clause& satisfied = ca[positive[i]];
@@ -60,11 +60,11 @@ lbool Propagation::process(CoprocessorData& data, bool sort, Heap<VarOrderBVEHea
             data.removedClause(positive[i], heap, false, ignore);
             // remove clauses from structures?
         }
-        vector<CRef>().swap(positive); // free physical space of positive
+        positive.release(); // free physical space of positive
 
         const Lit nl = ~l;
         int count = 0;
-        vector<CRef>& negative = data.list(nl);
+        OccList& negative = data.list(nl);
 
         for (int i = 0 ; i < negative.size(); ++i) {
             Clause& c = ca[ negative[i] ];
@@ -118,7 +118,7 @@ lbool Propagation::process(CoprocessorData& data, bool sort, Heap<VarOrderBVEHea
             }
         }
         // update formula data!
-        vector<CRef>().swap(negative); // free physical scace of negative
+        negative.release(); // free physical scace of negative
         data.removedLiteral(nl, count, heap, ignore);
         removedLiterals += count;
     }
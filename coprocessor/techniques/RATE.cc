@@ -1420,16 +1420,19 @@ void RATElimination::cleanSolver()
 {
     // clear all watches!
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     // clear all watches!
     for (int v = 0; v < solver.nVars(); v++)
         for (int s = 0; s < 2; s++) {
             solver.watches[ mkLit(v, s) ].clear();
+            solver.watchesBin[ mkLit(v, s) ].clear();
         }
 
     solver.learnts_literals = 0;
     solver.clauses_literals = 0;
     solver.watches.cleanAll();
+    solver.watchesBin.cleanAll();
 
     for (int i = 0 ; i < solver.learnts.size(); ++ i) {
         ca[ solver.learnts[i] ].sort();
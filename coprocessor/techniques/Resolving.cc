@@ -101,7 +101,7 @@ void Resolving::ternaryResolve()
     for (Var v  = 0; v < data.nVars(); ++v) {
         for (int p = 0 ; p < 2 ; ++ p) {
             const Lit l = mkLit(v, p == 1);
-            vector<CRef>& cls = data.list(l);
+            OccList& cls = data.list(l);
             int j = 0;
             for (int i = 0 ; i < cls.size(); ++ i) {
                 const Clause& c = ca[cls[i]];
@@ -287,7 +287,7 @@ bool Resolving::ordered_subsumes(const Clause& c, const vec<Lit>& other) const
     }
 }
 
-bool Resolving::hasDuplicate(vector<CRef>& list, const vec<Lit>& c)
+bool Resolving::hasDuplicate(OccList& list, const vec<Lit>& c)
 {
     for (int i = 0 ; i < list.size(); ++ i) {
         Clause& d = ca[list[i]];
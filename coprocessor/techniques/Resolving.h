@@ -44,7 +44,7 @@ class Resolving : public Technique<Resolving>
     void addRedundantBinaries();
 
     /** check whether this clause already exists in the occurence list */
-    bool hasDuplicate(std::vector< Riss::CRef >& list, const Riss::vec< Riss::Lit >& c);
+    bool hasDuplicate(OccList& list, const Riss::vec< Riss::Lit >& c);
 
     /**
     * expects c to contain v positive and d to contain v negative
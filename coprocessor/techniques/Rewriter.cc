@@ -178,7 +178,7 @@ bool Rewriter::rewriteImpl()
         for (int j = 0 ; j + 1 < chain.size(); ++ j) {
             const Lit l = ~chain[j];
             const Lit nextL = chain[j + 1];
-            vector<CRef>& ll = data.list(l);
+            OccList& ll = data.list(l);
             for (int k = 0 ; k < ll.size(); ++ k) {
                 Clause& c = ca[ ll[k] ];
                 if (c.can_be_deleted() || c.size() != 2) { continue; }   // to not care about these clauses!
@@ -225,7 +225,7 @@ bool Rewriter::rewriteImpl()
                     data.addExtensionToExtension(clsLits);
                     // this code is actually exactly the same as for the rewriting AMOS TODO have a extra method for this?!
                     DOUT(if (config.rew_debug_out > 1) cerr << endl << endl << "c replace " << l << " with (" << r1 << " and " << r2 << ")" << endl;);
-                    vector<CRef>& ll = data.list(l);
+                    OccList& ll = data.list(l);
                     for (int k = 0 ; k < ll.size(); ++ k) {
                         Clause& c = ca[ ll[k] ];
                         assert(c.size() > 1 && "there should not be unit clauses!");
@@ -336,7 +336,7 @@ bool Rewriter::rewriteImpl()
                 const Lit nr1 = half == 0 ? newXn : newXp;      // replace with this literal
                 const Lit nr2 = ~data.lits[j];  // replace with this literal, always nr2 > nr1!!
                 DOUT(if (config.rew_debug_out > 1) cerr << endl << endl << "c replace " << nl << " with (" << nr1 << " lor " << nr2 << ")" << endl;);
-                vector<CRef>& nll = data.list(nl);
+                OccList& nll = data.list(nl);
                 for (int k = 0 ; k < nll.size(); ++ k) {
                     Clause& c = ca[ nll[k] ];
                     assert(c.size() > 1 && "there should not be unit clauses!");
@@ -697,7 +697,7 @@ bool Rewriter::rewriteAMO()
             int count = 0;
             for (int j = 0 ; j < amo.size(); ++ j) {
                 const Lit l = ~amo[j];
-                vector<CRef>& ll = data.list(l);
+                OccList& ll = data.list(l);
                 DOUT(if (config.rew_debug_out > 0) cerr << "c check literal " << l << "[" << ll.size() << "]" << endl;);
                 for (int k = 0 ; k < ll.size(); ++ k) {
                     Clause& c = ca[ ll[k] ];
@@ -751,7 +751,7 @@ bool Rewriter::rewriteAMO()
                         data.addExtensionToExtension(clsLits);
                         //
                         DOUT(if (config.rew_debug_out > 1) cerr << endl << endl << "c replace " << l << " with (" << r1 << " and " << r2 << ")" << endl;);
-                        vector<CRef>& ll = data.list(l);
+                        OccList& ll = data.list(l);
                         for (int k = 0 ; k < ll.size(); ++ k) {
                             Clause& c = ca[ ll[k] ];
                             assert(c.size() > 1 && "there should not be unit clauses!");
@@ -866,7 +866,7 @@ bool Rewriter::rewriteAMO()
                     const Lit nr1 = half == 0 ? newXn : newXp;      // replace with this literal
                     const Lit nr2 = ~data.lits[j];  // replace with this literal, always nr2 > nr1!!
                     DOUT(if (config.rew_debug_out > 1) cerr << endl << endl << "c replace " << nl << " with (" << nr1 << " lor " << nr2 << ")" << endl;);
-                    vector<CRef>& nll = data.list(nl);
+                    OccList& nll = data.list(nl);
                     for (int k = 0 ; k < nll.size(); ++ k) {
                         Clause& c = ca[ nll[k] ];
                         assert(c.size() > 1 && "there should not be unit clauses!");
@@ -1146,7 +1146,7 @@ bool Rewriter::ordered_subsumes(const Clause& c, const vec<Lit>& other) const
 }
 
 // TODO: have a template here!
-bool Rewriter::hasDuplicate(vector<CRef>& list, const Clause& c)
+bool Rewriter::hasDuplicate(OccList& list, const Clause& c)
 {
     for (int i = 0 ; i < list.size(); ++ i) {
         Clause& d = ca[list[i]];
@@ -1179,7 +1179,7 @@ bool Rewriter::hasDuplicate(vector<CRef>& list, const Clause& c)
     return false;
 }
 
-bool Rewriter::hasDuplicate(vector<CRef>& list, const vec<Lit>& c)
+bool Rewriter::hasDuplicate(OccList& list, const vec<Lit>& c)
 {
     for (int i = 0 ; i < list.size(); ++ i) {
         Clause& d = ca[list[i]];
@@ -78,6 +78,7 @@ class Rewriter : public Technique<Rewriter>
     void destroy();
 
     void giveMoreSteps();
+    void getStepUsage(int64_t& _steps, int64_t& limit) const { _steps = steps; limit = rewLimit; }
 
   protected:
 
@@ -90,8 +91,8 @@ class Rewriter : public Technique<Rewriter>
     bool rewriteImpl() ;
 
     /** check whether the clause represented in the std::vector c has duplicates, and remove clauses that are subsumed by c */
-    bool hasDuplicate(std::vector<Riss::CRef>& list, const Riss::vec<Riss::Lit>& c);
-    bool hasDuplicate(std::vector<Riss::CRef>& list, const Riss::Clause& c);
+    bool hasDuplicate(OccList& list, const Riss::vec<Riss::Lit>& c);
+    bool hasDuplicate(OccList& list, const Riss::Clause& c);
 
     bool checkPush(Riss::vec<Riss::Lit>& ps, const Riss::Lit& l);
     bool ordered_subsumes(const Riss::Clause& c, const Riss::Clause& other) const;
@@ -36,6 +36,14 @@ void SLS::createRandomAssignment()
     }
 }
 
+void SLS::createAssignment(const vec<char>& phases)
+{
+    for (Var v = 0 ; v < data.nVars(); v++) {
+        if (v < phases.size() && phases[v] != 2) { varData[v].polarity = phases[v] == 0; }   // polarity of the solver is set, if the variable is false
+        else { varData[v].polarity = (rand() % 2 == 0 ? true : false); }
+    }
+}
+
 Lit SLS::heuristic()
 {
     // get a random clause:
@@ -85,10 +93,15 @@ Lit SLS::heuristic()
 }
 
 
-bool SLS::solve(const vec<CRef>& formula, uint64_t stepLimit)
+bool SLS::formulaTooLarge()
+{
+    return !data.unlimited() && (data.nVars() > config.opt_sls_vars && data.getClauses().size() + data.getLEarnts().size() > config.opt_sls_cls) && data.nTotLits() > config.opt_sls_lits;
+}
+
+bool SLS::solve(const vec<CRef>& formula, uint64_t stepLimit, const vec<char>* startPhases)
 {
     // do not simplify, if the formula is considered to be too large!
-    if (!data.unlimited() && (data.nVars() > config.opt_sls_vars && data.getClauses().size() + data.getLEarnts().size() > config.opt_sls_cls) && data.nTotLits() > config.opt_sls_lits) { return false; }
+    if (formulaTooLarge()) { return false; }
 
     MethodTimer mt(&solveTime);
 
@@ -105,7 +118,8 @@ bool SLS::solve(const vec<CRef>& formula, uint64_t stepLimit)
     occ.resize(data.nVars() * 2);
     for (int i = 0 ; i < occ.size(); ++ i) { occ[i].clear(); }
 
-    createRandomAssignment();
+    if (startPhases != 0) { createAssignment(*startPhases); }
+    else { createRandomAssignment(); }
 
     int minSize = -1;
     int maxSize = -1; // TODO: detect k -sat, adtopt flips with nr of clauses!
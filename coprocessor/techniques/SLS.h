@@ -25,9 +25,13 @@ class SLS : public Technique<SLS>
 
     /** run sls algorithm on formula
     * @param model std::vector that can contain a model for the formula afterwards
+    * @param startPhases initial assignment, stored like solver polarities (1 = false), a random assignment is used if 0
     * @return true, if a model has been found
     */
-    bool solve(const Riss::vec< Riss::CRef >& formula, uint64_t stepLimit);
+    bool solve(const Riss::vec< Riss::CRef >& formula, uint64_t stepLimit, const Riss::vec<char>* startPhases = 0);
+
+    /** return true, if the formula is too large to run sls on it with the current limits */
+    bool formulaTooLarge();
 
     /** if search succeeded, return polarity for variable v (1 = positive, -1 = negative) */
     char getModelPolarity(const Riss::Var v) { return varData[v].polarity ? -1 : 1; }
@@ -111,6 +115,10 @@ class SLS : public Technique<SLS>
     */
     void createRandomAssignment();
 
+    /** fill the assignment with the given phases (1 = false), variables without phase get a random value
+    */
+    void createAssignment(const Riss::vec<char>& phases);
+
     unsigned unsats;
 };
 
@@ -258,7 +258,7 @@ void Subsumption :: subsumption_worker(unsigned int start, unsigned int end, Hea
                 min = c[l];
             }
         }
-        vector<CRef>& list = data.list(min);
+        OccList& list = data.list(min);
         for (unsigned i = 0; i < list.size()
                 && (data.unlimited() || (doStatistics && subsumptionStepper.inLimit()))
                 ; ++i) {
@@ -341,21 +341,15 @@ void Subsumption :: subsumption_worker(unsigned int start, unsigned int end, Hea
  * @param set_non_learnt this clauses, if not deleted, need to be set non-learnt afterwards
  * @param stats          local stats
  */
-void Subsumption :: par_subsumption_worker(unsigned int& next_start, unsigned int global_end, SpinLock& balancerLock, vector<CRef>& to_delete, vector< CRef >& set_non_learnt, struct SubsumeStatsData& stats, const bool doStatistics)
+void Subsumption :: par_subsumption_worker(RangeScheduler& work, unsigned worker, vector<CRef>& to_delete, vector< CRef >& set_non_learnt, struct SubsumeStatsData& stats, const bool doStatistics)
 {
     unsigned start = 0, end = 0;
     if (doStatistics) {
         stats.processTime = wallClockTime() - stats.processTime;
     }
-    while (global_end > next_start &&  !data.isInterupted()
-            && (data.unlimited() || (doStatistics && subsumptionStepper.inLimit(stats.subsumeSteps)))) {
-        balancerLock.lock();
-        if (global_end > next_start) {
-            start = next_start;
-            next_start += chunk_size;
-            end   = next_start > global_end ? global_end : next_start;
-        }
-        balancerLock.unlock();
+    while (!data.isInterupted()
+            && (data.unlimited() || (doStatistics && subsumptionStepper.inLimit(stats.subsumeSteps)))
+            && work.next(worker, start, end)) {
         while (end > start && !data.isInterupted()
                 && (data.unlimited() || (doStatistics && subsumptionStepper.inLimit(stats.subsumeSteps)))) {
             --end;
@@ -373,7 +367,7 @@ void Subsumption :: par_subsumption_worker(unsigned int& next_start, unsigned in
                     min = c[l];
                 }
             }
-            vector<CRef>& list = data.list(min);
+            OccList& list = data.list(min);
             for (unsigned i = 0; i < list.size(); ++i) {
 
                 if (list[i] == cr) {
@@ -442,7 +436,7 @@ void Subsumption :: par_subsumption_worker(unsigned int& next_start, unsigned in
  * @param var_lock vector of locks for each variable
  *
  */
-void Subsumption::par_strengthening_worker(unsigned int& next_start, unsigned int global_stop, SpinLock& balancerLock, vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, vector< OccUpdate >& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
+void Subsumption::par_strengthening_worker(RangeScheduler& work, unsigned worker, vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, vector< OccUpdate >& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
 {
     unsigned int start = 0, stop = 0;
     assert(start <= stop && stop <= data.getStrengthClauses().size() && "invalid indices");
@@ -453,14 +447,7 @@ void Subsumption::par_strengthening_worker(unsigned int& next_start, unsigned in
     deque<CRef> localQueue; // keep track of all clauses that have been added back to the strengthening queue because they have been strengthened
     SpinLock& data_lock = var_lock[data.nVars()];
 
-    while (global_stop > next_start && data.ok() && !data.isInterupted()) {
-        balancerLock.lock();
-        if (global_stop > next_start) {
-            start = next_start;
-            next_start += chunk_size;
-            stop   = next_start > global_stop ? global_stop : next_start;
-        }
-        balancerLock.unlock();
+    while (data.ok() && !data.isInterupted() && work.next(worker, start, stop)) {
 
         while (stop > start && data.ok() && !data.isInterupted()) {
             CRef cr = CRef_Undef;
@@ -513,8 +500,8 @@ void Subsumption::par_strengthening_worker(unsigned int& next_start, unsigned in
                 Lit neg = ~(c[l]);
                 c[l] = neg;
                 //use minimal list, or the negated list if  min == c[l]
-                vector< CRef>& list = (neg == ~min) ? data.list(neg) : data.list(min);
-                // vector< CRef> & list = data.list(neg);
+                OccList& list = (neg == ~min) ? data.list(neg) : data.list(min);
+                // OccList& list = data.list(neg);
                 for (int l_cr = 0; l_cr < list.size(); ++l_cr) {
                     if (list[l_cr] == cr) {
                         continue;
@@ -645,7 +632,7 @@ void Subsumption::par_strengthening_worker(unsigned int& next_start, unsigned in
  * @param end where to stop strengthening
  * @param var_lock vector of locks for each variable
  */
-void Subsumption::par_nn_strengthening_worker(unsigned int& next_start, unsigned int global_end, SpinLock& balancerLock, vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, vector<OccUpdate>& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
+void Subsumption::par_nn_strengthening_worker(RangeScheduler& work, unsigned worker, vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, vector<OccUpdate>& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
 {
     unsigned int start = 0, end = 0;
     assert(start <= end && end <= data.getStrengthClauses().size() && "invalid indices");
@@ -657,15 +644,9 @@ void Subsumption::par_nn_strengthening_worker(unsigned int& next_start, unsigned
     deque<CRef> localQueue; // keep track of all clauses that have been added back to the strengthening queue because they have been strengthened
     SpinLock& data_lock = var_lock[data.nVars()];
 
-    while (global_end > next_start && !data.isInterupted()
-            && (data.unlimited() || (doStatistics && strengtheningStepper.inLimit(stats.strengthSteps)))) {
-        balancerLock.lock();
-        if (global_end > next_start) {
-            start = next_start;
-            next_start += chunk_size;
-            end   = next_start > global_end ? global_end : next_start;
-        }
-        balancerLock.unlock();
+    while (!data.isInterupted()
+            && (data.unlimited() || (doStatistics && strengtheningStepper.inLimit(stats.strengthSteps)))
+            && work.next(worker, start, end)) {
         while (end > start && !data.isInterupted()
                 && (data.unlimited() || (doStatistics && strengtheningStepper.inLimit(stats.strengthSteps)))) {
             if (!data.ok()) {
@@ -744,8 +725,8 @@ void Subsumption::par_nn_strengthening_worker(unsigned int& next_start, unsigned
                 nmin = ~minT;
             }
             assert(min != nmin && "min and nmin should be different");
-            vector<CRef>& list = data.list(min);        // occurrences of minlit from strengthener
-            vector<CRef>& list_neg = data.list(nmin);   // occurrences of negated minlit from strengthener
+            OccList& list = data.list(min);        // occurrences of minlit from strengthener
+            OccList& list_neg = data.list(nmin);   // occurrences of negated minlit from strengthener
 
             if (l_False == par_nn_strength_check(data, list, localQueue,  strengthener, cr, fst, var_lock, stats, occ_updates, heap, ignore, doStatistics)) {
                 var_lock[fst].unlock();
@@ -787,7 +768,7 @@ void Subsumption::par_nn_strengthening_worker(unsigned int& next_start, unsigned
  * @param var_lock      lock for each variable
  *
  */
-inline lbool Subsumption::par_nn_strength_check(CoprocessorData& data, vector < CRef >& list, deque<CRef>& localQueue, Clause& strengthener, CRef cr, Var fst, vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, vector< OccUpdate>& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
+inline lbool Subsumption::par_nn_strength_check(CoprocessorData& data, OccList& list, deque<CRef>& localQueue, Clause& strengthener, CRef cr, Var fst, vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, vector< OccUpdate>& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
 {
     int si, so;           // indices used for "can be strengthened"-testing
     int negated_lit_pos;  // index of negative lit, if we find one
@@ -929,7 +910,7 @@ inline lbool Subsumption::par_nn_strength_check(CoprocessorData& data, vector <
  * @param var_lock      lock for each variable
  *
  */
-inline lbool Subsumption::par_nn_negated_strength_check(CoprocessorData& data, vector < CRef >& list, deque<CRef>& localQueue, Clause& strengthener, CRef cr, Lit min, Var fst, vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, vector< OccUpdate>& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
+inline lbool Subsumption::par_nn_negated_strength_check(CoprocessorData& data, OccList& list, deque<CRef>& localQueue, Clause& strengthener, CRef cr, Lit min, Var fst, vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, vector< OccUpdate>& occ_updates, Heap<VarOrderBVEHeapLt> * heap, const Var ignore, const bool doStatistics)
 {
     int si, so;           // indices used for "can be strengthened"-testing
     int negated_lit_pos;  // index of negative lit, if we find one
@@ -1061,7 +1042,7 @@ lbool Subsumption::fullStrengthening(Heap<VarOrderBVEHeapLt> * heap, const Var i
     for( int pos = 0 ; pos < 2; ++ pos )
     {
        //find lit with minimal occurrences
-       vector<CRef>& list = pos == 0 ? data.list(min) :  data.list(~min);
+       OccList& list = pos == 0 ? data.list(min) :  data.list(~min);
     }
      */
     if (config.opt_sub_allStrengthRes > 0 || !config.opt_sub_naivStrength) {
@@ -1105,8 +1086,8 @@ lbool Subsumption::fullStrengthening(Heap<VarOrderBVEHeapLt> * heap, const Var i
             // negate this literal and check for subsumptions for every occurrence of its negation:
             Lit neg_lit = ~c[j];
             c[j] = neg_lit;     // temporarily change lit for subsumptiontest
-            vector<CRef>& list = (neg_lit == ~min) ? data.list(neg_lit) : data.list(min);   // get occurrences of this lit
-            //vector<CRef> & list = data.list(neg_lit);  // get occurrences of this lit
+            OccList& list = (neg_lit == ~min) ? data.list(neg_lit) : data.list(min);   // get occurrences of this lit
+            //OccList& list = data.list(neg_lit);  // get occurrences of this lit
             for (unsigned int k = 0; k < list.size()
                     && (data.unlimited() || (doStatistics && strengtheningStepper.inLimit()))
                     ; ++k) {
@@ -1319,8 +1300,8 @@ lbool Subsumption::strengthening_worker(unsigned int start, unsigned int end, He
 
         assert(min != nmin && "min and nmin should be different");
 
-        vector<CRef>& list = data.list(min);        // occurrences of minlit from strengthener
-        vector<CRef>& list_neg = data.list(nmin);   // occurrences of negated minlit from strengthener
+        OccList& list = data.list(min);        // occurrences of minlit from strengthener
+        OccList& list_neg = data.list(nmin);   // occurrences of negated minlit from strengthener
         // test every clause, where the minimum is, if it can be strenghtened
         for (unsigned int j = 0; j < list.size()
                 && !data.isInterupted()
@@ -1569,19 +1550,18 @@ void Subsumption::parallelSubsumption(const bool doStatistics)
     nonLearnts.resize(controller.size());
     localStats.resize(controller.size());
     unsigned int queueSize = data.getSubsumeClauses().size();
-    unsigned int next_start = 0;
 
-    // Setting Chunk Size
-    chunk_size = queueSize > config.opt_sub_chunk_size * controller.size() * 1.8 ? config.opt_sub_chunk_size : (queueSize / controller.size());
+    // Setting Chunk Size, each thread starts with its own part of the queue, and steals from the others once it is done
+    chunk_size = queueSize > config.opt_sub_chunk_size * controller.size() * 1.8 ? config.opt_sub_chunk_size : (queueSize / (4 * controller.size()));
     if (chunk_size <= 0) { chunk_size = 1; }
+    RangeScheduler work(controller.size(), 0, queueSize, chunk_size);
 
     // setup data for workers
     for (int i = 0 ; i < controller.size(); ++ i) {
         workData[i].subsumption = this;
         workData[i].data  = &data;
-        workData[i].start = & next_start;
-        workData[i].end   = queueSize;
-        workData[i].balancerLock = & balancerLock;
+        workData[i].work  = &work;
+        workData[i].worker = i;
         workData[i].to_delete = & toDeletes[i];
         workData[i].set_non_learnt = & nonLearnts[i];
         workData[i].stats = & localStats[i];
@@ -1621,7 +1601,7 @@ void Subsumption::parallelSubsumption(const bool doStatistics)
 void* Subsumption::runParallelSubsume(void* arg)
 {
     SubsumeWorkData* workData = (SubsumeWorkData*) arg;
-    workData->subsumption->par_subsumption_worker(*(workData->start), workData->end, *(workData->balancerLock), *(workData->to_delete), *(workData->set_non_learnt), *(workData->stats));
+    workData->subsumption->par_subsumption_worker(*(workData->work), workData->worker, *(workData->to_delete), *(workData->set_non_learnt), *(workData->stats));
     return 0;
 }
 
@@ -1638,18 +1618,16 @@ void Subsumption::parallelStrengthening(Heap<VarOrderBVEHeapLt> * heap, const Va
     var_locks.resize(data.nVars() + 1); // 1 extra SpinLock for data
     occ_updates.resize(controller.size());
     unsigned int queueSize = data.getStrengthClauses().size();
-    unsigned int next_start = 0;
 
-    // Setting Chunk Size
-    chunk_size = queueSize > config.opt_sub_chunk_size * controller.size() * 1.8 ? config.opt_sub_chunk_size : (queueSize / controller.size());
+    // Setting Chunk Size, each thread starts with its own part of the queue, and steals from the others once it is done
+    chunk_size = queueSize > config.opt_sub_chunk_size * controller.size() * 1.8 ? config.opt_sub_chunk_size : (queueSize / (4 * controller.size()));
     if (chunk_size <= 0) { chunk_size = 1; }
+    RangeScheduler work(controller.size(), 0, queueSize, chunk_size);
 
     for (int i = 0 ; i < controller.size(); ++ i) {
         workData[i].subsumption = this;
-        workData[i].start = & next_start;
-        workData[i].end   = queueSize;
-        workData[i].balancerLock = & balancerLock;
-        //cerr << "c p s thread " << i << " running from " << *(workData[i].start) << " to " << workData[i].end << endl;
+        workData[i].work  = &work;
+        workData[i].worker = i;
         workData[i].data  = &data;
         workData[i].var_locks = & var_locks;
         /*    localStats[i].removedLiterals = 0;
@@ -1684,8 +1662,8 @@ void Subsumption::parallelStrengthening(Heap<VarOrderBVEHeapLt> * heap, const Va
 void* Subsumption::runParallelStrengthening(void* arg)
 {
     SubsumeWorkData* workData = (SubsumeWorkData*) arg;
-    if (workData->config->opt_sub_naivStrength) { workData->subsumption->par_strengthening_worker(*(workData->start), workData->end, *(workData->balancerLock), *(workData->var_locks), *(workData->stats), *(workData->occ_updates), workData->heap, workData->ignore); }
-    else { workData->subsumption->par_nn_strengthening_worker(*(workData->start), workData->end, *(workData->balancerLock), *(workData->var_locks), *(workData->stats), *(workData->occ_updates), workData->heap, workData->ignore); }
+    if (workData->config->opt_sub_naivStrength) { workData->subsumption->par_strengthening_worker(*(workData->work), workData->worker, *(workData->var_locks), *(workData->stats), *(workData->occ_updates), workData->heap, workData->ignore); }
+    else { workData->subsumption->par_nn_strengthening_worker(*(workData->work), workData->worker, *(workData->var_locks), *(workData->stats), *(workData->occ_updates), workData->heap, workData->ignore); }
     return 0;
 }
 
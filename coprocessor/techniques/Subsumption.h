@@ -74,7 +74,6 @@ class Subsumption : public Technique<Subsumption>
     // Member var seq strength
     std::vector < OccUpdate > strength_occ_updates;
     // Member vars parallel Subsumption
-    SpinLock balancerLock;
     std::vector< std::vector < Riss::CRef > > toDeletes;
     std::vector< std::vector < Riss::CRef > > nonLearnts;
     std::vector< struct SubsumeStatsData > localStats;
@@ -113,6 +112,12 @@ class Subsumption : public Technique<Subsumption>
 
     void giveMoreSteps();
 
+    void getStepUsage(int64_t& steps, int64_t& limit) const
+    {
+        steps = subsumptionStepper.getCurrentSteps() + strengtheningStepper.getCurrentSteps();
+        limit = subsumptionStepper.getCurrentLimit() + strengtheningStepper.getCurrentLimit();
+    }
+
   protected:
 
     inline void updateOccurrences(std::vector< Coprocessor::Subsumption::OccUpdate >& updates, Riss::Heap< Coprocessor::VarOrderBVEHeapLt >* heap, const Riss::Var ignore = (-1));
@@ -120,26 +125,25 @@ class Subsumption : public Technique<Subsumption>
     bool hasToSubsume() const ;       // return whether there is something in the subsume queue
     Riss::lbool fullSubsumption(Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);   // performs subsumtion until completion
     void subsumption_worker(unsigned int start, unsigned int end, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);  // subsume certain set of elements of the processing queue, does not write to the queue
-    void par_subsumption_worker(unsigned int& next_start, unsigned int global_end, SpinLock& balancerLock, std::vector<Riss::CRef>& to_delete, std::vector< Riss::CRef >& set_non_learnt, struct SubsumeStatsData& stats, const bool doStatistics = true);
+    void par_subsumption_worker(Riss::RangeScheduler& work, unsigned worker, std::vector<Riss::CRef>& to_delete, std::vector< Riss::CRef >& set_non_learnt, struct SubsumeStatsData& stats, const bool doStatistics = true);
 
     bool hasToStrengthen() const ;    // return whether there is something in the strengthening queue
 
     Riss::lbool fullStrengthening(Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);  // performs strengthening until completion, puts clauses into subsumption queue
     Riss::lbool strengthening_worker(unsigned int start, unsigned int end, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, bool doStatistics = true);
     Riss::lbool createResolvent(const Riss::CRef& cr, Riss::CRef& resolvent, const int negated_lit_pos, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
-    void par_strengthening_worker(unsigned int& next_start, unsigned int global_stop, SpinLock& balancerLock, std::vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
-    void par_nn_strengthening_worker(unsigned int& next_start, unsigned int global_end, SpinLock& balancerLock, std::vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
-    inline Riss::lbool par_nn_strength_check(CoprocessorData& data, std::vector < Riss::CRef >& list, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Var fst, std::vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true) ;
-    inline Riss::lbool par_nn_negated_strength_check(CoprocessorData& data, std::vector < Riss::CRef >& list, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Lit min, Riss::Var fst, std::vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
+    void par_strengthening_worker(Riss::RangeScheduler& work, unsigned worker, std::vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
+    void par_nn_strengthening_worker(Riss::RangeScheduler& work, unsigned worker, std::vector< SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
+    inline Riss::lbool par_nn_strength_check(CoprocessorData& data, OccList& list, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Var fst, std::vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true) ;
+    inline Riss::lbool par_nn_negated_strength_check(CoprocessorData& data, OccList& list, std::deque<Riss::CRef>& localQueue, Riss::Clause& strengthener, Riss::CRef cr, Riss::Lit min, Riss::Var fst, std::vector < SpinLock >& var_lock, struct SubsumeStatsData& stats, std::vector<OccUpdate>& occ_updates, Riss::Heap<VarOrderBVEHeapLt> * heap, const Riss::Var ignore = var_Undef, const bool doStatistics = true);
 
     /** data for parallel execution */
     struct SubsumeWorkData {
         CP3Config*       config;      // configuration of CP3 instantiation
         Subsumption*     subsumption; // class with code
         CoprocessorData* data;        // formula and maintain lists
-        unsigned int *   start;       // partition of the queue
-        unsigned int     end;
-        SpinLock *       balancerLock;
+        Riss::RangeScheduler* work;   // distributes the queue among the threads
+        unsigned int     worker;      // index of this thread in the scheduler
         std::vector<SpinLock> * var_locks;
         std::vector<Riss::CRef>*    to_delete;
         std::vector<Riss::CRef>*    set_non_learnt;
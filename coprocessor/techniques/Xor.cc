@@ -304,7 +304,7 @@ bool XorReasoning::simulatePropagate(vector< Lit >& unitQueue, MarkArray& ma, ve
         }
 
         // propagate on clauses here
-        vector<CRef>& negative = data.list(~p);
+        OccList& negative = data.list(~p);
         for (int i = 0 ; i < negative.size(); ++i) {
             Clause& c = ca[ negative[i] ];
             //what if c can be deleted? -> continue
@@ -573,7 +573,7 @@ bool XorReasoning::findXor(vector<GaussXor>& xorList)
                         DOUT(if (config.opt_xor_debug > 3) cerr << "c [XOR] look for variable " << cv + 1 << endl;);
                         for (uint32_t p = 0 ; p < 2; ++ p) {   // polarity!
                             const Lit current = mkLit(cv, p != 0);   // 0 -> POS, 1 -> NEG
-                            vector<CRef>& cls = data.list(current); // clause list of literal that is currently checked!
+                            OccList& cls = data.list(current); // clause list of literal that is currently checked!
                             for (uint32_t k = 0 ; k < cls.size(); ++ k) {
                                 const Clause& cclause = ca[cls[k]];
                                 if (cls[k] == data.clss[offset]) { continue; }   // do not consider the same clause twice!
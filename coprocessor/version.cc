@@ -0,0 +1,11 @@
+/*
+ * This file was created automatically. Do not change it.
+ * If you want to distribute the source code without
+ * git, make sure you include this file in your bundle.
+ */
+#include "coprocessor/version.h"
+
+const char* Coprocessor::gitSHA1            = "88d8a45-dirty";
+const char* Coprocessor::gitDate            = "Sun Oct 18 05:00:38 2026";
+const char* Coprocessor::coprocessorVersion = "7.1.0";
+const char* Coprocessor::signature          = "coprocessor 7.1.0 build 88d8a45-dirty";
@@ -0,0 +1,142 @@
+/*************************************************************************************[CubeQueue.h]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#ifndef RISS_CUBEQUEUE_H
+#define RISS_CUBEQUEUE_H
+
+#include <deque>
+#include <vector>
+
+#include "riss/core/SolverTypes.h"
+#include "riss/utils/LockCollection.h"
+
+namespace Riss
+{
+
+/** work queue of the cube-and-conquer mode of the portfolio solver
+ *
+ *  Each cube is a conjunction of literals, and all open and active cubes together cover the whole search space. A
+ *  worker takes a cube, and either refutes it, or splits it into two cubes that are solved later. Once there is
+ *  neither an open nor an active cube, all cubes have been refuted, and the formula is unsatisfiable.
+ */
+class CubeQueue
+{
+    SleepLock lock;                          // protects the queue, workers without a cube sleep on it
+    std::deque< std::vector<Lit> > cubes;    // cubes that have not been taken by a worker yet
+    int active;                              // number of cubes that are currently solved by some worker
+    bool aborted;                            // the search has been stopped, no more cubes are handed out
+
+  public:
+
+    uint64_t created, refuted, splits, maxSize; // statistics
+
+    CubeQueue() : active(0), aborted(false), created(0), refuted(0), splits(0), maxSize(0) {}
+
+    /** remove all cubes and statistics, before the next solve call */
+    void reset()
+    {
+        lock.lock();
+        cubes.clear();
+        active = 0;
+        aborted = false;
+        created = refuted = splits = maxSize = 0;
+        lock.unlock();
+    }
+
+    /** add a cube, before the workers are started */
+    void push(const vec<Lit>& cube)
+    {
+        lock.lock();
+        cubes.push_back(std::vector<Lit>(cube.size() == 0 ? nullptr : &cube[0], cube.size() == 0 ? nullptr : &cube[0] + cube.size()));
+        created ++;
+        maxSize = maxSize > (uint64_t)cube.size() ? maxSize : cube.size();
+        lock.unlock();
+    }
+
+    /** take the oldest open cube, sleep while other workers might still split their cubes
+     * @return false, if the search has been aborted, or if all cubes have been refuted
+     */
+    bool pop(vec<Lit>& cube)
+    {
+        lock.lock();
+        while (!aborted && cubes.empty() && active > 0) { lock.sleep(); }
+        if (aborted || cubes.empty()) {
+            lock.unlock();
+            return false;
+        }
+        cube.clear();
+        for (size_t i = 0 ; i < cubes.front().size(); ++ i) { cube.push(cubes.front()[i]); }
+        cubes.pop_front();
+        active ++;
+        lock.unlock();
+        return true;
+    }
+
+    /** the active cube of a worker has been refuted */
+    void refute()
+    {
+        lock.lock();
+        active --;
+        refuted ++;
+        lock.unlock();
+        lock.awake();   // the last refuted cube finishes the search
+    }
+
+    /** replace the active cube of a worker by the two cubes that extend it with split and ~split */
+    void split(const vec<Lit>& cube, const Lit& split)
+    {
+        lock.lock();
+        for (int polarity = 0 ; polarity < 2; ++ polarity) {
+            cubes.push_back(std::vector<Lit>(cube.size() == 0 ? nullptr : &cube[0], cube.size() == 0 ? nullptr : &cube[0] + cube.size()));
+            cubes.back().push_back(polarity == 0 ? split : ~split);
+        }
+        active --;
+        created += 2;
+        splits ++;
+        maxSize = maxSize > (uint64_t)cube.size() + 1 ? maxSize : cube.size() + 1;
+        lock.unlock();
+        lock.awake();
+    }
+
+    /** the active cube of a worker could not be split, put it back unchanged */
+    void giveBack(const vec<Lit>& cube)
+    {
+        lock.lock();
+        cubes.push_front(std::vector<Lit>(cube.size() == 0 ? nullptr : &cube[0], cube.size() == 0 ? nullptr : &cube[0] + cube.size()));
+        active --;
+        lock.unlock();
+        lock.awake();
+    }
+
+    /** stop handing out cubes, and wake up all waiting workers */
+    void abort()
+    {
+        lock.lock();
+        aborted = true;
+        lock.unlock();
+        lock.awake();
+    }
+
+    /** return true, if all cubes have been refuted */
+    bool exhausted()
+    {
+        lock.lock();
+        const bool ret = !aborted && cubes.empty() && active == 0;
+        lock.unlock();
+        return ret;
+    }
+
+    /** number of cubes that have not been taken by a worker yet */
+    int open()
+    {
+        lock.lock();
+        const int ret = cubes.size();
+        lock.unlock();
+        return ret;
+    }
+};
+
+}
+
+#endif
@@ -77,6 +77,9 @@ static void SIGINT_exit(int signum)
     else { receivedInterupt = true; }
 }
 
+// Let all threads write a checkpoint at their next restart (see option -checkpoint)
+static void SIGUSR1_checkpoint(int signum) { solver->requestCheckpoint(); }
+
 
 //=================================================================================================
 // Main:
@@ -99,6 +102,8 @@ int main(int argc, char** argv)
     BoolOption   opt_modelStyle("MAIN", "oldModel",   "present model on screen in old format", false);
     BoolOption   opt_quiet("MAIN", "quiet",      "Do not print the model", false);
     BoolOption   opt_parseOnly("MAIN", "parseOnly", "abort after parsing", false);
+    IntOption    opt_parseThreads("MAIN", "parseThreads", "Threads to parse uncompressed input files (0=all cores, -1=stream parser only)", 0, IntRange(-1, 256));
+    StringOption opt_resume("MAIN", "resume", "continue the search from the checkpoints with the given prefix (see -checkpoint) instead of parsing the input", 0);
     StringOption opt_config("MAIN", "pconfig", "the configuration to be used for the portfolio solver", 0);
     BoolOption   opt_showParam("MAIN", "showUnusedParam", "print parameters after parsing", false);
     IntOption    opt_helpLevel("MAIN", "helpLevel", "Show only partial help.\n", -1, IntRange(-1, INT32_MAX));
@@ -145,6 +150,7 @@ int main(int argc, char** argv)
         // interrupts:
         signal(SIGINT, SIGINT_exit);
         signal(SIGXCPU, SIGINT_exit);
+        signal(SIGUSR1, SIGUSR1_checkpoint);
 
         // Set limit on CPU-time:
         if (cpu_lim != INT32_MAX) {
@@ -195,7 +201,12 @@ int main(int argc, char** argv)
         S.setDrupFile((drupFile) ? fopen((const char*) drupFile, "wb") : 0);
         if (opt_proofFormat && strlen(opt_proofFormat) > 0 && S.getDrupFile() != nullptr) { fprintf(S.getDrupFile(), "o proof %s\n", (const char*)opt_proofFormat); }     // we are writing proofs of the given format!
 
-        parse_DIMACS(in, S);
+        if (opt_resume) {   // the checkpoints replace the formula
+            if (S.getDrupFile() != nullptr) { printf("c ERROR: proofs cannot be continued from a checkpoint\n"), exit(1); }
+            S.resumeFromCheckpoint(string(opt_resume));
+        } else {
+            parse_DIMACS(argc == 1 ? nullptr : argv[1], in, S, opt_parseThreads);
+        }
         gzclose(in);
         FILE* res = (argc >= 3) ? fopen(argv[2], "wb") : nullptr;
 
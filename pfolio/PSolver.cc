@@ -4,7 +4,9 @@ Copyright (c) 2014-2015, Norbert Manthey, LGPL v2, see LICENSE
 #include "pfolio/PSolver.h"
 
 #include "coprocessor/Coprocessor.h"
+#include "riss/utils/BinaryCNF.h"
 #include <assert.h>
+#include <stdexcept>
 
 #include "riss/core/EnumerateMaster.h" // for model enumeration
 
@@ -29,6 +31,8 @@ PSolver::PSolver(Riss::PfolioConfig* externalConfig, const char* configName, int
     , initialized(false)
     , simplified(false)
     , killed(false)
+    , sharedArena(false)
+    , pendingSetups(0)
     , threads(pfolioConfig.threads)
     , winningSolver(-1)
     , globalSimplifierConfig(0)
@@ -39,6 +43,7 @@ PSolver::PSolver(Riss::PfolioConfig* externalConfig, const char* configName, int
     , opc(0)
     , modelMaster(nullptr)
     , defaultConfig((const char*) pfolioConfig.opt_defaultSetup == 0 ? "" : string(pfolioConfig.opt_defaultSetup))   // setup the configuration
+    , checkpointPrefix((const char*) pfolioConfig.opt_checkpoint == 0 ? "" : string(pfolioConfig.opt_checkpoint))
     , externBuffer(0)
     , externSpecialBuffer(0)
     , originalFormula(nullptr)
@@ -85,6 +90,7 @@ PSolver::PSolver(Riss::PfolioConfig* externalConfig, const char* configName, int
 
     // set preset configs here
     createThreadConfigs();
+    for (int t = 0 ; t < threads; ++ t) { configs[t].opt_checkpointEvery = pfolioConfig.opt_checkpointEvery; }
 
     // here, DRUP proofs are created!
     if (pfolioConfig.opt_internalProofCheck) {
@@ -243,9 +249,24 @@ Lit PSolver::trailGet(int index)
 
 void PSolver::interrupt()
 {
+    cubeQueue.abort();   // workers that wait for a cube stop as well
     for (int i = 0 ; i < solvers.size(); ++ i) {
         solvers[i]->interrupt();
     }
+    setupLock.awake();   // solver 0 does not wait for the setup of the other incarnations any more
+}
+
+void PSolver::requestCheckpoint()
+{
+    for (int i = 0 ; i < solvers.size(); ++ i) {
+        solvers[i]->requestCheckpoint();
+    }
+}
+
+void PSolver::resumeFromCheckpoint(const string& prefix)
+{
+    assert(!initialized && "resume only before the threads are initialized");
+    resumePrefix = prefix;
 }
 
 void PSolver::setConfBudget(int64_t x)
@@ -326,6 +347,11 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
     winningSolver = -1;
     lbool ret = l_Undef;
 
+    double setupStartTime = -1;   // wall clock time, when the incarnations are set up in this call
+    if (!initialized && resumePrefix.size() > 0) {  // the checkpoints replace the formula
+        if (!resumeThreads()) { return l_Undef; }
+    }
+
     if (!initialized) {   // check whether some solver wants to work on the original formula
         bool keepOriginal = false;
         for (int i = 1; i < threads; ++ i) { // iterate over threads, as we do not have solvers at the moment
@@ -385,62 +411,50 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
         /// if the first solver was not initialized due to simplification, set it up correctly before copying to the other incarnations
         if (!simplified) { solvers[0]->solve_(Solver::SolveCallType::initializeOnly); }
 
-        for (int i = 1; i < solvers.size(); ++ i) {
-
-            if (! configs[i].opt_useOriginal) {
-
-                solvers[i]->reserveVars(solvers[0]->nVars());
-                while (solvers[i]->nVars() < solvers[0]->nVars()) { solvers[i]->newVar(); }
-                communicators[i]->setFormulaVariables(solvers[0]->nVars());   // tell which variables can be shared
-
-                // pseudo clone solver incarnations
-                solvers[i]->addUnitClauses(solvers[0]->trail);   // copy all the unit clauses, adds to the proof
-                solvers[0]->ca.copyTo(solvers[i]->ca);             // have information about clauses
-                solvers[0]->clauses.copyTo(solvers[i]->clauses);   // copy clauses silently without the proof, no redundancy check required
-                solvers[0]->learnts.copyTo(solvers[i]->learnts);   // copy clauses silently without the proof, no redundancy check required
-                solvers[0]->activity.copyTo(solvers[i]->activity); // copy activity
-                solvers[0]->order_heap.copyOrderTo(solvers[i]->order_heap);   // rebuild order heap (use configuration of other heap, but use own acticities)
-                solvers[0]->varFlags.copyTo(solvers[i]->varFlags);
-                solvers[0]->vardata.copyTo(solvers[i]->vardata);
-
-                // attach all clauses
-                for (int j = 0 ; j < solvers[i]->clauses.size(); ++ j) {
-                    solvers[i]->attachClause(solvers[i]->clauses[j]);     // import the clause of solver 0 into solver i; does not add to the proof
-                }
-                for (int j = 0 ; j < solvers[i]->learnts.size(); ++ j) {
-                    solvers[i]->attachClause(solvers[i]->learnts[j]);     // import the clause of solver 0 into solver i; does not add to the proof
-                }
+        // instead of copying the clauses into each incarnation, all incarnations map the clauses of solver 0 copy on
+        // write, so that only the pages a thread writes to (e.g. to reorder literals) are duplicated
+        int arenaFile = -1;
+        if (pfolioConfig.opt_sharedArena) {
+            arenaFile = solvers[0]->ca.shareMemory("riss-clauses");
+            if (arenaFile >= 0 && !solvers[0]->ca.mapShared(arenaFile, solvers[0]->ca)) { close(arenaFile); arenaFile = -1; }
+            sharedArena = arenaFile >= 0;
+            if (verbosity > 0) { cerr << "c share clause arena of " << solvers[0]->ca.size() * ClauseAllocator::Unit_Size / (1024.0 * 1024.0) << " MB: " << (sharedArena ? "succeeded" : "failed") << endl; }
+        }
 
-                assert(! configs[i].opt_useOriginal && "run initializeOnly only if we are working with the simplified formula already");
-                solvers[i]->solve_(Solver::SolveCallType::initializeOnly);   // let solve initialize itself, if it does not want to perform the full solving process on its own
-            } else { // initialize based on original formula
-
-                communicators[i]->setDoSend(false);     // disable sending hard   // TODO might be disabled once sharing and simplification works nicely together
-                communicators[i]->setDoReceive(false);  // disable receiving hard // TODO might be disabled once sharing and simplification works nicely together
-
-                assert(originalFormula != nullptr && "had to be collected before");
-                solvers[i]->reserveVars(originalFormula->nVars);
-                while (solvers[i]->nVars() < originalFormula->nVars) { solvers[i]->newVar(); }
-                communicators[i]->setFormulaVariables(originalFormula->nVars);   // tell which variables can be shared
-
-                solvers[i]->addUnitClauses(originalFormula->trail);   // copy all the unit clauses, adds to the proof
-                originalFormula->ca.copyTo(solvers[i]->ca);             // have information about clauses
-                originalFormula->clauses.copyTo(solvers[i]->clauses);   // copy clauses silently without the proof, no redundancy check required
-                originalFormula->activity.copyTo(solvers[i]->activity); // copy activity
-                originalFormula->order_heap.copyOrderTo(solvers[i]->order_heap);   // rebuild order heap (use configuration of other heap, but use own acticities)
-                originalFormula->varFlags.copyTo(solvers[i]->varFlags);
-                originalFormula->vardata.copyTo(solvers[i]->vardata);
-
-                // attach all clauses
-                for (int j = 0 ; j < solvers[i]->clauses.size(); ++ j) {
-                    solvers[i]->attachClause(solvers[i]->clauses[j]);     // import the clause of solver 0 into solver i; does not add to the proof
-                }
+        // with parallel setup, each thread sets up its incarnation before it starts searching, and solver 0 waits until
+        // all incarnations copied its formula
+        pendingSetups = 0;
+        setupStartTime = wallClockTime();
+        for (int i = 1; i < solvers.size(); ++ i) {
+            const bool mapped = !configs[i].opt_useOriginal && arenaFile >= 0 && solvers[i]->ca.mapShared(arenaFile, solvers[0]->ca);
+            if (pfolioConfig.opt_parallelSetup) {
+                if (!configs[i].opt_useOriginal) { pendingSetups ++; }
+                bool failed = false;
+                communicators[i]->setupTask = [this, i, mapped, failed]() mutable -> bool {
+                    if (failed) { return false; }
+                    try {
+                        if (communicators[i]->isAborted()) { throw std::runtime_error("aborted before setup"); }
+                        setupIncarnation(i, mapped);
+                        return true;
+                    } catch (...) {   // e.g. out of memory, this incarnation does not search at all
+                        if (verbosity > 0) { cerr << "c setup of incarnation " << i << " failed" << endl; }
+                        failed = true;
+                        return false;
+                    }
+                };
+            } else {
+                setupIncarnation(i, mapped);
             }
-
-            if (verbosity > 1) { cerr << "c Solver[" << i << "] has " << solvers[i]->nVars() << " vars, " << solvers[i]->clauses.size() << " cls, " << solvers[i]->learnts.size() << " learnts" << endl; }
-            solvers[i]->setPreprocessor(&ppconfigs[i]); // tell solver incarnation about preprocessor
-
-            if (modelMaster != nullptr) { solvers[i]->setEnumnerationMaster(modelMaster); }
+        }
+        if (pendingSetups > 0) {   // solver 0 must not search, before the other incarnations copied its formula
+            communicators[0]->setupTask = [this]() -> bool {
+                setupLock.lock();
+                while (pendingSetups > 0 && !communicators[0]->isAborted() && !solvers[0]->interrupted()) { setupLock.sleep(); }
+                const bool copied = pendingSetups == 0;
+                setupLock.unlock();
+                if (copied) { reportSharedArena("after setup"); }
+                return copied;
+            };
         }
 
         // copy the formula of the solver 0 number of thread times
@@ -457,10 +471,14 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
             proofMaster->addUnitsToProof(solvers[0]->trail, 0, false);   // incorporate all the units once more
         }
 
+        if (arenaFile >= 0) { close(arenaFile); }   // the mappings keep the clauses alive
+        if (pendingSetups == 0) { reportSharedArena("after setup"); }   // otherwise, solver 0 reports once all threads copied its formula
+
+        setupCheckpoints();
 
         initialized = true;
 
-        if (originalFormula != nullptr) {
+        if (originalFormula != nullptr && !pfolioConfig.opt_parallelSetup) {
             delete originalFormula ;   // free resources again, as we initialized all incarnations now
             originalFormula = nullptr;
         }
@@ -483,16 +501,28 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
         // assumps.copyTo(communicators[i]->assumptions);
         communicators[i]->setFormulaVariables(solvers[i]->nVars());   // for incremental calls, no ER is supported, so that everything should be fine until here! Note: be careful with this!
         communicators[i]->setWinner(false);
-        assert((communicators[i]->isFinished() || communicators[i]->isWaiting()) && "all solvers should not touch anything!");
+        assert((communicators[i]->isFinished() || communicators[i]->isWaiting() || communicators[i]->isIdle()) && "all solvers should not touch anything!");
+    }
+
+    // cube-and-conquer: the incarnations solve the cubes of the queue under assumptions, instead of the whole formula,
+    // incarnations that work on the original formula or that simplify during search keep solving the whole formula
+    const bool cubeMode = pfolioConfig.opt_cubes > 0 && assumps.size() == 0 && proofMaster == 0 && modelMaster == nullptr;
+    if (cubeMode) { createCubes(); }
+    for (int i = 0 ; i < threads; ++i) {
+        if (cubeMode && !configs[i].opt_useOriginal && !ppconfigs[i].opt_inprocess) { communicators[i]->searchTask = [this, i]() { return solveCubes(i); }; }
+        else { communicators[i]->searchTask = nullptr; }
     }
 
     if (proofMaster != 0 && pfolioConfig.opt_verboseProof > 0) { proofMaster->addCommentToProof("c start all solvers", -1); }
+    const double searchStartTime = wallClockTime();
+    for (int i = 0 ; i < threads; ++i) { communicators[i]->firstConflictTime = -1; }
     start(); // allow all solvers to start,
     waitFor(oneFinished);   // and wait until the first solver finishes
 
     /* interrupt all other solvers
     * clear all interrupts (for incremental solving)
     */
+    cubeQueue.abort();
     for (int i = 0 ; i < threads; ++i) { solvers[i]->interrupt(); }
 
     // wait for the remaining threads to finish, and clear their interrupt again
@@ -501,6 +531,10 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
         assert(communicators[i]->isFinished() && "all solvers have to be finished");
         solvers[i]->resetLastSolve(); // clear state of the solver (jump to level 0, clear interrupt)
     }
+    if (originalFormula != nullptr) {   // the threads set up their incarnations from it
+        delete originalFormula;
+        originalFormula = nullptr;
+    }
 
     /*
     * determine the winning solver
@@ -511,6 +545,18 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
         if (communicators[i]->isWinner() && communicators[i]->getReturnValue() != l_Undef) { winningSolver = i; break; }
     }
 
+    if (verbosity > 0) {   // includes the setup of the incarnations, no matter whether the master or the threads set them up
+        double allThreads = 0;
+        cerr << "c time to first conflict per thread:";
+        for (int i = 0 ; i < threads; ++ i) {
+            if (communicators[i]->firstConflictTime < 0) { cerr << " -"; continue; }
+            const double seconds = communicators[i]->firstConflictTime - (setupStartTime < 0 ? searchStartTime : setupStartTime);
+            allThreads = seconds > allThreads ? seconds : allThreads;
+            cerr << " " << seconds;
+        }
+        cerr << " s, all threads: " << allThreads << " s" << endl;
+    }
+
     if (verbosity > 0) { if (verbosity > 0) { cerr << "c MASTER found winning thread (" << communicators[winningSolver]->isWinner() << ") as " << winningSolver << " / " << threads << " model= " << solvers[winningSolver]->model.size() << endl; } }
 
     // return model, if there is a winning thread!
@@ -579,6 +625,50 @@ lbool PSolver::solveLimited(const vec< Lit >& assumps)
                                         <<  "  dup-models: " << communicators[i]->getSolver()->enumerationClient.getDupModels()
                                         << endl;
         }
+        if (pfolioConfig.opt_feedbackTarget > 0) {   // what the receivers reported, and the minimal send limits that followed
+            cerr << "c thread  imported\t|\t useful\t|\t sendSize\t|\t sendLbd" << endl;
+            for (int i = 0 ; i < threads; ++ i) {
+                uint64_t imported = 0, useful = 0;
+                data->senderFeedback(i, imported, useful);
+                cerr << "c " << i << " : " << imported
+                     << "  \t|\t" << useful
+                     << "  \t|\t" << solvers[i]->communicationClient.sendSize
+                     << "  \t|\t" << solvers[i]->communicationClient.sendLbd << endl;
+            }
+        }
+        if (pfolioConfig.opt_dupFilter > 0) {   // clauses that have been shared already by some thread have been dropped
+            uint64_t hits = 0, misses = 0;
+            cerr << "c thread  dup-hits\t|\t dup-misses" << endl;
+            for (int i = 0 ; i < threads; ++ i) {
+                cerr << "c " << i << " : " << communicators[i]->nrDroppedDuplicates << "  \t|\t" << communicators[i]->nrSendCls << endl;
+                hits += communicators[i]->nrDroppedDuplicates;
+                misses += communicators[i]->nrSendCls;
+            }
+            cerr << "c duplicate filter: " << hits << " of " << hits + misses << " clauses dropped" << endl;
+        }
+        if (cubeMode) {
+            cerr << "c cubes: " << cubeQueue.created << " created, " << cubeQueue.refuted << " refuted, " << cubeQueue.splits << " splits, "
+                 << cubeQueue.maxSize << " max size, " << cubeQueue.open() << " open" << endl;
+        }
+        reportSharedArena("after search");
+    }
+
+    if (pfolioConfig.opt_commBench) {  // report the throughput of the ring buffers per thread
+        const double searchTime = wallClockTime() - searchStartTime;
+        cerr << "c ring buffer throughput (search wall time " << searchTime << " s):" << endl;
+        cerr << "c thread  writes\t|\t write-s\t|\t writes/s\t|\t too-large\t|\t reads\t|\t items\t|\t read-s\t|\t items/s" << endl;
+        for (int i = 0 ; i < threads; ++ i) {
+            const Communicator& c = *communicators[i];
+            cerr << "c " << i << " : " << c.nrBufferWrites
+                 <<  "  \t|\t" << c.bufferWriteTime
+                 <<  "  \t|\t" << (c.bufferWriteTime > 0 ? c.nrBufferWrites / c.bufferWriteTime : 0)
+                 <<  "  \t|\t" << c.nrDroppedLarge
+                 <<  "  \t|\t" << c.nrBufferReads
+                 <<  "  \t|\t" << c.nrBufferReadItems
+                 <<  "  \t|\t" << c.bufferReadTime
+                 <<  "  \t|\t" << (c.bufferReadTime > 0 ? c.nrBufferReadItems / c.bufferReadTime : 0)
+                 << endl;
+        }
     }
 
 
@@ -1036,6 +1126,8 @@ bool PSolver::initializeThreads()
         data = externalData;  // use the external data
     } else {
         data = new CommunicationData(privateConfig->opt_storageSize == 0 ? 4000 * threads : privateConfig->opt_storageSize);   // space for clauses, dynamic or static
+        data->initFeedback(threads);   // receivers tell the senders which clauses have been useful
+        if (pfolioConfig.opt_dupFilter > 0) { data->getBuffer().enableFilter(pfolioConfig.opt_dupFilter); }   // do not share a clause twice
     }
 
     // communicate with external data pool, if there are links present
@@ -1079,6 +1171,9 @@ bool PSolver::initializeThreads()
         communicators[i]->checkLiterals = pfolioConfig.opt_checkLiterals;
         communicators[i]->useDynamicLimits = pfolioConfig.opt_useDynamicLimits;
         communicators[i]->sendEquivalences = pfolioConfig.opt_sendEquivalences;
+        communicators[i]->feedbackTarget = pfolioConfig.opt_feedbackTarget;
+        communicators[i]->feedbackChange = pfolioConfig.opt_feedbackChange;
+        communicators[i]->feedbackInterval = pfolioConfig.opt_feedbackInterval;
         // could set receiveEquivalences here, but that should be more up to the actual solver configurations
 
         // setup thread specific settings
@@ -1109,6 +1204,7 @@ bool PSolver::initializeThreads()
 
         if (! pfolioConfig.opt_share) { communicators[i]->setDoSend(false); }   // no sending
         if (!pfolioConfig.opt_receive) { communicators[i]->setDoReceive(false); }  // no sending
+        communicators[i]->measureThroughput = pfolioConfig.opt_commBench;
 
         // tell the communicator about the proof master
         communicators[i]->setProofMaster(proofMaster);
@@ -1137,6 +1233,177 @@ bool PSolver::initializeThreads()
     return failed;
 }
 
+bool PSolver::resumeThreads()
+{
+    // the model of solver 0 is extended with the undo information of the global simplification as usual
+    const string globalFile = resumePrefix + ".global";
+    if (BinaryCNF::isBinaryCNFFile(globalFile)) {
+        globalSimplifierConfig = new Coprocessor::CP3Config(defaultSimplifierConfig.c_str());
+        globalSimplifier = new Coprocessor::Preprocessor(solvers[0], *globalSimplifierConfig, threads);
+        if (!globalSimplifier->parseBinaryUndoInfo(globalFile)) { return false; }
+    }
+    simplified = true;
+
+    if (initializeThreads()) { return false; }
+
+    for (int i = 0; i < threads; ++ i) {
+        if (i > 0) { solvers[i]->setPreprocessor(&ppconfigs[i]); }  // the checkpoint might contain undo information for the preprocessor
+        if (!solvers[i]->readCheckpoint((resumePrefix + "." + std::to_string(i)).c_str())) { return false; }
+        communicators[i]->setFormulaVariables(solvers[i]->nVars());
+        if (configs[i].opt_useOriginal) {   // as during the usual initialization, such a thread does not share
+            communicators[i]->setDoSend(false);
+            communicators[i]->setDoReceive(false);
+        } else {
+            solvers[i]->solve_(Solver::SolveCallType::initializeOnly);
+        }
+    }
+
+    setupCheckpoints();
+    initialized = true;
+    if (verbosity > 0) { cerr << "c resumed " << threads << " threads from checkpoint " << resumePrefix << endl; }
+    return true;
+}
+
+void PSolver::setupIncarnation(int i, bool mapped)
+{
+    /** tells solver 0 that this incarnation does not read its formula any more, also if copying fails */
+    struct CopyGuard {
+        PSolver* solver;
+        bool pending;
+        CopyGuard(PSolver* s, bool p) : solver(s), pending(p) {}
+        ~CopyGuard() { finish(); }
+        void finish() { if (pending) { pending = false; solver->finishedCopying(); } }
+    } copying(this, pfolioConfig.opt_parallelSetup && !configs[i].opt_useOriginal);
+
+    if (! configs[i].opt_useOriginal) {
+
+        solvers[i]->reserveVars(solvers[0]->nVars());
+        while (solvers[i]->nVars() < solvers[0]->nVars()) { solvers[i]->newVar(); }
+        communicators[i]->setFormulaVariables(solvers[0]->nVars());   // tell which variables can be shared
+
+        // pseudo clone solver incarnations
+        solvers[i]->addUnitClauses(solvers[0]->trail);   // copy all the unit clauses, adds to the proof
+        if (!mapped) { solvers[0]->ca.copyTo(solvers[i]->ca); }   // have information about clauses
+        solvers[0]->clauses.copyTo(solvers[i]->clauses);   // copy clauses silently without the proof, no redundancy check required
+        solvers[0]->learnts.copyTo(solvers[i]->learnts);   // copy clauses silently without the proof, no redundancy check required
+        solvers[0]->activity.copyTo(solvers[i]->activity); // copy activity
+        solvers[0]->order_heap.copyOrderTo(solvers[i]->order_heap);   // rebuild order heap (use configuration of other heap, but use own acticities)
+        solvers[0]->varFlags.copyTo(solvers[i]->varFlags);
+        solvers[0]->vardata.copyTo(solvers[i]->vardata);
+        copying.finish();   // everything else is done on the data of this incarnation
+
+        // attach all clauses
+        for (int j = 0 ; j < solvers[i]->clauses.size(); ++ j) {
+            solvers[i]->attachClause(solvers[i]->clauses[j]);     // import the clause of solver 0 into solver i; does not add to the proof
+        }
+        for (int j = 0 ; j < solvers[i]->learnts.size(); ++ j) {
+            solvers[i]->attachClause(solvers[i]->learnts[j]);     // import the clause of solver 0 into solver i; does not add to the proof
+        }
+
+        assert(! configs[i].opt_useOriginal && "run initializeOnly only if we are working with the simplified formula already");
+        solvers[i]->solve_(Solver::SolveCallType::initializeOnly);   // let solve initialize itself, if it does not want to perform the full solving process on its own
+    } else { // initialize based on original formula
+
+        communicators[i]->setDoSend(false);     // disable sending hard   // TODO might be disabled once sharing and simplification works nicely together
+        communicators[i]->setDoReceive(false);  // disable receiving hard // TODO might be disabled once sharing and simplification works nicely together
+
+        assert(originalFormula != nullptr && "had to be collected before");
+        solvers[i]->reserveVars(originalFormula->nVars);
+        while (solvers[i]->nVars() < originalFormula->nVars) { solvers[i]->newVar(); }
+        communicators[i]->setFormulaVariables(originalFormula->nVars);   // tell which variables can be shared
+
+        solvers[i]->addUnitClauses(originalFormula->trail);   // copy all the unit clauses, adds to the proof
+        originalFormula->ca.copyTo(solvers[i]->ca);             // have information about clauses
+        originalFormula->clauses.copyTo(solvers[i]->clauses);   // copy clauses silently without the proof, no redundancy check required
+        originalFormula->activity.copyTo(solvers[i]->activity); // copy activity
+        originalFormula->order_heap.copyOrderTo(solvers[i]->order_heap);   // rebuild order heap (use configuration of other heap, but use own acticities)
+        originalFormula->varFlags.copyTo(solvers[i]->varFlags);
+        originalFormula->vardata.copyTo(solvers[i]->vardata);
+
+        // attach all clauses
+        for (int j = 0 ; j < solvers[i]->clauses.size(); ++ j) {
+            solvers[i]->attachClause(solvers[i]->clauses[j]);     // import the clause of solver 0 into solver i; does not add to the proof
+        }
+    }
+
+    if (verbosity > 1) { cerr << "c Solver[" << i << "] has " << solvers[i]->nVars() << " vars, " << solvers[i]->clauses.size() << " cls, " << solvers[i]->learnts.size() << " learnts" << endl; }
+    solvers[i]->setPreprocessor(&ppconfigs[i]); // tell solver incarnation about preprocessor
+
+    if (modelMaster != nullptr) { solvers[i]->setEnumnerationMaster(modelMaster); }
+}
+
+void PSolver::createCubes()
+{
+    cubeQueue.reset();
+    Solver& S = *solvers[0];
+    vec<Lit> cube;
+    cubeQueue.push(cube);   // the empty cube covers the whole formula
+    // breadth first, so that the cubes have a similar size, stop when all cubes are refuted
+    while (cubeQueue.open() < pfolioConfig.opt_cubes && cubeQueue.pop(cube)) {
+        Var split = var_Undef;
+        if (!S.lookaheadSplit(cube, pfolioConfig.opt_cubeCandidates, split)) { cubeQueue.refute(); }
+        else if (split == var_Undef) {   // all variables are assigned, nothing to split
+            cubeQueue.giveBack(cube);
+            break;
+        } else { cubeQueue.split(cube, mkLit(split, false)); }
+    }
+    if (verbosity > 0) { cerr << "c created " << cubeQueue.open() << " cubes with lookahead, " << cubeQueue.refuted << " refuted, max size " << cubeQueue.maxSize << endl; }
+}
+
+lbool PSolver::solveCubes(int i)
+{
+    Solver& S = *solvers[i];
+    vec<Lit> cube;
+    lbool result = l_Undef;
+    while (result == l_Undef && cubeQueue.pop(cube)) {
+        S.setConfBudget(pfolioConfig.opt_cubeConflicts);
+        result = S.solveLimited(cube, Solver::SolveCallType::afterSimplification);
+        if (result == l_False && S.conflict.size() > 0) {   // only the cube has been refuted, the learnt clauses are valid for all cubes
+            cubeQueue.refute();
+            result = l_Undef;
+        } else if (result == l_Undef) {
+            if (S.interrupted()) { break; }   // another thread solved the formula
+            Var split = var_Undef;            // the cube is too hard, split it further
+            if (!S.lookaheadSplit(cube, pfolioConfig.opt_cubeCandidates, split)) { cubeQueue.refute(); }
+            else if (split == var_Undef) { cubeQueue.giveBack(cube); }
+            else { cubeQueue.split(cube, mkLit(split, false)); }
+        }
+    }
+    S.budgetOff();
+    if (result != l_Undef) {   // satisfiable, or unsatisfiable independently of the cube
+        cubeQueue.abort();
+        return result;
+    }
+    if (cubeQueue.exhausted()) {   // all cubes have been refuted, the formula is unsatisfiable
+        S.conflict.clear();
+        return l_False;
+    }
+    return l_Undef;
+}
+
+void PSolver::reportSharedArena(const char* when)
+{
+    double sharedMB = 0, copiedMB = 0;
+    if (sharedArena && verbosity > 0 && sharedMemoryUsage("riss-clauses", sharedMB, copiedMB)) {
+        cerr << "c shared clause arena " << when << ": " << sharedMB << " MB shared, " << copiedMB << " MB copied on write" << endl;
+    }
+}
+
+void PSolver::finishedCopying()
+{
+    setupLock.lock();
+    const bool last = pendingSetups > 0 && -- pendingSetups == 0;
+    setupLock.unlock();
+    if (last) { setupLock.awake(); }
+}
+
+void PSolver::setupCheckpoints()
+{
+    if (checkpointPrefix.size() == 0) { return; }
+    for (int i = 0 ; i < threads; ++ i) { solvers[i]->setCheckpointFile(checkpointPrefix + "." + std::to_string(i)); }
+    if (globalSimplifier != nullptr) { globalSimplifier->writeBinaryFormula(checkpointPrefix + ".global"); }
+}
+
 void PSolver::start()
 {
 // set all threads to working (they'll have a look for new work on their own)
@@ -1217,6 +1484,7 @@ void PSolver::kill()
         communicators[i]->ownLock->unlock();
         communicators[i]->ownLock->awake();
     }
+    setupLock.awake();
 
 //   // interrupt all threads!
 //   for( unsigned i = 0 ; i<threads; ++ i )
@@ -1273,7 +1541,17 @@ void* runWorkerSolver(void* data)
     vec<Lit> assumptions;
 
     // proceed with the current work item (group) as long as required
-    while (! info.isAborted()) {
+    while (true) {
+        // set up the solver incarnation inside this thread before the first search, also if the thread has been
+        // aborted already, so that solver 0 does not wait for it
+        bool canSearch = true;
+        if (info.setupTask) {
+            canSearch = info.setupTask();
+            if (canSearch) { info.setupTask = nullptr; }
+        }
+        if (info.isAborted()) { break; }
+        // an incarnation whose setup failed stays idle, so that the master does not stop the search because of it
+        const bool participates = canSearch || info.getSolver()->interrupted();
         if (verbose) { cerr << "c [THREAD] " << info.getID() << " start " <<  endl; }
 
         // solve with assumptions!
@@ -1283,7 +1561,9 @@ void* runWorkerSolver(void* data)
 
         // do work
         lbool result l_Undef;
-        if (!info.getSolver()->okay()) { result = l_False; }
+        if (!canSearch) { result = l_Undef; }
+        else if (!info.getSolver()->okay()) { result = l_False; }
+        else if (info.searchTask) { result = info.searchTask(); }   // e.g. solve cubes instead of the whole formula
         else {
             if (info.independent()) {
                 result = info.getSolver()->solveLimited(assumptions, Solver::SolveCallType::full);  // as we are working on the original formula, have the change to initialize amd simplify
@@ -1306,7 +1586,7 @@ void* runWorkerSolver(void* data)
         // set own state to finished
         info.ownLock->lock();
         // depending on whether we did something useful, set the state
-        info.setState(Communicator::finished);
+        info.setState(participates ? Communicator::finished : Communicator::idle);
         info.ownLock->unlock();
 
         if (verbose) { cerr << "c [THREAD] " << info.getID() << " wake up master" << endl; }
@@ -11,6 +11,7 @@ Copyright (c) 2014,      Norbert Manthey, LGPL v2, see LICENSE
 #include "coprocessor/CP3Config.h"
 
 #include "pfolio/PfolioConfig.h"
+#include "pfolio/CubeQueue.h"
 
 #include "pthread.h"
 
@@ -31,6 +32,9 @@ class PSolver
     bool initialized;     // indicate whether everything has been setup already
     bool simplified;      // indicate whether global formula has been simplified with global preprocessor already
     bool killed;          // killed all childs already?
+    bool sharedArena;     // the threads map the clauses of the simplified formula copy on write from one shared file
+    SleepLock setupLock;  // solver 0 sleeps on this lock, until the other incarnations copied its formula
+    int pendingSetups;    // number of incarnations that still copy the formula of solver 0
     int threads;
     int winningSolver;     // id of the thread of the solver that won
 
@@ -50,10 +54,15 @@ class PSolver
 
     EnumerateMaster* modelMaster; // object that controls parallel model enumeration
 
+    CubeQueue cubeQueue;          // cubes of the cube-and-conquer mode, that still have to be solved
+
     std::string defaultConfig;                     // name of the configuration that should be used
     std::string defaultSimplifierConfig;           // name of the configuration that should be used by the global simplification
     std::vector< std::string > incarnationConfigs; // strings of incarnation configurations
 
+    std::string checkpointPrefix;                  // prefix of the checkpoint files of the threads (empty, if no checkpoints are written)
+    std::string resumePrefix;                      // prefix of the checkpoint files to continue the search from
+
     std::vector<unsigned short int> hardwareCores; // list of available cores for this parallel solver
 
     // communicate with external solvers
@@ -204,6 +213,13 @@ class PSolver
 
     void interrupt(); // Trigger a (potentially asynchronous) interruption of the solver.
 
+    void requestCheckpoint(); // let all threads write a checkpoint at their next restart (can be called from a signal handler)
+
+    /** continue the search of all threads from the checkpoints with the given prefix, instead of solving the added formula
+     *  Note: has to be called before the first call to solve, with the number of threads that wrote the checkpoints
+     */
+    void resumeFromCheckpoint(const std::string& prefix);
+
     void setConfBudget(int64_t x); // set number of conflicts for the next search run
 
     void budgetOff(); // reset the search bugdet
@@ -236,6 +252,34 @@ class PSolver
      */
     bool initializeThreads();
 
+    /** initialize all the threads from the checkpoints of resumePrefix, instead of distributing the formula of the first solver
+     * @return false, if a checkpoint could not be read
+     */
+    bool resumeThreads();
+
+    /** copy the formula of solver 0 (or the original formula) into the given incarnation, attach the clauses and initialize it
+     * @param mapped the clause arena has been mapped from the shared file already, and is not copied
+     */
+    void setupIncarnation(int i, bool mapped);
+
+    /** the given incarnation does not read the formula of solver 0 anymore, wake up solver 0 if it was the last one */
+    void finishedCopying();
+
+    /** print how much of the shared clause arena is still shared, and how much has been copied on write (with verbosity) */
+    void reportSharedArena(const char* when);
+
+    /** split the formula of solver 0 with lookahead into the initial cubes of the cube queue */
+    void createCubes();
+
+    /** take cubes from the queue, and solve them with the given incarnation under assumptions, until the formula is solved
+     *  note: cubes that are not solved within the conflict budget are split with the lookahead of the incarnation
+     *  @return l_False, if all cubes have been refuted, l_Undef, if the search has been stopped
+     */
+    lbool solveCubes(int i);
+
+    /** tell each thread its checkpoint file, and write the undo information of the global simplifier */
+    void setupCheckpoints();
+
     /** start solving all tasks with the given number of threads
      */
     void start();
@@ -26,7 +26,15 @@ PfolioConfig::PfolioConfig(const std::string& presetOptions)  // add new options
     , opt_ppconfig("PFOLIO - INIT", "ppconfig", "the configuration to be used for the simplifier", 0, optionListPtr)
     , opt_allIncPresets("PFOLIO - INIT", "pAllSetup", "add to all incarnations (after other setups)", 0, optionListPtr)
 
-    , opt_storageSize("PFOLIO - INIT", "storageSize", "Number of clauses in one ring buffer (0 => 4000 x threads)", 0, IntRange(0, INT32_MAX), optionListPtr)
+    , opt_storageSize("PFOLIO - INIT", "storageSize", "Number of slots (not clauses) in one ring buffer, a slot holds up to 11 literals, larger clauses use several slots, clauses that need more than a quarter of all slots are not shared (0 => 4000 x threads)", 0, IntRange(0, INT32_MAX), optionListPtr)
+    , opt_commBench("PFOLIO - INIT", "commBench", "measure and report share/receive throughput of the ring buffers per thread", false, optionListPtr)
+    , opt_sharedArena("PFOLIO - INIT", "sharedArena", "share the clauses of the simplified formula copy on write between all threads, instead of copying them (Linux only); propagation moves the watched literals inside the clauses, so that the pages are copied during the first conflicts of the search, this saves the initial copy, not memory", false, optionListPtr)
+    , opt_parallelSetup("PFOLIO - INIT", "parallelSetup", "set up the solver incarnations concurrently inside their threads (copy formula, attach clauses, build heap)", true, optionListPtr)
+    , opt_checkpoint("PFOLIO - INIT", "checkpoint", "write the search state of each thread into <prefix>.<thread> on SIGUSR1 (and periodically)", 0, optionListPtr)
+    , opt_checkpointEvery("PFOLIO - INIT", "checkpointEvery", "write a checkpoint every X conflicts of a thread (0=only on request)", 0, IntRange(0, INT32_MAX), optionListPtr, &opt_checkpoint)
+    , opt_cubes("PFOLIO - INIT", "cubes", "cube-and-conquer: split the simplified formula into X cubes with lookahead, workers solve them under assumptions (0=portfolio)", 0, IntRange(0, INT32_MAX), optionListPtr)
+    , opt_cubeConflicts("PFOLIO - INIT", "cubeConflicts", "conflicts per cube, before the cube is split further", 10000, IntRange(1, INT32_MAX), optionListPtr, &opt_cubes)
+    , opt_cubeCandidates("PFOLIO - INIT", "cubeCandidates", "number of variables that are tested by the lookahead for a split", 32, IntRange(1, INT32_MAX), optionListPtr, &opt_cubes)
 
     , opt_share("SEND", "ps", "enable clause sharing for all clients", true, optionListPtr)
     , opt_receive("SEND", "pr", "enable receiving clauses for all clients", true, optionListPtr)
@@ -44,6 +52,10 @@ PfolioConfig::PfolioConfig(const std::string& presetOptions)  // add new options
     , opt_checkLiterals("SEND", "checkLits", "control allowing sending and receiving information based on literal instead of variables", false, optionListPtr)
     , opt_useDynamicLimits("SEND", "dynLimits", "update sharing limits dynamically", false, optionListPtr)
     , opt_sendEquivalences("SEND", "shareEE", "share equivalent literals", true, optionListPtr)
+    , opt_feedbackTarget("SEND", "feedbackTarget", "adapt send limits, such that this fraction of the imported clauses is used by the receivers (0=off)", 0, DoubleRange(0, true, 1, true), optionListPtr)
+    , opt_feedbackChange("SEND", "feedbackChange", "relative change of the minimal send limits per feedback check", 0.1, DoubleRange(0, true, 1, false), optionListPtr, &opt_feedbackTarget)
+    , opt_feedbackInterval("SEND", "feedbackInterval", "conflicts between two feedback checks of a sender", 2000, IntRange(1, INT32_MAX), optionListPtr, &opt_feedbackTarget)
+    , opt_dupFilter("SEND", "dupFilter", "drop clauses that have been shared recently, filter remembers 2^(x+1) clauses (0=off)", 15, IntRange(0, 30), optionListPtr)
 
 {
     if (defaultPreset.size() != 0) {
@@ -44,7 +44,16 @@ class PfolioConfig : public Config
     StringOption opt_ppconfig;              // configuration for global preprocessor
     StringOption opt_allIncPresets;         // to be added to all incarnations (after all other setups)
 
-    IntOption  opt_storageSize;             // size of the storage for clause sharing
+    IntOption  opt_storageSize;             // size of the storage for clause sharing, in slots of the ring buffer
+    BoolOption opt_commBench;               // measure and report the throughput of the clause buffers per thread
+    BoolOption opt_sharedArena;             // map the clauses of the simplified formula copy on write into all threads, instead of copying them
+                                            // NOTE: swapping watched literals writes to almost every page, e.g. a 22.9 MB arena was fully copied by 2 threads within 8000 conflicts
+    BoolOption opt_parallelSetup;           // each thread copies and attaches the formula itself, instead of the master doing it for all threads
+    StringOption opt_checkpoint;            // prefix of the checkpoint files of the threads
+    IntOption  opt_checkpointEvery;         // conflicts between two periodic checkpoints of each thread
+    IntOption  opt_cubes;                   // number of cubes to create with lookahead before the search, 0 = portfolio
+    IntOption  opt_cubeConflicts;           // conflicts a worker spends on a cube, before the cube is split further
+    IntOption  opt_cubeCandidates;          // number of variables that are tested by the lookahead for a split
 
     // sharing options
     BoolOption opt_share;
@@ -63,6 +72,10 @@ class PfolioConfig : public Config
     BoolOption opt_checkLiterals;           // control allowing sending and receiving information based on literal instead of variables
     BoolOption opt_useDynamicLimits;        // use dynamic limits for clause sharing
     BoolOption opt_sendEquivalences;        // send info about equivalences
+    DoubleOption opt_feedbackTarget;        // fraction of sent clauses the receivers should use in conflict analysis
+    DoubleOption opt_feedbackChange;        // how fast the minimal send limits follow the feedback of the receivers
+    IntOption  opt_feedbackInterval;        // conflicts between two checks of the feedback
+    IntOption  opt_dupFilter;               // size of the filter that drops clauses that have been shared recently
 
     /** set all the options of the specified preset option sets (multiple separated with : possible) */
     void setPreset(const std::string& optionSet);
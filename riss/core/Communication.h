@@ -6,13 +6,19 @@ Copyright (c) 2012, Norbert Manthey, LGPL v2, see LICENSE
 #ifndef RISS_COMMUNICATION_H
 #define RISS_COMMUNICATION_H
 
+#include <atomic>
 #include <cmath>
+#include <cstdlib>
 #include <deque>
+#include <functional>
+#include <new>
+#include <sched.h>
 #include <vector>
 #include <iostream>
 
 // own files
 #include "riss/utils/LockCollection.h"
+#include "riss/utils/System.h"
 //#include "Controller.h"
 // minisat files
 #include "riss/core/SolverTypes.h"
@@ -32,6 +38,14 @@ enum WaitState {
 
 /** ringbuffer that can be used to share clauses among multiple solver incarnations
  * note: is build based on MiniSATs Lit and Vec structures
+ *
+ * The buffer is a lock-free multi-producer ring of cache line sized slots. A producer reserves consecutive
+ * tickets with a single atomic add, and writes the literals of its item inline into the slots of these tickets
+ * (a head slot with the meta data, and continuation slots for longer items). No memory is allocated per item.
+ * Each receiver keeps its own read cursor (the next ticket it wants to see), and validates every item it copies
+ * via the sequence number of the slots, so that receivers never wait for producers. Items that have been
+ * overwritten before a receiver could read them are skipped, as in the locked version before.
+ * When a proof is written, producers are serialized to be able to delete overwritten clauses from the proof.
  */
 class ClauseRingBuffer
 {
@@ -47,104 +61,261 @@ class ClauseRingBuffer
     int maxRegularAuthor() const { return 1073741821; /* 2^30 - 3 */ }
 
   private:
-    /** item for the pool, remembers the sender so that own clauses are not received again, the type (and the dependencies)
+
+    static const unsigned slotWords = 14;   /** payload words per slot, so that a slot fills exactly one cache line */
+    static const unsigned headerWords = 3;  /** size, author+flags and dependency level of an item */
+    static const unsigned headLits = slotWords - headerWords; /** literals that are stored in the head slot of an item */
+
+    /** one slot of the pool, either the head of an item or a continuation of the item of the previous ticket
+     *  seq is 2*(ticket+1)+isHead if the slot is completely written for the given ticket, and 0 while it is written
      */
-    struct poolItem {
-        std::vector<Lit> data;      /** the actual clause, equivalence class or multiple units */
-        unsigned author : 30;       /** the author of the clause */
-        unsigned multiunits : 1;    /** is a multiple unit clauses */
-        unsigned equivalence: 1;    /** is a set of equivalent literals */
-        #ifdef PCASSO
-        int dependencyLevel;        /** store depth in the partition tree where this share-element depends on */
-        #endif
-        poolItem() : author(1073741823), multiunits(0), equivalence(0)     /** the initial author is invalid, so that it can be seen whether a clause in the ringbuffer has been added by solver */
-            #ifdef PCASSO
-            , dependencyLevel(0)
-            #endif
-        {}
+    struct Slot {
+        std::atomic<uint64_t> seq;
+        std::atomic<uint32_t> word[slotWords];
+    };
+
+    /** meta data of an item that is received */
+    struct ItemHeader {
+        int size;
+        int author;
+        bool multiunits;
+        bool equivalence;
+        int dependencyLevel;
     };
 
-    Lock dataLock;                  /** lock that protects the access to the task data structures */
-    poolItem* pool;                 /** ringbuffer for the clauses */
-    unsigned poolSize;              /** size of the pool */
-    unsigned addHereNext;           /** index of the position where the next clause will be added in the buffer */
+    Slot* pool;                     /** ringbuffer for the clauses, allocated in one piece */
+    unsigned poolSize;              /** size of the pool (in slots) */
+    unsigned maxItemSlots;          /** items that need more slots are not shared */
+
+    char pad1[64];                  /** keep the ticket counter on its own cache line */
+    std::atomic<uint64_t> nextTicket; /** ticket of the slot where the next item will be added in the buffer */
+    char pad2[64];
 
+    Lock dataLock;                  /** lock that serializes producers, only used when a proof is written */
     ProofMaster* proofMaster;       /** handle to the proof master, to handle shared clauses of the shared clauses pool */
 
-    /** get the author of the clause of the given position in the pool
-     * @param position index of the clause that should be received
-     * note: this method should be locked
-     */
-    int getAuthor(const unsigned position) const
+    std::atomic<uint64_t>* filter;  /** fingerprints of recently shared clauses, two per bucket (0 = empty), nullptr if not used */
+    uint64_t filterMask;            /** number of buckets of the filter minus one */
+
+    /** scramble the bits of the given value (finalizer of MurmurHash3) */
+    static uint64_t mix(uint64_t x)
     {
-        return pool[position].author;
+        x ^= x >> 33; x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33; x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
     }
 
-    int getMultiUnit(const unsigned position) const
+    /** fingerprint of a clause, independent of the order of its literals, never 0 */
+    template<typename T>
+    static uint64_t fingerprint(const T& clause, const int clauseSize, const int dependencyLevel)
     {
-        return pool[position].multiunits;
+        uint64_t sum = 0, xored = 0;
+        for (int i = 0 ; i < clauseSize; ++ i) {
+            const uint64_t l = toInt(clause[i]);
+            sum += mix(l + 1);
+            xored ^= mix(l * 0x9e3779b97f4a7c15ULL + 0x632be59bd9b4e019ULL);
+        }
+        return mix(sum ^ (xored << 1 | xored >> 63) ^ ((uint64_t)clauseSize << 48) ^ (uint64_t)dependencyLevel) | 1;
     }
 
-    int getEquivalence(const unsigned position) const
+    /** check whether the clause has been shared recently, and remember it otherwise
+     *  note: the filter is lossy, concurrent producers of the same clause can both pass, and old fingerprints are replaced
+     */
+    template<typename T>
+    bool sharedBefore(const T& clause, const int clauseSize, const int dependencyLevel)
     {
-        return pool[position].equivalence;
+        const uint64_t fp = fingerprint(clause, clauseSize, dependencyLevel);
+        std::atomic<uint64_t>* bucket = filter + 2 * ((fp >> 1) & filterMask);
+        if (bucket[0].load(std::memory_order_relaxed) == fp || bucket[1].load(std::memory_order_relaxed) == fp) { return true; }
+        bucket[1].store(bucket[0].load(std::memory_order_relaxed), std::memory_order_relaxed);   // keep the more recent fingerprint
+        bucket[0].store(fp, std::memory_order_relaxed);
+        return false;
     }
 
-    /** return actual vector to data */
-    const std::vector<Lit>& getData(const unsigned position) const
+    /** number of slots that is necessary to store an item with the given number of literals */
+    static unsigned slotsFor(const int size)
     {
-        return pool[position].data;
+        return size <= (int)headLits ? 1 : 1 + (size - headLits + slotWords - 1) / slotWords;
     }
 
-    #ifdef PCASSO
-    int getDependency(const unsigned position) const
+    /** tell the CPU that this thread busy waits */
+    static void pause()
     {
-        return pool[position].dependencyLevel;
+        #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+        #endif
     }
-    #endif
 
-    /** get the clause of the given position to the pool
-     * @param position index of the clause that should be received
-     * @param allocator clause allocator of the solver that receives clauses (clauses are copied directly into the allocator
-     * note: this method should be locked
+    /** sequence number of a completely written slot */
+    static uint64_t completeSeq(const uint64_t ticket, const bool isHead) { return ((ticket + 1) << 1) | (isHead ? 1 : 0); }
+
+    /** wait until the slot of the given ticket is not used by the previous round any more, and mark it as being written
+     *  note: the previous round has been reserved by another producer before, which only has to finish its copy
      */
-    Riss::CRef getClause(const unsigned position, Riss::ClauseAllocator& allocator)
+    Slot& claimSlot(const uint64_t ticket)
     {
-        std::vector<Lit>& poolClause = pool[position].data;
-        return allocator.alloc(poolClause, true); // create as learned clause!
+        Slot& s = pool[ticket % poolSize];
+        const uint64_t previousRound = ticket + 1 - poolSize;
+        for (unsigned spins = 0 ; (s.seq.load(std::memory_order_acquire) >> 1) != previousRound; ++ spins) {
+            if (spins < 64) { pause(); }
+            else { sched_yield(); }   // the other producer might not run currently, e.g. with more threads than cores
+        }
+        s.seq.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        return s;
     }
 
-    /** lock the whole data set
+    /** copy the item that starts at the given ticket into the given header and literal vector
+     * @return number of slots that can be skipped (0, if the item is not written completely yet)
+     * note: the copy is only valid, if the return value is positive and valid is true
      */
-    void lock()
+    unsigned readItem(const uint64_t ticket, ItemHeader& header, std::vector<Lit>& lits, bool& valid) const
     {
-        dataLock.lock();
+        valid = false;
+        const Slot& h = pool[ticket % poolSize];
+        const uint64_t hseq = h.seq.load(std::memory_order_acquire);
+        if (hseq != completeSeq(ticket, true)) {
+            if ((hseq >> 1) > ticket + 1 || hseq == completeSeq(ticket, false)) { return 1; }  // overwritten by a later round, or not a head
+            if (nextTicket.load(std::memory_order_acquire) > ticket + poolSize) { return 1; }  // currently overwritten by a later round
+            return 0; // still written by its producer, try again later
+        }
+
+        header.size = h.word[0].load(std::memory_order_relaxed);
+        const uint32_t flags = h.word[1].load(std::memory_order_relaxed);
+        header.author = flags & 0x3fffffff;
+        header.multiunits = (flags >> 30) & 1;
+        header.equivalence = (flags >> 31) & 1;
+        header.dependencyLevel = (int)h.word[2].load(std::memory_order_relaxed);
+
+        const unsigned k = slotsFor(header.size);
+        if (header.size <= 0 || k > maxItemSlots) {   // torn read of the header, the slot is overwritten right now
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return 1;
+        }
+
+        lits.resize(header.size);
+        int litIndex = 0;
+        for (unsigned w = headerWords; w < slotWords && litIndex < header.size; ++ w) { lits[litIndex++] = toLit(h.word[w].load(std::memory_order_relaxed)); }
+        bool complete = true;
+        for (unsigned j = 1 ; j < k && complete; ++ j) {
+            const Slot& c = pool[(ticket + j) % poolSize];
+            complete = c.seq.load(std::memory_order_acquire) == completeSeq(ticket + j, false);
+            for (unsigned w = 0; complete && w < slotWords && litIndex < header.size; ++ w) { lits[litIndex++] = toLit(c.word[w].load(std::memory_order_relaxed)); }
+        }
+
+        // check that no producer touched the item while it has been copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (h.seq.load(std::memory_order_relaxed) != completeSeq(ticket, true)) { return 1; }   // header might be torn, skip only this slot
+        for (unsigned j = 1 ; j < k && complete; ++ j) {
+            complete = pool[(ticket + j) % poolSize].seq.load(std::memory_order_relaxed) == completeSeq(ticket + j, false);
+        }
+        valid = complete;
+        return k;
     }
 
-    /** unlock the whole data set
+    /** remove all regular clauses from the proof whose head slots will be reused by the tickets [ticket, ticket+k)
+     *  note: producers have to be serialized, so that these items are still complete
      */
-    void unlock()
+    void deleteOverwrittenFromProof(const uint64_t ticket, const unsigned k)
     {
-        dataLock.unlock();
+        ItemHeader header;
+        std::vector<Lit> lits;
+        bool valid = false;
+        for (unsigned j = 0 ; j < k; ++ j) {
+            const uint64_t seq = pool[(ticket + j) % poolSize].seq.load(std::memory_order_acquire);
+            if ((seq & 1) == 0) { continue; }  // no item starts here
+            readItem((seq >> 1) - 1, header, lits, valid);
+            if (valid && !header.multiunits && !header.equivalence) { proofMaster->delFromProof(lits, lit_Undef, -1, false); }    // can work only on the global proof
+        }
+    }
+
+    /** write an item into the pool, continuation slots first, so that a complete head implies a complete item */
+    template<typename T>
+    void writeItem(int authorID, const T& clause, const int clauseSize, const int dependencyLevel, bool multiUnits, bool equivalence)
+    {
+        const unsigned k = slotsFor(clauseSize);
+        if (k > maxItemSlots) { return; }  // item would overwrite too large parts of the pool, do not share it
+
+        if (proofMaster != 0) {
+            dataLock.lock();
+            deleteOverwrittenFromProof(nextTicket.load(std::memory_order_relaxed), k);
+        }
+
+        const uint64_t ticket = nextTicket.fetch_add(k, std::memory_order_relaxed);
+
+        int litIndex = headLits;
+        for (unsigned j = 1 ; j < k; ++ j) {
+            Slot& c = claimSlot(ticket + j);
+            for (unsigned w = 0; w < slotWords && litIndex < clauseSize; ++ w) { c.word[w].store(toInt(clause[litIndex++]), std::memory_order_relaxed); }
+            c.seq.store(completeSeq(ticket + j, false), std::memory_order_release);
+        }
+
+        Slot& h = claimSlot(ticket);
+        h.word[0].store(clauseSize, std::memory_order_relaxed);
+        h.word[1].store((uint32_t)authorID | ((uint32_t)multiUnits << 30) | ((uint32_t)equivalence << 31), std::memory_order_relaxed);
+        h.word[2].store((uint32_t)dependencyLevel, std::memory_order_relaxed);
+        litIndex = 0;
+        for (unsigned w = headerWords; w < slotWords && litIndex < clauseSize; ++ w) { h.word[w].store(toInt(clause[litIndex++]), std::memory_order_relaxed); }
+        h.seq.store(completeSeq(ticket, true), std::memory_order_release);
+
+        if (proofMaster != 0) {  // can work only on the global proof
+            if (multiUnits) {
+                for (int i = 0 ; i < clauseSize; ++ i) {
+                    proofMaster->addUnitToProof(clause[i], -1, false);
+                }
+            } else if (equivalence) {
+                for (int i = 1 ; i < clauseSize; ++ i) {
+                    proofMaster->addEquivalenceToProof(clause[0], clause[i], -1, false);
+                }
+            } else {
+                std::vector<Lit> proofClause(clauseSize);
+                for (int i = 0 ; i < clauseSize; ++ i) { proofClause[i] = clause[i]; }
+                proofMaster->addToProof(proofClause, lit_Undef, -1, false);
+            }
+            dataLock.unlock();
+        }
     }
 
   public:
 
     /** create the data that is needed for adding enough clauses
+     * @param size number of slots in the pool, a slot stores a clause with up to 11 literals
      */
     ClauseRingBuffer(const unsigned size)
         :
-        poolSize(size)
-        , addHereNext(1)   // initially, last seen is set to 0 for each thread. to not incorporate non-initialized clauses, start at 1
+        pool(0)
+        , poolSize(size < 4 ? 4 : size)
+        , maxItemSlots(poolSize / 4)
+        , nextTicket(poolSize)   // tickets of the first round are used for the initial state, so that no reader has to handle them
         , proofMaster(0)
+        , filter(nullptr)
+        , filterMask(0)
     {
-        pool = new poolItem [size];
-        poolSize = size;
+        void* memory = 0;
+        if (posix_memalign(&memory, 64, sizeof(Slot) * poolSize) != 0) { throw OutOfMemoryException(); }
+        pool = (Slot*) memory;
+        for (unsigned i = 0 ; i < poolSize; ++ i) {
+            new (pool + i) Slot();
+            pool[i].seq.store(completeSeq(i, false), std::memory_order_relaxed);   // slots look like continuations of the round before the first round
+        }
     }
 
     ~ClauseRingBuffer()
     {
-        if (pool != 0) { delete [] pool; pool = 0; }
+        if (pool != 0) { free(pool); pool = 0; }
+        delete [] filter;
+    }
+
+    /** drop regular clauses that have been shared recently already, before they are added to the pool
+     * @param bits the filter remembers up to 2^(bits+1) clauses
+     */
+    void enableFilter(const unsigned bits)
+    {
+        delete [] filter;
+        filterMask = ((uint64_t)1 << bits) - 1;
+        filter = new std::atomic<uint64_t> [ 2 * (filterMask + 1) ];
+        for (uint64_t i = 0 ; i < 2 * (filterMask + 1); ++ i) { filter[i].store(0, std::memory_order_relaxed); }
     }
 
     /** set the handle for the proof master */
@@ -152,9 +323,11 @@ class ClauseRingBuffer
 
     unsigned size() const { return poolSize; }
 
-    /** return the position of the clause that has been deleted last
-     */
-    unsigned getCurrentPosition() const { return ((addHereNext == 0) ? poolSize - 1 : addHereNext - 1); }
+    /** return true, if an item with the given number of literals can be stored, larger items would overwrite too large parts of the pool */
+    bool fits(const int clauseSize) const { return slotsFor(clauseSize) <= maxItemSlots; }
+
+    /** return the ticket of the slot that has been reserved last */
+    uint64_t getCurrentPosition() const { return nextTicket.load(std::memory_order_relaxed) - 1; }
 
     /** adds a clause to the next position of the pool
      * used template type should be Clause, vec<Lit> or Lit*
@@ -165,54 +338,27 @@ class ClauseRingBuffer
      * @param dependencyLevel dependency of currently shared object
      * @param multiUnits container represents multiple unit clauses
      * @param equivalence container represents equivalence class
+     * @return false, if the clause has been dropped, because it has been shared recently already
      */
 
     #ifdef PCASSO
     template<typename T> // can be either clause or vector
-    void addClause(int authorID, const T& clause, const int& clauseSize, const int& dependencyLevel, bool multiUnits = false, bool equivalence = false)
+    bool addClause(int authorID, const T& clause, const int& clauseSize, const int& dependencyLevel, bool multiUnits = false, bool equivalence = false)
     #else
     template<typename T> // can be either clause or vector
-    void addClause(int authorID, const T& clause, const int& clauseSize, bool multiUnits = false, bool equivalence = false)
+    bool addClause(int authorID, const T& clause, const int& clauseSize, bool multiUnits = false, bool equivalence = false)
     #endif
     {
-        lock();
-
         assert(clauseSize != 0 && "should not send empty clauses");
-
-        // std::cerr << "[COMM] thread " << authorID << " adds clause to " << addHereNext << std::endl;
-        // overwrite current position (starts with 0)
-        std::vector<Lit>& poolClause = pool[addHereNext].data;
-        // if there has been a clause at this position before, then this clause is removed right now ...
-        if (pool[addHereNext].author != ~0U && proofMaster != 0) { proofMaster->delFromProof(poolClause, lit_Undef, -1, false); }     // can work only on the global proof
-
         assert((!multiUnits || !equivalence) && "cannot have both properties");
-        pool[addHereNext].author = authorID;
-        pool[addHereNext].multiunits = multiUnits;
-        pool[addHereNext].equivalence = equivalence;
-
-        poolClause.resize(clauseSize);
-        for (int i = 0 ; i < clauseSize; ++i) { poolClause[i] = clause[i]; }
-
-        if (proofMaster != 0) {  // can work only on the global proof
-            if (multiUnits) {
-                for (int i = 0 ; i < clauseSize; ++ i) {
-                    proofMaster->addUnitToProof(clause[i], -1, false);
-                }
-            } else if (equivalence) {
-                for (int i = 1 ; i < clauseSize; ++ i) {
-                    proofMaster->addEquivalenceToProof(clause[0], clause[i], -1, false);
-                }
-            } else {
-                proofMaster->addToProof(poolClause, lit_Undef, -1, false);
-            }
-        }
-
-        // push pointer to the next position
-        // stay in the pool!
-        addHereNext ++;
-        addHereNext = (addHereNext == poolSize ? 0 : addHereNext);
-
-        unlock();
+        #ifdef PCASSO
+        if (filter != nullptr && !multiUnits && !equivalence && sharedBefore(clause, clauseSize, dependencyLevel)) { return false; }
+        writeItem(authorID, clause, clauseSize, dependencyLevel, multiUnits, equivalence);
+        #else
+        if (filter != nullptr && !multiUnits && !equivalence && sharedBefore(clause, clauseSize, 0)) { return false; }
+        writeItem(authorID, clause, clauseSize, 0, multiUnits, equivalence);
+        #endif
+        return true;
     }
 
     /** adds a set of unit clauses to the pool
@@ -221,29 +367,15 @@ class ClauseRingBuffer
      */
     void addUnitClauses(int authorID, const std::vector<Lit>& units)
     {
-        lock(); // coarse lock, do not lock for each unit, but for all!
-
         for (size_t i = 0 ; i < units.size(); ++ i) {
-            // std::cerr << "[COMM] thread " << authorID << " adds clause to " << addHereNext << std::endl;
-            // overwrite current position (starts with 0)
-            std::vector<Lit>& poolClause = pool[addHereNext].data;
-            if (pool[addHereNext].author != ~0U && proofMaster != 0) { proofMaster->delFromProof(poolClause, lit_Undef, -1, false); }     // can work only on the global proof
-            pool[addHereNext].author = authorID;
-            poolClause.resize(1);
-            poolClause[0] = units[i];
-            if (proofMaster != 0) { proofMaster->addToProof(poolClause, lit_Undef, -1, false); }     // can work only on the global proof
-
-            // push pointer to the next position
-            // stay in the pool!
-            addHereNext ++;
-            addHereNext = (addHereNext == poolSize ? 0 : addHereNext);
+            writeItem(authorID, &units[i], 1, 0, false, false);
         }
-        unlock();
     }
 
 
     /** copy shared element into local receive data structure (sort type, handle variable info (and dependency for Pcasso)
-     * @param position of the element that is currently received
+     * @param header meta data of the element that is currently received
+     * @param data literals of the element that is currently received
      * @param allocator allocator object of calling solver
      * @param clauses vector to clause references of newly added clauses
      * @param receivedUnits vector of unit clauses that are received
@@ -251,28 +383,27 @@ class ClauseRingBuffer
      * @param receivedEquivalences vector of equivalent literal classes (separated by lit_Undef)
      * @param receivedEquivalencesDependencies dependencyLevel for each received equivalence class (one dependency per lit_Undef)
      * @param receiveData object that knows dependencies per variable, and can tell whether variable is allowed for receiving
-     * Note: should be run when read-locked
      */
     template <typename T>
     #ifdef PCASSO
-    void incorporateReceiveItem(unsigned position, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<int>& receivedUnitsDependencies, vec<Lit>& receivedEquivalences, vec<int>& receivedEquivalencesDependencies,  T& receiveData)
+    void incorporateReceiveItem(const ItemHeader& header, const std::vector<Lit>& data, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<int>& receivedUnitsDependencies, vec<Lit>& receivedEquivalences, vec<int>& receivedEquivalencesDependencies,  T& receiveData)
     {
     #else
-    void incorporateReceiveItem(unsigned position, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<Lit>& receivedEquivalences, T& receiveData)
+    void incorporateReceiveItem(const ItemHeader& header, const std::vector<Lit>& data, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<Lit>& receivedEquivalences, T& receiveData)
     {
     #endif
-        if (getMultiUnit(position)) {
-            const std::vector<Lit>& units = getData(position);
+        if (header.multiunits) {
+            const std::vector<Lit>& units = data;
             for (int j = 0 ; j < units.size(); ++ j) {
                 if (receiveData.canBeReceived(units[j])) {        // we are allowed to receive that unit clause due to simplification
                     receivedUnits.push(units[j]);    // receive unit
                     #ifdef PCASSO
-                    receivedUnitsDependencies. push(getDependency(position));   // store dependency level
+                    receivedUnitsDependencies. push(header.dependencyLevel);   // store dependency level
                     #endif
                 }
             }
-        } else if (getEquivalence(position)) {
-            const std::vector<Lit>& eeSCC = getData(position);
+        } else if (header.equivalence) {
+            const std::vector<Lit>& eeSCC = data;
             int usedSCCliterals = 0;
             const int oldSize = receivedEquivalences.size();
             for (int j = 0 ; j < eeSCC.size(); ++ j) {
@@ -280,7 +411,7 @@ class ClauseRingBuffer
                     receivedEquivalences.push(eeSCC[j]);    // receive unit
                     usedSCCliterals ++;
                     #ifdef PCASSO
-                    if (usedSCCliterals > 1) { receiveData.setDependency(var(eeSCC[j]), getDependency(position)); }    // store dependency level
+                    if (usedSCCliterals > 1) { receiveData.setDependency(var(eeSCC[j]), header.dependencyLevel); }    // store dependency level
                     #endif
                 }
             }
@@ -288,86 +419,60 @@ class ClauseRingBuffer
             else {
                 receivedEquivalences.push(lit_Undef);   // add a terminal symbol, so that next class can be added
                 #ifdef PCASSO
-                receivedEquivalencesDependencies.push(getDependency(position));    // set dependency for equivalence class, if there are at least 2 literals
+                receivedEquivalencesDependencies.push(header.dependencyLevel);    // set dependency for equivalence class, if there are at least 2 literals
                 #endif
             }
         } else {
             // usual clause
-            const std::vector<Lit>& lits = getData(position);
+            const std::vector<Lit>& lits = data;
             for (int i = 0 ; i < lits.size(); ++ i) {                     // check soundness of receiving
                 if (! receiveData.canBeReceived(lits[i])) { return; }        // if a literal in the clause is locked, do not receive it
             }
             // otherwise, receiving is fine at the moment
-            clauses.push_back(getClause(position, allocator));                 // create clause directly in clause allocator
+            clauses.push_back(allocator.alloc(lits, true));                 // create clause directly in clause allocator, as learned clause
             #ifdef PCASSO
-            allocator[ clauses[clauses.size() - 1] ].setPTLevel(getDependency(position));   // set dependency of this clause
+            allocator[ clauses[clauses.size() - 1] ].setPTLevel(header.dependencyLevel);   // set dependency of this clause
+            #else
+            allocator[ clauses[clauses.size() - 1] ].setImportedFrom(header.author);     // to report back whether the clause was useful
             #endif
         }
     }
 
     /** copy all clauses into the clauses std::vector that have been received since the last call to this method
      * @param authorID id of the author thread, to be stored with the clause
-     * note: only an approximation
+     * @param readCursor ticket of the next slot the calling thread has not seen yet
+     * @return the read cursor for the next call of the calling thread
+     * note: only an approximation, items that have been overwritten before they are read are lost
      */
     template <typename T>
     #ifdef PCASSO
-    unsigned receiveClauses(int authorID, unsigned lastSeenIndex, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<int>& receivedUnitsDependencies, vec<Lit>& receivedEquivalences, vec<int>& receivedEquivalencesDependencies, T& receiveData)
+    uint64_t receiveClauses(int authorID, uint64_t readCursor, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<int>& receivedUnitsDependencies, vec<Lit>& receivedEquivalences, vec<int>& receivedEquivalencesDependencies, T& receiveData)
     #else
-    unsigned receiveClauses(int authorID, unsigned lastSeenIndex, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<Lit>& receivedEquivalences, T& receiveData)
+    uint64_t receiveClauses(int authorID, uint64_t readCursor, Riss::ClauseAllocator& allocator, std::vector< Riss::CRef >& clauses, vec<Lit>& receivedUnits, vec<Lit>& receivedEquivalences, T& receiveData)
     #endif
     {
-        //std::cerr << "c [COMM] thread " << authorID << " called receive with last seen " << lastSeenIndex << ", addHere: " << addHereNext << std::endl;
         clauses.clear();
-        // TODO use read- and write-lock here!
-        lock();
-        // incorporate all clauses that are stored BEFORE addHereNext
-        unsigned returnIndex = addHereNext == 0 ? poolSize - 1 : addHereNext - 1;
-
-        const unsigned startIndex = lastSeenIndex == poolSize - 1 ? 0 : lastSeenIndex + 1; // first clause that needs to be copied
-        const unsigned stopIndex = addHereNext;     // last clause that needs to be copied
-
-        //std::cerr << "c [COMM] thread " << authorID << " start:" << startIndex << " stop:" << stopIndex << " return: " << returnIndex << std::endl;
-
-        // do not copy anything, if the next position is the one where the next clause would be added
-        if (startIndex != addHereNext) {
-            if (startIndex < stopIndex) {
-                for (unsigned i = startIndex; i < stopIndex; ++ i) {   // do copy the last clause!
-                    // receive only, if calling thread was not the author
-                    if (getAuthor(i) != authorID) {
-                        #ifdef PCASSO
-                        incorporateReceiveItem(i, allocator, clauses, receivedUnits, receivedUnitsDependencies, receivedEquivalences, receivedEquivalencesDependencies, receiveData);  // receive one element, and its dependencies
-                        #else
-                        incorporateReceiveItem(i, allocator, clauses, receivedUnits, receivedEquivalences, receiveData); // receive one element, add info to collecting data strucutures
-                        #endif
-                    }
-                }
-            } else { // startIndex > stopIndex
-                for (unsigned i = startIndex; i < poolSize; ++i) {
-                    // receive only, if calling thread was not the author
-                    if (getAuthor(i) != authorID) {
-                        #ifdef PCASSO
-                        incorporateReceiveItem(i, allocator, clauses, receivedUnits, receivedUnitsDependencies, receivedEquivalences, receivedEquivalencesDependencies, receiveData);  // receive one element, and its dependencies
-                        #else
-                        incorporateReceiveItem(i, allocator, clauses, receivedUnits, receivedEquivalences, receiveData); // receive one element, add info to collecting data strucutures
-                        #endif
-                    }
-                }
-                for (unsigned i = 0 ; i < stopIndex; ++ i) {
-                    // receive only, if calling thread was not the author
-                    if (getAuthor(i) != authorID) {
-                        #ifdef PCASSO
-                        incorporateReceiveItem(i, allocator, clauses, receivedUnits, receivedUnitsDependencies, receivedEquivalences, receivedEquivalencesDependencies, receiveData);  // receive one element, and its dependencies
-                        #else
-                        incorporateReceiveItem(i, allocator, clauses, receivedUnits, receivedEquivalences, receiveData); // receive one element, add info to collecting data strucutures
-                        #endif
-                    }
-                }
+        const uint64_t stopTicket = nextTicket.load(std::memory_order_acquire);
+        uint64_t ticket = readCursor < poolSize ? poolSize : readCursor;          // the first round is never used
+        if (stopTicket - poolSize > ticket) { ticket = stopTicket - poolSize; }  // older items are overwritten already
+
+        ItemHeader header;
+        std::vector<Lit> lits;
+        bool valid = false;
+        while (ticket < stopTicket) {
+            const unsigned skip = readItem(ticket, header, lits, valid);
+            if (skip == 0) { break; }  // the item is still written, continue here with the next call
+            // receive only, if calling thread was not the author
+            if (valid && header.author != authorID) {
+                #ifdef PCASSO
+                incorporateReceiveItem(header, lits, allocator, clauses, receivedUnits, receivedUnitsDependencies, receivedEquivalences, receivedEquivalencesDependencies, receiveData);  // receive one element, and its dependencies
+                #else
+                incorporateReceiveItem(header, lits, allocator, clauses, receivedUnits, receivedEquivalences, receiveData); // receive one element, add info to collecting data strucutures
+                #endif
             }
-        } else { // end if (something to share)
-            //std::cerr << "[COMM] c thread " << authorID << " nothing new to import" << std::endl;
+            ticket += skip;
         }
-        unlock();
-        return returnIndex;
+        return ticket;
     }
 
 };
@@ -388,6 +493,18 @@ class CommunicationData
 
     vec <Lit> sendUnits;         /** std::vector that stores the unit clauses that should be send to all clients as clauses (not learned!) */
 
+    /** what a receiver reports about the clauses of one sender, each counter is written by its receiver only */
+    struct ImportFeedback {
+        std::atomic<uint64_t> imported;  /** clauses that have been added to the receiver */
+        std::atomic<uint64_t> useful;    /** imported clauses that have been used in conflict analysis of the receiver */
+        ImportFeedback() : imported(0), useful(0) {}
+    };
+    ImportFeedback* feedback;    /** one row of senders per receiver */
+    int feedbackThreads;         /** number of rows and columns of feedback */
+
+    /** add one to a counter that is written by a single thread only */
+    static void increase(std::atomic<uint64_t>& counter) { counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed); }
+
   public:
 
     /** @param buffersize sets up a buffer with the given number of elements, and another buffer with quarter the number of elements */
@@ -395,8 +512,43 @@ class CommunicationData
         clauseBuffer(buffersize),
         specialBuffer(buffersize / 4),
         extraClauseBuffer(nullptr),
-        extraSpecialBuffer(nullptr)
+        extraSpecialBuffer(nullptr),
+        feedback(nullptr),
+        feedbackThreads(0)
+    {
+    }
+
+    ~CommunicationData() { delete [] feedback; }
+
+    /** allow the given number of threads to report the usefulness of imported clauses to their senders */
+    void initFeedback(const int threads)
     {
+        delete [] feedback;
+        feedback = new ImportFeedback [ threads * threads ];
+        feedbackThreads = threads;
+    }
+
+    /** the receiver added a clause of the sender (ignored for unknown threads) */
+    void reportImport(const int receiver, const int sender)
+    {
+        if (receiver < feedbackThreads && sender >= 0 && sender < feedbackThreads) { increase(feedback[receiver * feedbackThreads + sender].imported); }
+    }
+
+    /** the receiver used a clause of the sender in conflict analysis for the first time (ignored for unknown threads) */
+    void reportUsefulImport(const int receiver, const int sender)
+    {
+        if (receiver < feedbackThreads && sender >= 0 && sender < feedbackThreads) { increase(feedback[receiver * feedbackThreads + sender].useful); }
+    }
+
+    /** sum up what all receivers reported about the clauses of the given sender */
+    void senderFeedback(const int sender, uint64_t& imported, uint64_t& useful) const
+    {
+        imported = useful = 0;
+        if (sender < 0 || sender >= feedbackThreads) { return; }
+        for (int r = 0 ; r < feedbackThreads; ++ r) {
+            imported += feedback[r * feedbackThreads + sender].imported.load(std::memory_order_relaxed);
+            useful   += feedback[r * feedbackThreads + sender].useful.load(std::memory_order_relaxed);
+        }
     }
 
     SleepLock& getMasterLock() { return masterLock; };
@@ -465,8 +617,8 @@ class TreeReceiver
     TreeReceiver* parent;
     CommunicationData* data;
 
-    unsigned lastSeenIndex;         // position of the last clause that has been incorporated
-    unsigned lastSeenSpecialIndex;  // position of the last clause that has been incorporated
+    uint64_t lastSeenIndex;         // read cursor of this thread in the clause buffer
+    uint64_t lastSeenSpecialIndex;  // read cursor of this thread in the special buffer
 
   public:
     TreeReceiver() :
@@ -570,8 +722,8 @@ class Communicator
     State state;
 
     int myLastTaskID;
-    unsigned lastSeenIndex;         // position of the last clause that has been incorporated
-    unsigned lastSeenSpecialIndex;  // position of the last clause that has been incorporated
+    uint64_t lastSeenIndex;         // read cursor of this thread in the clause buffer
+    uint64_t lastSeenSpecialIndex;  // read cursor of this thread in the special buffer
     bool doSend;               // should this thread send clauses
     bool doReceive;            // should this thread receive clauses
 
@@ -622,6 +774,9 @@ class Communicator
         , useDynamicLimits(true)       // update sharing limits dynamically
         , sendEquivalences(true)       // share equivalence information
         , receiveEqiuvalences(false)   // receive equivalence information
+        , feedbackTarget(0)            // do not adapt the limits to the feedback of the receivers
+        , feedbackChange(0.1)
+        , feedbackInterval(2000)
 
         , vivifiedLiterals(0)
 
@@ -637,6 +792,17 @@ class Communicator
         , nrSendCattempt(0)
         , nrSendMattempt(0)
         , nrSendEattempt(0)
+        , nrDroppedDuplicates(0)
+        , nrDroppedLarge(0)
+
+        , measureThroughput(false)
+        , nrBufferWrites(0)
+        , nrBufferReads(0)
+        , nrBufferReadItems(0)
+        , bufferWriteTime(0)
+        , bufferReadTime(0)
+
+        , firstConflictTime(-1)
     {
         // do create the solver here, or from the outside?
         // solver = new Solver();
@@ -770,19 +936,28 @@ class Communicator
      * @param dependencyLevel dependencylevel of currently shared object
      * @param multiUnits we do not add one clause, but multiple unit clauses
      * @param equivalences we share a class of equivalent literals
+     * @return false, if the clause has been dropped, because it has been shared recently already
      */
     #ifdef PCASSO
     template<typename T, typename V> // can be either clause or vector, do not name variable information explicitely
-    void addClause(const T& clause, const int& toSendSize, const int& dependencyLevel, const V& variableInformation, bool multiUnits = false, bool equivalences = false)
+    bool addClause(const T& clause, const int& toSendSize, const int& dependencyLevel, const V& variableInformation, bool multiUnits = false, bool equivalences = false)
     #else
     template<typename T> // can be either clause or vector
-    void addClause(const T& clause, const int& toSendSize, bool multiUnits = false, bool equivalences = false)
+    bool addClause(const T& clause, const int& toSendSize, bool multiUnits = false, bool equivalences = false)
     #endif
     {
+        const double startTime = measureThroughput ? wallClockTime() : 0;
+        if (!(multiUnits || equivalences ? data->getSpecialBuffer() : data->getBuffer()).fits(toSendSize)) {
+            nrDroppedLarge ++;
+            return false;
+        }
         #ifdef PCASSO
 //        assert(!multiUnits && "remove this assertion when method makes sure that all units have the same dependency");   // either set the highest vor all, or sort and add multiple items
         if (!multiUnits && !equivalences) {
-            data->getBuffer().addClause(id, clause, toSendSize, dependencyLevel);     // usual buffer
+            if (!data->getBuffer().addClause(id, clause, toSendSize, dependencyLevel)) {     // usual buffer
+                nrDroppedDuplicates ++;
+                return false;
+            }
             if (data->getExtraBuffer() != nullptr) {
                 data->getExtraBuffer()->addClause(data->getExtraBuffer()->specialAuthor(), clause, toSendSize, dependencyLevel);     // usual special buffer
             }
@@ -795,7 +970,10 @@ class Communicator
         #else
         if (!multiUnits && !equivalences) {
             assert(toSendSize != 0 && "should not send empty clauses");
-            data->getBuffer().addClause(id, clause, toSendSize); // usual buffer
+            if (!data->getBuffer().addClause(id, clause, toSendSize)) { // usual buffer
+                nrDroppedDuplicates ++;
+                return false;
+            }
             if (data->getExtraBuffer() != nullptr) {
                 data->getExtraBuffer()->addClause(data->getExtraBuffer()->specialAuthor(), clause, toSendSize);     // usual special buffer
             }
@@ -806,6 +984,11 @@ class Communicator
             }
         }
         #endif
+        if (measureThroughput) {
+            bufferWriteTime += wallClockTime() - startTime;
+            nrBufferWrites ++;
+        }
+        return true;
     }
 
     /** copy all clauses into the clauses std::vector that have been received since the last call to this method
@@ -825,6 +1008,8 @@ class Communicator
     #endif
     {
         if (!doReceive) { return; }
+        const double startTime = measureThroughput ? wallClockTime() : 0;
+        const int oldUnits = receivedUnits.size(), oldEquivalences = receivedEquivalences.size();
         // receive from special buffer first
         #ifdef PCASSO
         lastSeenSpecialIndex = data->getSpecialBuffer().receiveClauses(id, lastSeenSpecialIndex, ca, clauses, receivedUnits, receivedUnitsDependencies, receivedEquivalences, receivedEquivalencesDependencies, receiveData);
@@ -837,6 +1022,11 @@ class Communicator
 
         if (parent != nullptr) { parent->receiveClauses(ca, clauses, receivedUnits, receivedEquivalences, receiveData); }  // receive from parent, if activated
         #endif
+        if (measureThroughput) {
+            bufferReadTime += wallClockTime() - startTime;
+            nrBufferReads ++;
+            nrBufferReadItems += clauses.size() + (receivedUnits.size() - oldUnits) + (receivedEquivalences.size() - oldEquivalences);
+        }
     }
 
     void initProtect(const vec<Lit>& assumptions, const int vars)
@@ -876,6 +1066,9 @@ class Communicator
     bool useDynamicLimits;        // update sharing limits dynamically
     bool sendEquivalences;        // share equivalence information
     bool receiveEqiuvalences;     // receive equivalences
+    float feedbackTarget;         // fraction of the sent clauses that should be useful for the receivers (0 = ignore feedback)
+    float feedbackChange;         // relative change of the minimal send limits, if the feedback misses the target
+    int feedbackInterval;         // conflicts between two checks of the feedback
 
     int vivifiedLiterals;         // number of literals that have been eliminated by vivification of received clause
 
@@ -888,6 +1081,19 @@ class Communicator
     unsigned nrSendEEs;           // number of shared EEs
     unsigned nrReceivedEEs;       // how many equivalence SCC have been sent
     unsigned nrReceiveAttempts, nrSendCattempt, nrSendMattempt, nrSendEattempt; // number of tries to receive/send certain data types
+    unsigned nrDroppedDuplicates; // how many clauses have not been sent, because they have been shared recently already
+    unsigned nrDroppedLarge;      // how many items have not been sent, because they would need more than a quarter of the slots of the buffer
+
+    bool measureThroughput;       // measure the time that is spent in the clause buffers (benchmark mode)
+    uint64_t nrBufferWrites;      // number of items that have been written into the buffers
+    uint64_t nrBufferReads;       // number of calls to receive from the buffers
+    uint64_t nrBufferReadItems;   // number of clauses, units and equivalence literals that have been received
+    double bufferWriteTime;       // wall clock time spent for writing into the buffers
+    double bufferReadTime;        // wall clock time spent for reading from the buffers
+
+    std::function<bool()> setupTask; // work the thread runs before it starts to search, e.g. copying the formula, false: cannot search (yet) (set by the master)
+    std::function<lbool()> searchTask; // replaces solving the whole formula in the next search, e.g. to solve cubes (set by the master)
+    double firstConflictTime;     // wall clock time of the first conflict in the current solving call (negative before)
 
 };
 
@@ -69,6 +69,8 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
     opt_rem_inc_lbd             (_cred, "remIncLBD",             "reset delete flag if LBD of a learned clause increases", false,                                                         optionListPtr),
     opt_quick_reduce            (_cred, "quickRed",              "check only first two literals for being satisfied", false,                                                              optionListPtr),
     opt_keep_worst_ratio        (_cred, "keepWorst",             "keep this (relative to all learned) number of worst learned clauses during removal", 0, DoubleRange(0, true, 1, true),  optionListPtr),
+    opt_tier2_lbd               (_cred, "tier2-lbd",             "keep learned clauses with this LBD in a tier that is not reduced (0=off, single vector)", 0, IntRange(0, INT32_MAX),    optionListPtr),
+    opt_tier2_interval          (_cred, "tier2-red",             "conflicts between moving unused tier2 clauses back to the reducible tier", 10000, IntRange(1, INT32_MAX),             optionListPtr),
 
     opt_reduceType              (_cred, "remtype",               "remove clauses (0=glucose/dynamic,1=minisat/geometric,2=fixed limit)", 0, IntRange(0, 2),                                                  optionListPtr),
     opt_learnt_size_factor      (_cred, "rem-lsf",               "factor of learnts compared to original formula", (double)1/(double)3,  DoubleRange(0, false, HUGE_VAL, false),          optionListPtr),
@@ -81,6 +83,8 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
 
     opt_biAsserting             (_cm, "biAsserting",             "Learn bi-asserting clauses, if possible (do not learn asserting clause!)", false,                                       optionListPtr),
     opt_biAssiMaxEvery          (_cm, "biAsFreq",                "The min nr. of clauses between two learned bi-asserting clauses", 4, IntRange(1, INT32_MAX),                            optionListPtr, &opt_biAsserting ),
+    opt_chrono                  (_cm, "chrono",                  "backtrack only one level, if the backjump would undo more than X levels (-1=off)", -1, IntRange(-1, INT32_MAX),         optionListPtr),
+    opt_chrono_confl            (_cm, "chrono-confl",            "number of conflicts before chronological backtracking is used", 0, IntRange(0, INT32_MAX),                           optionListPtr, &opt_chrono),
     opt_lb_size_minimzing_clause(_cm, "minSizeMinimizingClause", "The min size required to minimize clause", 30, IntRange(0, INT32_MAX),                                                  optionListPtr),
     opt_lb_lbd_minimzing_clause (_cm, "minLBDMinimizingClause",  "The min LBD required to minimize clause", 6, IntRange(0, INT32_MAX),                                                    optionListPtr),
 
@@ -89,6 +93,8 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
     opt_lcm_freq                (_cm, "lcm-freq",                "Use LCM after every X reduceDB calls", 2, IntRange(1, INT32_MAX), optionListPtr, &opt_lcm),
     opt_lcm_min_size            (_cm, "lcm-min-size",            "Apply LCM only to clauses that have at least X literals", 1, IntRange(1, INT32_MAX), optionListPtr, &opt_lcm),
     opt_lcm_full                (_cm, "lcm-full",                "at all restarts, always on all learned clauses #NoAutoT", false , optionListPtr, &opt_lcm),
+    opt_vivi_int                (_cm, "vivi-int",                "Vivify irredundant clauses during search every X conflicts (0=off)", 15000, IntRange(0, INT32_MAX),                     optionListPtr),
+    opt_vivi_effort             (_cm, "vivi-effort",             "Propagations for vivification, per mille of the search propagations since the last round", 100, IntRange(1, 10000),   optionListPtr, &opt_vivi_int),
 #ifndef NDEBUG
     opt_lcm_dbg                 (_cm, "lcm-dbg",                 "debug LCM computation #NoAutoT", 0, IntRange(0, 5), optionListPtr),
 #endif
@@ -106,6 +112,10 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
     opt_phase_bit_level         (_cs,   "phase-bit",             "decision level until which the bit phase is used", 0, IntRange(0, INT32_MAX),                                           optionListPtr),
     opt_phase_bit_number        (_cs,   "phase-bitmod",          "mod of bits of the counter to be used to select bits for bit phase", 4, IntRange(1, 64),                                optionListPtr, &opt_phase_bit_level),
     opt_phase_bit_invert        (_cs,   "phase-bitinv",          "invert value of polarity assigned by bit-strategy", false,                                                              optionListPtr, &opt_phase_bit_level),
+    opt_target_phase            (_cs,   "target-phase",          "decide with the phase of the largest conflict-free trail since the last rephase", false,                                optionListPtr),
+    opt_rephase                 (_cs,   "rephase",               "conflicts between two rephases, the interval grows linearly (0=off)", 0, IntRange(0, INT32_MAX),                         optionListPtr),
+    opt_rephase_seq             (_cs,   "rephase-seq",           "rephase schedule (O=original,I=inverted,B=best,T=target,R=random,W=walk)", "BOBIBTBRBW",                                optionListPtr, &opt_rephase),
+    opt_rephase_walk            (_cs,   "rephase-walk",          "flips of the local search in walk phases (seeded with best phases, needs coprocessor)", 100000, IntRange(0, INT32_MAX), optionListPtr, &opt_rephase),
     opt_rnd_init_act            (_init, "rnd-init",              "Randomize the initial activity", false,                                                                                 optionListPtr),
     opt_init_act                (_init, "init-act",              "initialize activities (0=none,1=inc-lin,2=inc-geo,3=dec-lin,4=dec-geo,5=rnd,6=abs(jw))", 0, IntRange(0, 6),             optionListPtr),
     opt_init_pol                (_init, "init-pol",              "initialize polarity (0=none,1=JW-pol,2=JW-neg,3=MOMS,4=MOMS-neg,5=rnd,6=pos)", 0, IntRange(0, 6),                       optionListPtr),
@@ -128,6 +138,9 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
     opt_dynamic_rtype_ratio     (_crsw, "rsw-iratio",            "Percentage of dynamic restarts in switch intervals", 0.6666, DoubleRange(0, true, 1, true),                             optionListPtr, &opt_rswitch_isize),
 
     opt_garbage_frac            (_cat,   "gc-frac",              "The fraction of wasted memory allowed before a garbage collection is triggered", 0.20, DoubleRange(0, false, 1, false), optionListPtr),
+    opt_gc_compact              (_cat,   "gc-compact",           "Compact the clause arena in place during garbage collection, instead of copying it", true,                              optionListPtr),
+    opt_gc_region               (_cat,   "gc-region",            "Words per compaction region, regions before the first one with much garbage stay in place (0=all)", 1 << 20, IntRange(0, INT32_MAX), optionListPtr, &opt_gc_compact),
+    opt_huge_pages              (_cat,   "hugepages",            "Back the clause arena, watch lists and variable data with transparent huge pages (madvise)", false,                     optionListPtr),
 
     opt_allUipHack              (_cs, "alluiphack",              "learn all unit UIPs at any level", 0, IntRange(0, 2),                                                                   optionListPtr),
     opt_vsids_start             (_cs,    "vsids-s",              "interpolate between VSIDS and VMTF,start value", 1, DoubleRange(0, true, 1, true),                                      optionListPtr),
@@ -168,6 +181,8 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
     #endif
 
     opt_long_conflict       ("REASON", "longConflict", "if a binary conflict is found, check for a longer one!", false, optionListPtr),
+    opt_implicit_binaries   ("REASON", "implBin",      "keep binary clauses only in the watch lists during search (not with BIG techniques)", false, optionListPtr),
+    opt_simd                ("REASON", "simd",         "use AVX2 kernels for watch search and LBD computation (if supported by the CPU)", true, optionListPtr),
 
     // extra
     opt_act            (_init, "actIncMode", "how to inc 0=lin, 1=geo,2=reverse-lin,3=reverse-geo", 0, IntRange(0, 3),           optionListPtr),
@@ -281,6 +296,9 @@ CoreConfig::CoreConfig(const std::string& presetOptions)  // add new options her
     opt_usePPpp(_misc, "usePP",         "use preprocessor for preprocessing #NoAutoT", true,                                                                                   optionListPtr),
     opt_usePPip(_misc, "useIP",         "use preprocessor for inprocessing #NoAutoT", true,                                                                                    optionListPtr),
 
+    opt_checkpointFile (_misc, "checkpoint",      "write the search state into this file on SIGUSR1 (and periodically), to resume later #NoAutoT", 0,                        optionListPtr),
+    opt_checkpointEvery(_misc, "checkpointEvery", "write a checkpoint every X conflicts (0=only on request) #NoAutoT", 0, IntRange(0, INT32_MAX),                          optionListPtr, &opt_checkpointFile),
+
     //
     // for incremental solving
     //
@@ -70,6 +70,8 @@ class CoreConfig : public Config
     BoolOption opt_rem_inc_lbd;  // reset delete flag if LBD of a learned clause increases
     BoolOption opt_quick_reduce; // check clause for being satisfied based on the first two literals only!
     DoubleOption opt_keep_worst_ratio; // keep this (relative to all learnt clauses) number of worst learnt clauses
+    IntOption opt_tier2_lbd;           // learnt clauses with at most this LBD are kept in the tier2 vector, which is not touched by reduceDB
+    IntOption opt_tier2_interval;      // conflicts between two checks for unused tier2 clauses
 
     IntOption     opt_reduceType;          // which strategy to be used
     DoubleOption  opt_learnt_size_factor;
@@ -82,6 +84,8 @@ class CoreConfig : public Config
 
     BoolOption opt_biAsserting; // learn bi-asserting clauses instead of UIP clauses
     IntOption opt_biAssiMaxEvery;   // number of conflicts until another bi-asserting clause is allowed to be learned
+    IntOption opt_chrono;           // backtrack chronologically, if the backjump would undo more than this number of levels
+    IntOption opt_chrono_confl;     // number of conflicts before chronological backtracking is used
     IntOption opt_lb_size_minimzing_clause;
     IntOption opt_lb_lbd_minimzing_clause;
 
@@ -91,6 +95,8 @@ class CoreConfig : public Config
     IntOption opt_lcm_freq;
     IntOption opt_lcm_min_size;
     BoolOption opt_lcm_full;
+    IntOption opt_vivi_int;           // conflicts between two rounds of vivification of irredundant clauses
+    IntOption opt_vivi_effort;        // propagations of a vivification round, in per mille of the search propagations since the last round
     #ifndef NDEBUG
     IntOption opt_lcm_dbg;
     #endif
@@ -108,6 +114,10 @@ class CoreConfig : public Config
     IntOption opt_phase_bit_level;   // decision level until which the bit phase is used
     IntOption opt_phase_bit_number;  // mod of bits of the counter to be used to select bits
     BoolOption opt_phase_bit_invert; // invert the phase of the bit encoding
+    BoolOption opt_target_phase;     // decide with the phase of the largest conflict-free trail
+    IntOption opt_rephase;           // conflicts between resetting the saved phases
+    StringOption opt_rephase_seq;    // schedule of phases that are used for resetting
+    IntOption opt_rephase_walk;      // flips of the local search that is used in walk phases
     BoolOption opt_rnd_init_act;
     IntOption opt_init_act;
     IntOption opt_init_pol;
@@ -129,6 +139,9 @@ class CoreConfig : public Config
     DoubleOption opt_dynamic_rtype_ratio;
 
     DoubleOption opt_garbage_frac;
+    BoolOption opt_gc_compact;        // compact the clause arena in place instead of copying it
+    IntOption opt_gc_region;          // words per compaction region
+    BoolOption opt_huge_pages;        // back the clause arena, watch lists and per-variable data with transparent huge pages
 
     IntOption opt_allUipHack;
     DoubleOption opt_vsids_start; // interpolate between VSIDS and VMTF, start value
@@ -171,6 +184,8 @@ class CoreConfig : public Config
     #endif
 
     BoolOption opt_long_conflict;
+    BoolOption opt_implicit_binaries;     // keep binary clauses in the watch lists only during search, instead of allocating them in the clause allocator
+    BoolOption opt_simd;                  // use AVX2 kernels to search for watches and to compute the LBD, if the CPU supports them
 
 
 // extra
@@ -279,6 +294,9 @@ class CoreConfig : public Config
     BoolOption opt_usePPpp;
     BoolOption opt_usePPip;
 
+    StringOption opt_checkpointFile;  // write the state of the search into this file, to resume the search later
+    IntOption    opt_checkpointEvery; // conflicts between two periodic checkpoints
+
 //
 // for incremental solving
 //
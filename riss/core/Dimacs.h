@@ -23,8 +23,17 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #define RISS_Minisat_Dimacs_h
 
 #include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "riss/utils/ParseUtils.h"
+#include "riss/utils/BinaryCNF.h"
 #include "riss/core/SolverTypes.h"
 
 namespace Riss
@@ -92,6 +101,205 @@ static void parse_DIMACS(gzFile input_stream, Solver& S)
     parse_DIMACS_main(in, S);
 }
 
+//=================================================================================================
+// Parallel DIMACS Parser for uncompressed files:
+
+/** numbers of one part of a memory mapped DIMACS file, as well as the header information of that part */
+struct DimacsChunk {
+    std::vector<int> numbers;   // parsed numbers in the order of the file, each clause is terminated by 0
+    int maxVar;                 // largest variable that appears in this part
+    int headerVars;             // values of the last p line in this part (-1, if there is no p line)
+    int headerClauses;
+    const char* error;          // position of the first character that cannot be parsed (nullptr, if there is no error)
+    DimacsChunk() : maxVar(0), headerVars(-1), headerClauses(-1), error(nullptr) {}
+};
+
+/** parse the digits at p into val
+ *  scans 8 characters at a time to find the end of the number, and falls back to a scalar loop close to the end of the file
+ *  @return position of the first character behind the number
+ */
+static inline const char* scanDimacsNumber(const char* p, const char* end, int& val)
+{
+    val = 0;
+    #if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    while (end - p >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        const uint64_t t = word ^ 0x3030303030303030ULL; // digits become the values 0-9, all other characters are larger
+        const uint64_t nonDigits = (t | (t + 0x0606060606060606ULL)) & 0xF0F0F0F0F0F0F0F0ULL;
+        const int digits = nonDigits == 0 ? 8 : __builtin_ctzll(nonDigits) >> 3;
+        for (int i = 0 ; i < digits; ++ i) { val = val * 10 + (p[i] - '0'); }
+        p += digits;
+        if (digits < 8) { return p; }
+    }
+    #endif
+    while (p < end && *p >= '0' && *p <= '9') { val = val * 10 + (*p - '0'); ++ p; }
+    return p;
+}
+
+/** parse all numbers in [p,end) into the given chunk, p has to be the beginning of a line
+ *  note: comment lines are skipped, p lines are recorded
+ */
+static void parseDimacsChunk(const char* p, const char* end, DimacsChunk& chunk)
+{
+    chunk.numbers.reserve((end - p) / 4);
+    for (;;) {
+        while (p < end && ((*p >= 9 && *p <= 13) || *p == 32)) { ++ p; }
+        if (p >= end) { break; }
+        if (*p == 'c') {  // skip the comment line
+            const char* eol = (const char*)memchr(p, '\n', end - p);
+            p = eol == nullptr ? end : eol + 1;
+            continue;
+        }
+        if (*p == 'p') {  // read header information
+            if (end - p < 5 || strncmp(p, "p cnf", 5) != 0) { chunk.error = p; return; }
+            p += 5;
+            int* const header[2] = { &chunk.headerVars, &chunk.headerClauses };
+            for (int i = 0 ; i < 2; ++ i) {
+                while (p < end && ((*p >= 9 && *p <= 13) || *p == 32)) { ++ p; }
+                if (p >= end || *p < '0' || *p > '9') { chunk.error = p; return; }
+                p = scanDimacsNumber(p, end, *header[i]);
+            }
+            continue;
+        }
+        const bool negative = (*p == '-');
+        if (*p == '-' || *p == '+') { ++ p; }
+        if (p >= end || *p < '0' || *p > '9') { chunk.error = p; return; }
+        int value = 0;
+        p = scanDimacsNumber(p, end, value);
+        chunk.maxVar = value > chunk.maxVar ? value : chunk.maxVar;
+        chunk.numbers.push_back(negative ? -value : value);
+    }
+}
+
+/** parse an uncompressed DIMACS file by mapping it into memory, and parse parts of the file in parallel
+ *  The file is split at line starts, so that the concatenation of the numbers of all parts is the number sequence
+ *  of the file. Afterwards, the clauses are added to the solver in the order of the file.
+ *  @param threads number of threads to be used (0 = number of cores), small files use fewer threads
+ *  @return false, if the file cannot be mapped or is compressed (nothing has been added to the solver in this case)
+ */
+template<class Solver>
+static bool parse_DIMACS_mapped(const char* fileName, Solver& S, int threads)
+{
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0) { return false; }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size < 2) { close(fd); return false; }
+    const size_t size = fileStat.st_size;
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) { close(fd); return false; }
+    const char* data = (const char*)mapped;
+    if ((unsigned char)data[0] == 0x1f && (unsigned char)data[1] == 0x8b) {   // gzip magic number, use the zlib parser
+        munmap(mapped, size);
+        close(fd);
+        return false;
+    }
+    madvise(mapped, size, MADV_SEQUENTIAL);
+
+    if (threads == 0) { threads = std::thread::hardware_concurrency(); }
+    const size_t maxThreads = size / (4 * 1024 * 1024) + 1; // parse at least 4 MB per thread
+    if (threads < 1) { threads = 1; }
+    if ((size_t)threads > maxThreads) { threads = maxThreads; }
+
+    // split the file at line starts
+    std::vector<const char*> bounds(threads + 1, data + size);
+    bounds[0] = data;
+    for (int i = 1 ; i < threads; ++ i) {
+        const char* p = data + (size / threads) * i;
+        if (p < bounds[i - 1]) { p = bounds[i - 1]; }
+        while (p < data + size && p[-1] != '\n') { ++ p; }
+        bounds[i] = p;
+    }
+
+    std::vector<DimacsChunk> chunks(threads);
+    std::vector<std::thread> workers;
+    for (int i = 1 ; i < threads; ++ i) { workers.push_back(std::thread(parseDimacsChunk, bounds[i], bounds[i + 1], std::ref(chunks[i]))); }
+    parseDimacsChunk(bounds[0], bounds[1], chunks[0]);
+    for (size_t i = 0 ; i < workers.size(); ++ i) { workers[i].join(); }
+
+    int vars = 0, clauses = 0, maxVar = 0;
+    for (int i = 0 ; i < threads; ++ i) {
+        if (chunks[i].error != nullptr) {
+            printf("c PARSE ERROR! Unexpected char: %c\n", chunks[i].error < data + size ? *chunks[i].error : ' '), exit(3);
+        }
+        if (chunks[i].headerVars != -1) { vars = chunks[i].headerVars; clauses = chunks[i].headerClauses; }
+        maxVar = chunks[i].maxVar > maxVar ? chunks[i].maxVar : maxVar;
+    }
+    munmap(mapped, size);
+    close(fd);
+
+    // create all variables at once, and add the clauses in the order of the file
+    S.reserveVars(vars > maxVar ? vars : maxVar);
+    while (S.nVars() < maxVar) { S.newVar(); }
+    vec<Lit> lits;
+    int cnt = 0;
+    for (int i = 0 ; i < threads; ++ i) {
+        const std::vector<int>& numbers = chunks[i].numbers;
+        for (size_t j = 0 ; j < numbers.size(); ++ j) {
+            const int parsed_lit = numbers[j];
+            if (parsed_lit == 0) {
+                cnt++;
+                S.addInputClause_(lits); // tell the solver that this clause is an input clause (used only for proof verification)
+                S.addClause_(lits);
+                lits.clear();
+            } else {
+                lits.push((parsed_lit > 0) ? mkLit(parsed_lit - 1) : ~mkLit(-parsed_lit - 1));
+            }
+        }
+        std::vector<int>().swap(chunks[i].numbers);   // free memory of the part early
+    }
+    if (lits.size() != 0) { printf("c PARSE ERROR! Unexpected end of file in the last clause\n"), exit(3); }
+
+    if (vars != S.nVars()) {
+        fprintf(stderr, "c WARNING! DIMACS header mismatch: wrong number of variables.\n");
+    }
+    if (cnt  != clauses) {
+        fprintf(stderr, "c WARNING! DIMACS header mismatch: wrong number of clauses.\n");
+    }
+    return true;
+}
+
+/** Inserts the clauses of a binary CNF file into the solver (undo information and compression map are not used)
+ *  @return false, if the file could not be read (nothing has been added to the solver in this case)
+ */
+template<class Solver>
+static bool parse_BinaryCNF(const char* fileName, Solver& S)
+{
+    BinaryCNF formula;
+    if (!formula.read(fileName)) { return false; }
+
+    S.reserveVars(formula.vars);
+    while (S.nVars() < formula.vars) { S.newVar(); }
+    vec<Lit> lits;
+    for (size_t i = 0 ; i < formula.clauses.size(); ++ i) {
+        const Lit l = formula.clauses[i];
+        if (l == lit_Undef) {
+            S.addInputClause_(lits); // tell the solver that this clause is an input clause (used only for proof verification)
+            S.addClause_(lits);
+            lits.clear();
+        } else {
+            while (var(l) >= S.nVars()) { S.newVar(); }
+            lits.push(l);
+        }
+    }
+    return true;
+}
+
+/** Inserts problem into solver, uses the parallel parser for uncompressed files, and reads binary CNF files
+ *  @param fileName name of the file behind input_stream (nullptr, if the formula is read from stdin)
+ *  @param threads number of threads for the parallel parser (-1 = always use the stream parser)
+ */
+template<class Solver>
+static void parse_DIMACS(const char* fileName, gzFile input_stream, Solver& S, int threads)
+{
+    if (fileName != nullptr && BinaryCNF::isBinaryCNFFile(fileName)) {
+        if (!parse_BinaryCNF(fileName, S)) { printf("c PARSE ERROR! Could not read binary CNF file %s\n", fileName), exit(3); }
+        return;
+    }
+    if (fileName != nullptr && threads >= 0 && parse_DIMACS_mapped(fileName, S, threads)) { return; }
+    parse_DIMACS(input_stream, S);
+}
+
 //=================================================================================================
 
 template<class B, class Solver>
@@ -57,6 +57,16 @@ void printStats(Solver& solver)
     printf("c last block at restart : %" PRIu64 "\n", solver.lastblockatrestart);
     printf("c nb ReduceDB           : %" PRIu64 "\n", solver.nbReduceDB);
     printf("c nb removed Clauses    : %" PRIu64 "\n", solver.nbRemovedClauses);
+    printf("c nb tier2 promoted     : %" PRIu64 " (demoted: %" PRIu64 ")\n", solver.nbTier2Promoted, solver.nbTier2Demoted);
+    printf("c chrono backtracks     : %" PRIu64 " (kept lits: %" PRIu64 ", saved assignments: %" PRIu64 ")\n", solver.nbChronoBacktracks, solver.nbChronoKept, solver.nbChronoSaved);
+    printf("c rephases              : %d (best: %" PRIu64 ", walk: %" PRIu64 ", walk models: %" PRIu64 ")\n", solver.rephasing.rephases, solver.rephasing.bestPhases, solver.rephasing.walkPhases, solver.rephasing.walkModels);
+    printf("c huge pages            : %s (advised: %.2f MB, backed: %.2f MB)\n", solver.hugePages.enabled ? "on" : "off", solver.hugePages.advisedBytes / (1024.0 * 1024.0), memHugePages());
+    if (solver.hugePages.tlbCounted) {
+        printf("c dTLB misses           : %-12" PRIu64 "   (%.3f /propagation)\n", solver.hugePages.tlbMisses,
+               solver.hugePages.tlbPropagations == 0 ? 0 : (double)solver.hugePages.tlbMisses / solver.hugePages.tlbPropagations);
+    } else { printf("c dTLB misses           : n/a (measured with -hugepages or -verb=2, if there is a hardware counter)\n"); }
+    printf("c vivification          : %" PRIu64 " rounds (tried: %" PRIu64 ", strengthened: %" PRIu64 ", removed lits: %" PRIu64 ", removed clauses: %" PRIu64 ", %.2f s)\n",
+           solver.vivification.rounds, solver.vivification.tried, solver.vivification.strengthened, solver.vivification.removedLits, solver.vivification.removedClauses, solver.vivification.time.getCpuTime());
     printf("c nb learnts DL2        : %" PRIu64 "\n", solver.nbDL2);
     printf("c nb learnts size 2     : %" PRIu64 "\n", solver.nbBin);
     printf("c nb learnts size 1     : %" PRIu64 "\n", solver.nbUn);
@@ -94,6 +104,9 @@ static void SIGINT_exit(int signum)
     else { receivedInterupt = true; }
 }
 
+// Write a checkpoint of the search state at the next restart (see option -checkpoint)
+static void SIGUSR1_checkpoint(int signum) { solver->requestCheckpoint(); }
+
 
 //=================================================================================================
 // Main:
@@ -120,6 +133,9 @@ int main(int argc, char** argv)
     BoolOption   opt_modelStyle("MAIN", "oldModel",   "present model on screen in old format", false);
     BoolOption   opt_quiet("MAIN", "quiet",      "Do not print the model", false);
     BoolOption   opt_parseOnly("MAIN", "parseOnly", "abort after parsing", false);
+    IntOption    opt_parseThreads("MAIN", "parseThreads", "Threads to parse uncompressed input files (0=all cores, -1=stream parser only)", 0, IntRange(-1, 256));
+    StringOption opt_binaryOut("MAIN", "bcnf", "write the parsed formula into the given file in binary CNF format, and exit", 0);
+    StringOption opt_resume("MAIN", "resume", "continue the search from the given checkpoint (see -checkpoint) instead of parsing the input", 0);
     BoolOption   opt_cmdLine("MAIN", "cmd", "print the relevant options", false);
     BoolOption   opt_showParam("MAIN", "showUnusedParam", "print parameters after parsing", false);
     IntOption    opt_helpLevel("MAIN", "helpLevel", "Show only partial help.\n", -1, IntRange(-1, INT32_MAX));
@@ -207,6 +223,7 @@ int main(int argc, char** argv)
         // interrupts:
         signal(SIGINT, SIGINT_exit);
         signal(SIGXCPU, SIGINT_exit);
+        signal(SIGUSR1, SIGUSR1_checkpoint);
 
         // Set limit on CPU-time:
         if (cpu_lim != INT32_MAX) {
@@ -318,7 +335,12 @@ int main(int argc, char** argv)
         S->proofFile = (proofFile) ? (string(proofFile) == "stderr" ? stderr : fopen((const char*) proofFile, "wb")) : nullptr ;
         if (opt_proofFormat && strlen(opt_proofFormat) > 0 && S->proofFile != nullptr) { fprintf(S->proofFile, "o proof %s\n", (const char*)opt_proofFormat); }    // we are writing proofs of the given format!
 
-        parse_DIMACS(in, *S);
+        if (opt_resume) {   // the checkpoint replaces the formula
+            if (S->proofFile != nullptr) { printf("c ERROR: proofs cannot be continued from a checkpoint\n"), exit(1); }
+            if (!S->readCheckpoint((const char*)opt_resume)) { exit(1); }
+        } else {
+            parse_DIMACS(argc == 1 ? nullptr : argv[1], in, *S, opt_parseThreads);
+        }
         //printf("\n%d\n", S->nClauses());
         gzclose(in);
         FILE* res = (argc >= 3) ? fopen(argv[2], "wb") : nullptr;
@@ -332,6 +354,9 @@ int main(int argc, char** argv)
             printf("c |                                                                                                       |\n");
         }
 
+        if (opt_binaryOut) {   // convert the formula, and stop
+            exit(S->toBinaryCNF((const char*)opt_binaryOut) ? 0 : 1);
+        }
         if (opt_parseOnly) { exit(0); }  // simply stop here!
 
         // Change to signal-handlers that will only notify the solver and allow it to terminate
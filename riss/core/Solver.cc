@@ -29,6 +29,8 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 **************************************************************************************************/
 
 #include <math.h>
+#include <cstring>
+#include <algorithm>
 
 #include "riss/mtl/Sort.h"
 #include "riss/core/Solver.h"
@@ -39,6 +41,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "coprocessor/CoprocessorTypes.h"
 // to be able to read var files
 #include "riss/utils/VarFileParser.h"
+#include "riss/utils/BinaryCNF.h"
 
 #include "riss/core/EnumerateMaster.h"
 
@@ -77,8 +80,11 @@ Solver::Solver(CoreConfig* externalConfig, const char* configName) :    // CoreC
     , nbRemovedClauses(0), nbReducedClauses(0), nbDL2(0), nbBin(0), nbUn(0), nbReduceDB(0)
     , solves(0), starts(0), decisions(0), rnd_decisions(0), propagations(0), conflicts(0), nbstopsrestarts(0), nbstopsrestartssame(0), lastblockatrestart(0)
     , dec_vars(0), clauses_literals(0), learnts_literals(0), max_literals(0), tot_literals(0)
+    , nbTier2Promoted(0), nbTier2Demoted(0)
+    , nbChronoBacktracks(0), nbChronoKept(0), nbChronoSaved(0)
     , performSimplificationNext(0)
     , nbLCM(0), nbLitsLCM(0), nbConflLits(0), nbLCMattempts(0), nbLCMsuccess(0), npLCMimpDrop(0), nbRound1Lits(0), nbRound2Lits(0), nbLCMfalsified(0)
+    , vivification(config.opt_vivi_int)
     , curRestart(1)
 
 
@@ -87,9 +93,11 @@ Solver::Solver(CoreConfig* externalConfig, const char* configName) :    // CoreC
     , cla_inc(1)
     , var_inc(1)
     , watches(WatcherDeleted(ca))
-//  , watchesBin            (WatcherDeleted(ca))
+    , watchesBin(WatcherDeleted(ca))
 
     , reverseMinimization(config.opt_use_reverse_minimization)  // reverse minimization hack
+    , rephasing(config.opt_target_phase, config.opt_rephase)
+    , hugePages(config.opt_huge_pages)
     , earlyAssumptionConflict(config.opt_earlyAssumptionConflict)
 
     , eqInfo(this)
@@ -101,6 +109,7 @@ Solver::Solver(CoreConfig* externalConfig, const char* configName) :    // CoreC
     , order_heap(VarOrderLt(activity))
     , progress_estimate(0)
     , remove_satisfied(true)
+    , useSimd(config.opt_simd && Simd::avx2Supported())
 
     // removal setup
     , max_learnts(config.opt_max_learnts)
@@ -120,6 +129,19 @@ Solver::Solver(CoreConfig* externalConfig, const char* configName) :    // CoreC
     , propagation_budget(-1)
     , asynch_interrupt(false)
 
+    // implicit binary clauses
+    , implicitBinaryMode(false)
+    , implicitConflict(CRef_Undef)
+    , implicitBinaries(0)
+    , implicitLearntBinaries(0)
+
+    // checkpoints
+    , checkpointRequested(false)
+    , lastCheckpointConflicts(0)
+    , checkpointFile((const char*)config.opt_checkpointFile == 0 ? "" : (const char*)config.opt_checkpointFile)
+    , resumedFromCheckpoint(false)
+    , resumeState(nullptr)
+
     // IPASIR
     , terminationCallbackState(0)
     , terminationCallbackMethod(0)
@@ -241,6 +263,10 @@ Solver::Solver(CoreConfig* externalConfig, const char* configName) :    // CoreC
     // 999 MS hack
     , activityBasedRemoval(config.opt_act_based)
     , lbd_core_threshold(config.opt_lbd_core_thresh)
+    , tier2_lbd_threshold(config.opt_tier2_lbd)
+    , nextTier2Reduce(config.opt_tier2_interval)
+    , tier2StaleEntries(0)
+    , chrono_threshold(config.opt_chrono)
     , learnts_reduce_fraction(config.opt_l_red_frac)
 
     // preprocessor
@@ -324,6 +350,7 @@ Solver::~Solver()
     if (coprocessor != 0) { delete coprocessor; coprocessor = 0; }
     if (deleteConfig) { delete privateConfig; privateConfig = 0; }
     if (learnCallbackBuffer != 0) { delete [] learnCallbackBuffer; learnCallbackBuffer = 0; }
+    if (resumeState != nullptr) { delete resumeState; resumeState = nullptr; }
 }
 
 
@@ -336,6 +363,8 @@ Var Solver::newVar(bool sign, bool dvar, char type)
     int v = nVars();
     watches  .init(mkLit(v, false));
     watches  .init(mkLit(v, true));
+    watchesBin.init(mkLit(v, false));
+    watchesBin.init(mkLit(v, true));
 
     varFlags. push(VarFlags(sign));
 
@@ -359,6 +388,12 @@ Var Solver::newVar(bool sign, bool dvar, char type)
         reverseMinimization.trail.capacity(v + 1);
     }
 
+    if (rephasing.enabled) {
+        rephasing.original.push(sign);
+        rephasing.target.push(2);
+        rephasing.best.push(2);
+    }
+
     // space for replacement info
     assert(v == eqInfo.replacedBy.size() && "new variables have to match the size");
     eqInfo.replacedBy.push(mkLit(v, false));
@@ -378,8 +413,8 @@ void Solver::reserveVars(Var v)
 {
     watches  .init(mkLit(v, false));
     watches  .init(mkLit(v, true));
-//    watchesBin  .init(mkLit(v, false));
-//    watchesBin  .init(mkLit(v, true ));
+    watchesBin.init(mkLit(v, false));
+    watchesBin.init(mkLit(v, true));
 
 //     assigns  .capacity(v+1);
     vardata  .capacity(v + 1);
@@ -698,8 +733,9 @@ void Solver::attachClause(CRef cr)
     assert(c.mark() == 0 && "satisfied clauses should not be attached!");
 
     if (c.size() == 2) {
-        watches[~c[0]].push(Watcher(cr, c[1], 0)); // add watch element for binary clause
-        watches[~c[1]].push(Watcher(cr, c[0], 0)); // add watch element for binary clause
+        watchesBin[~c[0]].push(Watcher(cr, c[1], 0)); // add watch element for binary clause
+        watchesBin[~c[1]].push(Watcher(cr, c[0], 0)); // add watch element for binary clause
+        if (big != 0) { big->addEdge(c[0], c[1]); }    // learned, received or shrinked binary clause, added to the BIG during the next reduction
     } else {
         watches[~c[0]].push(Watcher(cr, c[1], 1));
         watches[~c[1]].push(Watcher(cr, c[0], 1));
@@ -711,6 +747,13 @@ void Solver::attachClause(CRef cr)
 
 
 
+/** remove the watch from the list, keep the order of the remaining watches, unless fast removal is used */
+template<class List>
+static inline void removeWatch(List& list, const Watcher& w, bool fast)
+{
+    if (fast) { removeUnSort(list, w); }
+    else { remove(list, w); } // linear (touchs all elements)!
+}
 
 void Solver::detachClause(CRef cr, bool strict)
 {
@@ -726,17 +769,21 @@ void Solver::detachClause(CRef cr, bool strict)
 
     const int watchType = c.size() == 2 ? 0 : 1; // have the same code only for different watch types!
     if (strict) {
-        if (config.opt_fast_rem) {
-            removeUnSort(watches[~c[0]], Watcher(cr, c[1], watchType));
-            removeUnSort(watches[~c[1]], Watcher(cr, c[0], watchType));
+        if (c.size() == 2) {
+            BinWatchLists::List first = watchesBin[~c[0]], second = watchesBin[~c[1]];
+            removeWatch(first, Watcher(cr, c[1], watchType), config.opt_fast_rem);
+            removeWatch(second, Watcher(cr, c[0], watchType), config.opt_fast_rem);
         } else {
-            remove(watches[~c[0]], Watcher(cr, c[1], watchType)); // linear (touchs all elements)!
-            remove(watches[~c[1]], Watcher(cr, c[0], watchType)); // linear (touchs all elements)!
+            removeWatch(watches[~c[0]], Watcher(cr, c[1], watchType), config.opt_fast_rem);
+            removeWatch(watches[~c[1]], Watcher(cr, c[0], watchType), config.opt_fast_rem);
         }
     } else {
         // Lazy detaching: (NOTE! Must clean all watcher lists before garbage collecting this clause)
+        // clauses might have been shrinked after attaching them, hence smudge the lists for both clause sizes
         watches.smudge(~c[0]);
         watches.smudge(~c[1]);
+        watchesBin.smudge(~c[0]);
+        watchesBin.smudge(~c[1]);
     }
 
     if (c.learnt()) { learnts_literals -= c.size(); }
@@ -767,6 +814,102 @@ void Solver::removeClause(Riss::CRef cr, bool strict)
 }
 
 
+void Solver::attachImplicitBinary(const Lit& a, const Lit& b, bool learnt)
+{
+    assert(var(a) != var(b) && "binary clause has to have two different variables");
+    watchesBin[~a].push(Watcher(CRef_Error, b, learnt ? 3 : 2));   // there is no clause in the allocator
+    watchesBin[~b].push(Watcher(CRef_Error, a, learnt ? 3 : 2));
+
+    if (learnt) { learnts_literals += 2; implicitLearntBinaries ++; }
+    else        { clauses_literals += 2; implicitBinaries ++; }
+}
+
+
+void Solver::moveBinariesToWatches(vec<CRef>& list)
+{
+    int keptClauses = 0;
+    for (int i = 0 ; i < list.size(); ++ i) {
+        const CRef cr = list[i];
+        Clause& c = ca[cr];
+        if (c.size() != 2 || c.mark() != 0 || c.can_be_deleted()) { list[keptClauses++] = cr; continue; }
+
+        // literals that are implied by this clause use the other literal as reason from now on
+        for (int k = 0 ; k < 2; ++ k) {
+            const Var v = var(c[k]);
+            if (value(c[k]) == l_True && !reason(v).isBinaryClause() && reason(v).getReasonC() == cr) {
+                vardata[v].reason.setReason(~c[1 - k]);
+            }
+        }
+
+        detachClause(cr);   // lazy detach, the watches are removed during the next clean
+        attachImplicitBinary(c[0], c[1], c.learnt());
+        c.mark(1);
+        ca.free(cr);
+    }
+    list.shrink_(list.size() - keptClauses);
+}
+
+
+void Solver::implicitizeBinaries()
+{
+    #ifdef PCASSO
+    return; // the dependency level of clauses is stored in the clause allocator
+    #endif
+    if (!config.opt_implicit_binaries || big != 0 || nVars() == 0) { return; }  // the BIG is built from the clauses in ca
+
+    if (implicitConflict == CRef_Undef) {  // allocate the clause that represents conflicts of implicit binary clauses
+        add_tmp.clear();
+        add_tmp.push(lit_Undef); add_tmp.push(mkLit(0, false));   // place holders, the literals are set for each conflict
+        implicitConflict = ca.alloc(add_tmp, false);
+    }
+
+    implicitBinaryMode = true;
+    moveBinariesToWatches(clauses);
+    moveBinariesToWatches(learnts);
+}
+
+
+void Solver::materializeImplicitBinaries()
+{
+    if (!implicitBinaryMode) { return; }
+    implicitBinaryMode = false;
+
+    vec<CRef> newClauses;
+    watchesBin.cleanAll();
+    for (int v = 0; v < nVars(); v++)
+        for (int s = 0; s < 2; s++) {
+            const Lit p = mkLit(v, s);
+            BinWatchLists::List ws = watchesBin[p];
+            int j = 0;
+            for (int i = 0 ; i < ws.size(); ++ i) {
+                if (!ws[i].isImplicit()) { ws[j++] = ws[i]; continue; }
+                const Lit q = ws[i].blocker();
+                if (toInt(~p) > toInt(q)) { continue; }  // the clause [~p,q] is present in the lists of p and ~q, allocate it only once
+                const bool learnt = ws[i].isLearntImplicit();
+                add_tmp.clear(); add_tmp.push(~p); add_tmp.push(q);
+                const CRef cr = ca.alloc(add_tmp, learnt);
+                if (learnt) {
+                    ca[cr].setLBD(2);
+                    ca[cr].setUsedInAnalyze(); ca[cr].setPropagated();  // this clause has been shared before, do not share it once more
+                    learnts.push(cr); learnts_literals -= 2;
+                } else {
+                    clauses.push(cr); clauses_literals -= 2;
+                }
+                newClauses.push(cr);
+            }
+            ws.shrink_(ws.size() - j);
+        }
+
+    for (int i = 0 ; i < newClauses.size(); ++ i) { attachClause(newClauses[i]); }
+
+    if (implicitConflict != CRef_Undef) {
+        ca[implicitConflict].mark(1);
+        ca.free(implicitConflict);
+        implicitConflict = CRef_Undef;
+    }
+}
+
+
 bool Solver::satisfied(const Clause& c) const
 {
 
@@ -797,15 +940,15 @@ bool Solver::minimisationWithBinaryResolution(vec< Lit >& out_learnt, unsigned i
     if (lbd <= searchconfiguration.lbLBDMinimizingClause) {
         lbd_marker.nextStep();
         for (int i = 1; i < out_learnt.size(); i++) { lbd_marker.setCurrentStep(var(out_learnt[i])); }
-        const vec<Watcher>&  wbin  = watches[p]; // const!
+        const BinWatchLists::List  wbin  = watchesBin[p]; // const!
         int nb = 0;
         for (int k = 0; k < wbin.size(); k++) {
-            if (!wbin[k].isBinary()) { continue; }   // has been looping on binary clauses only before!
             const Lit imp = wbin[k].blocker();
             if (lbd_marker.isCurrentStep(var(imp)) && value(imp) == l_True) {
                 nb++;
                 lbd_marker.reset(var(imp));
                 #ifdef PCASSO
+                assert(!wbin[k].isImplicit() && "pcasso does not use implicit binary clauses");
                 dependencyLevel = dependencyLevel >= ca[wbin[k].cref()].getPTLevel() ? dependencyLevel : ca[wbin[k].cref()].getPTLevel();
                 #endif
             }
@@ -1004,8 +1147,14 @@ void Solver::cancelUntil(int level)
 {
     if (decisionLevel() > level) {
         DOUT(if (config.opt_learn_debug) cerr << "c call cancel until " << level << " move propagation head from " << qhead << " to " << trail_lim[level] << endl;);
+        if (rephasing.enabled) { saveTargetPhases(level); }
+        chronoKeptLits.clear();
         for (int c = trail.size() - 1; c >= trail_lim[level]; c--) {
             Var      x  = var(trail[c]);
+            if (chrono_threshold >= 0 && vardata[x].level <= level) {   // out-of-order literal of a lower level stays assigned
+                chronoKeptLits.push(trail[c]);
+                continue;
+            }
             varFlags [x].assigns = l_Undef;
             vardata [x].dom = lit_Undef; // reset dominator
             vardata [x].reason.setReason(CRef_Undef);   // TODO for performance this is not necessary, but for assertions and all that!
@@ -1018,7 +1167,116 @@ void Solver::cancelUntil(int level)
         realHead = trail_lim[level];
         trail.shrink_(trail.size() - trail_lim[level]);
         trail_lim.shrink_(trail_lim.size() - level);
+        for (int i = chronoKeptLits.size() - 1; i >= 0; --i) {   // put kept literals back in their original order, they are propagated again
+            vardata[var(chronoKeptLits[i])].position = trail.size();
+            trail.push_(chronoKeptLits[i]);
+        }
+        nbChronoKept += chronoKeptLits.size();
+    }
+}
+
+void Solver::saveTargetPhases(int level)
+{
+    const int consistent = rephasing.consistentTrail < trail.size() ? rephasing.consistentTrail : trail.size();
+    if (consistent > rephasing.targetSize) {
+        for (int i = 0 ; i < consistent; ++ i) { rephasing.target[var(trail[i])] = sign(trail[i]); }
+        rephasing.targetSize = consistent;
+    }
+    if (consistent > rephasing.bestSize) {
+        for (int i = 0 ; i < consistent; ++ i) { rephasing.best[var(trail[i])] = sign(trail[i]); }
+        rephasing.bestSize = consistent;
+    }
+    // only the part below the backtrack level stays conflict-free
+    rephasing.consistentTrail = trail_lim[level] < consistent ? trail_lim[level] : consistent;
+}
+
+void Solver::adviseHugePages()
+{
+    uint64_t advised = ca.useHugePages(true);
+    advised += advise_huge_pages((VarData*)vardata, sizeof(VarData) * vardata.capacity());
+    advised += advise_huge_pages((VarFlags*)varFlags, sizeof(VarFlags) * varFlags.capacity());   // contains the assignment
+    advised += watches.adviseHugePages() + watchesBin.adviseHugePages();   // also covers the elements of the watch lists
+    hugePages.advisedBytes = advised;
+    hugePages.advises ++;
+    hugePages.nextAdvise = 2 * conflicts + 10000;   // the heap and the arrays might grow during search
+}
+
+void Solver::rephase()
+{
+    const int scheduleSize = strlen((const char*)config.opt_rephase_seq);
+    char phase = scheduleSize == 0 ? 'B' : ((const char*)config.opt_rephase_seq)[ rephasing.rephases % scheduleSize ];
+    rephasing.rephases ++;
+    rephasing.nextRephase = conflicts + (uint64_t)config.opt_rephase * (rephasing.rephases + 1);   // rephase less often over time
+
+    if (phase == 'W') {
+        bool walked = false, foundModel = false;
+        if (coprocessor != 0 && config.opt_rephase_walk > 0) {
+            vec<char> phases;
+            if (rephasing.bestSize > 0) { rephasing.best.copyTo(phases); }
+            else {
+                phases.growTo(nVars());
+                for (Var v = 0 ; v < nVars(); ++ v) { phases[v] = varFlags[v].polarity; }
+            }
+            walked = coprocessor->localSearchPhases(phases, config.opt_rephase_walk, foundModel);
+            if (walked) {
+                for (Var v = 0 ; v < nVars(); ++ v) { varFlags[v].polarity = phases[v]; }
+                rephasing.walkPhases ++;
+                if (foundModel) { rephasing.walkModels ++; }
+            }
+        }
+        if (!walked) { phase = 'B'; }   // fall back to the best phase, if local search cannot be used
+    }
+
+    switch (phase) {
+    case 'O':
+        for (Var v = 0 ; v < nVars(); ++ v) { varFlags[v].polarity = rephasing.original[v]; }
+        rephasing.originalPhases ++;
+        break;
+    case 'I':
+        for (Var v = 0 ; v < nVars(); ++ v) { varFlags[v].polarity = !rephasing.original[v]; }
+        rephasing.invertedPhases ++;
+        break;
+    case 'B':
+        for (Var v = 0 ; rephasing.bestSize > 0 && v < nVars(); ++ v) {
+            if (rephasing.best[v] != 2) { varFlags[v].polarity = rephasing.best[v]; }
+        }
+        rephasing.bestSize = 0;
+        rephasing.bestPhases ++;
+        break;
+    case 'T':
+        for (Var v = 0 ; v < nVars(); ++ v) {
+            if (rephasing.target[v] != 2) { varFlags[v].polarity = rephasing.target[v]; }
+        }
+        rephasing.targetPhases ++;
+        break;
+    case 'R':
+        for (Var v = 0 ; v < nVars(); ++ v) { varFlags[v].polarity = irand(random_seed, 2); }
+        rephasing.randomPhases ++;
+        break;
+    default:
+        break;
     }
+
+    // the new phases are the target until a larger conflict-free trail has been seen
+    for (Var v = 0 ; v < nVars(); ++ v) { rephasing.target[v] = varFlags[v].polarity; }
+    rephasing.targetSize = 0;
+    DOUT(if (config.opt_printDecisions > 0) cerr << "c rephase " << rephasing.rephases << " with phase " << phase << " at conflict " << conflicts << endl;);
+}
+
+int Solver::implicationLevel(const Lit p, const CRef from) const
+{
+    assert(from != CRef_Undef && "decisions are assigned on the current level");
+    const Clause& c = ca[from];
+    int maxLevel = 0;
+    for (int i = 0 ; i < c.size(); ++ i) {
+        if (var(c[i]) == var(p)) { continue; }
+        const int l = level(var(c[i]));
+        if (l > maxLevel) {
+            maxLevel = l;
+            if (maxLevel == decisionLevel()) { break; }   // cannot get any higher
+        }
+    }
+    return maxLevel;
 }
 
 
@@ -1100,6 +1358,7 @@ Lit Solver::pickBranchLit()
     // first path is usually chosen, one if
     if (next != var_Undef && !posInAllClauses && !negInAllClauses) {
         bool assignFalse = varFlags[next].polarity;           // usual phase saving
+        if (rephasing.useTarget && rephasing.target[next] != 2) { assignFalse = rephasing.target[next]; }   // target phase
         if (decisionLevel() < config.opt_phase_bit_level) {   // bit phase saving
             assignFalse = curr_restarts >> (decisionLevel() % config.opt_phase_bit_number) & 1;
             if (config.opt_phase_bit_invert) { assignFalse = !assignFalse; }
@@ -1129,6 +1388,11 @@ void Solver::updateMetricsDuringAnalyze(const Lit p, const CRef cr, Clause& c, b
         #endif
         c.setUsedInAnalyze();
     }
+    if (c.isTier2()) { c.setTierUsed(true); }   // keep the clause in tier2 during the next tier2 reduction
+    if (c.importedFrom() >= 0 && !c.wasImportUsed() && communication != 0) {   // tell the sender that the clause was useful
+        c.setImportUsed();
+        communication->data->reportUsefulImport(communication->getID(), c.importedFrom());
+    }
     if (!foundFirstLearnedClause) {  // dynamic adoption only until first learned clause!
         if (c.learnt()) {
             if (config.opt_cls_act_bump_mode == 0) { claBumpActivity(c); }
@@ -1152,7 +1416,7 @@ void Solver::updateMetricsDuringAnalyze(const Lit p, const CRef cr, Clause& c, b
                         // from being dropped immediately (by fast-paced periodic clause database reduction)
                         // they are marked as protected
                         c.setCoreClause(true);
-                    }
+                    } else { updateLearntTier(cr, c); }
                 } else if (config.opt_rem_inc_lbd && nblevels > c.lbd()) { c.setCanBeDel(true); }
             }
         }
@@ -1224,7 +1488,7 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel, unsigned
         }
 
         for (int j = (p == lit_Undef) ? 0 : 1; j < clauseSize; j++) {
-            const Lit& q = currentReason.isBinaryClause() ? currentReason.getReasonL() : (*c)[j]; // get reason literal
+            const Lit q = currentReason.isBinaryClause() ? ~currentReason.getReasonL() : (*c)[j]; // get reason literal (the binary reason is the satisfied literal, the clause contains its complement)
             DOUT(if (config.opt_learn_debug) cerr << "c level for " << q << " is " << level(var(q)) << endl;);
             // TODO display reason in the line above!
             if (!varFlags[var(q)].seen && level(var(q)) > 0) { // variable is not in the clause, and not on top level
@@ -1285,7 +1549,7 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel, unsigned
         if (!isOnlyUnit && units > 0) { break; }   // do not consider the next clause, because we cannot continue with units
 
         // Select next clause to look at:
-        while (! varFlags[ var(trail[index--]) ].seen) {}    // cerr << "c check seen for literal " << (sign(trail[index]) ? "-" : " ") << var(trail[index]) + 1 << " at index " << index << " and level " << level( var( trail[index] ) )<< endl;
+        while (! varFlags[ var(trail[index--]) ].seen || (chrono_threshold >= 0 && level(var(trail[index + 1])) < decisionLevel())) {}    // skip literals of lower levels, which are on the trail out of order with chronological backtracking // cerr << "c check seen for literal " << (sign(trail[index]) ? "-" : " ") << var(trail[index]) + 1 << " at index " << index << " and level " << level( var( trail[index] ) )<< endl;
         p     = trail[index + 1];
         currentReason = reason(var(p));
         DOUT(if (config.opt_learn_debug) cerr << "c reset seen for " << p << endl;);
@@ -1319,7 +1583,7 @@ int Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel, unsigned
         out_learnt[0] = ~p; // add the last literal to the clause
         if (pathC > 0) {   // in case of bi-asserting clauses, the remaining literals have to be collected
             // look for second literal of this level
-            while (! varFlags[var(trail[index--])].seen);
+            while (! varFlags[var(trail[index--])].seen || (chrono_threshold >= 0 && level(var(trail[index + 1])) < decisionLevel()));
             p = trail[index + 1];
             out_learnt.push(~p);
         }
@@ -1772,11 +2036,11 @@ void Solver::uncheckedEnqueue(Lit p, Riss::CRef from, bool addToProof, const uns
     assert(value(p) == l_Undef && "cannot enqueue a wrong value");
     varFlags[var(p)].assigns = lbool(!sign(p));
     /** include variableExtraInfo here, if required! */
-    vardata[var(p)] = mkVarData(from, decisionLevel());
+    vardata[var(p)] = mkVarData(from, (chrono_threshold < 0 || from == CRef_Undef) ? decisionLevel() : implicationLevel(p, from));
     vardata[var(p)].position = (int)trail.size(); // to sort learned clause for extra analysis
 
     // prefetch watch lists
-    // __builtin_prefetch( & watchesBin[p], 1, 0 ); // prefetch the watch, prepare for a write (1), the data is highly temoral (0)
+    __builtin_prefetch(watchesBin[p].data(), 0, 0); // prefetch the binary watches, they are only read (0), the data is highly temoral (0)
     __builtin_prefetch(& watches[p], 1, 0);   // prefetch the watch, prepare for a write (1), the data is highly temoral (0)
     DOUT(if (config.opt_printDecisions > 1) {cerr << "c unchecked enqueue " << p; if (from != CRef_Undef) { cerr << " because of [" << from << "] " <<  ca[from]; } cerr << endl;});
 
@@ -1797,11 +2061,11 @@ void Solver::uncheckedEnqueue(Lit p, Riss::Lit fromLit, bool addToProof, const u
     assert(value(p) == l_Undef && "cannot enqueue a wrong value");
     varFlags[var(p)].assigns = lbool(!sign(p));
     /** include variableExtraInfo here, if required! */
-    vardata[var(p)] = mkVarData(fromLit, decisionLevel());
+    vardata[var(p)] = mkVarData(fromLit, chrono_threshold < 0 ? decisionLevel() : level(var(fromLit)));
     vardata[var(p)].position = (int)trail.size(); // to sort learned clause for extra analysis
 
     // prefetch watch lists
-    // __builtin_prefetch( & watchesBin[p], 1, 0 ); // prefetch the watch, prepare for a write (1), the data is highly temoral (0)
+    __builtin_prefetch(watchesBin[p].data(), 0, 0); // prefetch the binary watches, they are only read (0), the data is highly temoral (0)
     __builtin_prefetch(& watches[p], 1, 0);   // prefetch the watch, prepare for a write (1), the data is highly temoral (0)
     DOUT(if (config.opt_printDecisions > 1) {cerr << "c unchecked enqueue " << p << " implied by " << fromLit << endl;});
 
@@ -1828,41 +2092,41 @@ CRef Solver::propagate(bool duringAddingClauses)
 
     CRef    confl     = CRef_Undef;
     int     num_props = 0;
-    watches.cleanAll(); clssToBump.clear();
+    watches.cleanAll(); watchesBin.cleanAll(); clssToBump.clear();
 
     const bool no_long_conflict = !config.opt_long_conflict;
     const bool update_lbd = config.opt_update_lbd == 0;
     const bool share_clauses = sharingTimePoint == 1 && communication != 0;
+    const bool simd_scan = useSimd && nVars() < INT32_MAX / (int)sizeof(VarFlags);   // offsets of the kernel have 32 bit
+    const uint8_t* values = nVars() == 0 ? 0 : (const uint8_t*)&varFlags[0].assigns;
 
     while (qhead < trail.size()) {
         Lit            p   = trail[qhead++];     // 'p' is enqueued fact to propagate.
         DOUT(if (config.opt_learn_debug) cerr << "c propagate literal " << p << endl;);
         realHead = qhead;
-        vec<Watcher>&  ws  = watches[p];
-        Watcher        *i, *j, *end;
         num_props++;
 
-        // propagate longer clauses here!
-        for (i = j = (Watcher*)ws, end = i + ws.size();  i != end;) {
-            if (i->isBinary()) {   // handle binary clauses
-                const Lit& imp = i->blocker();
-                assert(ca[ i->cref() ].size() == 2 && "in this list there can only be binary clauses");
-                DOUT(if (config.opt_learn_debug) cerr << "c checked binary clause " << ca[i->cref() ] << " with implied literal having value " << (value(imp)) << endl;);
-                if (value(imp) == l_False) {
-                    if (no_long_conflict) {  // stop on the first conflict we see?
-                        confl = i->cref();              // store the conflict
-                        while (i < end) { *j++ = *i++; }    // move the remaining elements forward
-                        ws.shrink_(i - j);              // remove all duplciate clauses
-                        goto FinishedPropagation;       // jump to end of method, so that the statistics can be updated correctly
-                    }
-                    confl = i->cref(); // store intermediate conflict to be evaluated later
-                } else if (value(imp) == l_Undef) { // enqueue the implied literal
-                    uncheckedEnqueue(imp, p, duringAddingClauses); // the reason why the literal "imp" is implied is the literal "p" (which is currently propagated)
+        // propagate binary clauses first, their list is not modified
+        BinWatchLists::List wbin = watchesBin[p];
+        for (const Watcher *k = wbin.data(), *kend = k + wbin.size(); k != kend; ++k) {
+            const Lit& imp = k->blocker();
+            assert((k->isImplicit() || ca[ k->cref() ].size() == 2) && "in this list there can only be binary clauses");
+            DOUT(if (config.opt_learn_debug) cerr << "c checked binary clause [" << ~p << ", " << imp << "] with implied literal having value " << (value(imp)) << endl;);
+            if (value(imp) == l_False) {
+                confl = k->isImplicit() ? implicitBinaryConflict(~p, imp) : k->cref(); // store the conflict
+                if (no_long_conflict) {  // stop on the first conflict we see?
+                    goto FinishedPropagation;       // jump to end of method, so that the statistics can be updated correctly
                 }
-                *j++ = *i++; // keep the element in the list
-                continue;
+            } else if (value(imp) == l_Undef) { // enqueue the implied literal
+                uncheckedEnqueue(imp, p, duringAddingClauses); // the reason why the literal "imp" is implied is the literal "p" (which is currently propagated)
             }
+        }
+
+        vec<Watcher>&  ws  = watches[p];
+        Watcher        *i, *j, *end;
 
+        // propagate longer clauses here!
+        for (i = j = (Watcher*)ws, end = i + ws.size();  i != end;) {
             DOUT(if (config.opt_learn_debug) cerr << "c check clause [" << i->cref() << "]" << ca[i->cref()] << endl;);
             #ifndef PCASSO // PCASS reduces clauses during search without updating the watch lists ...
 //            assert(ca[ i->cref() ].size() > 2 && "in this list there can only be clauses with more than 2 literals"); (RATE also shrinks clauses during using the solver object)
@@ -1896,13 +2160,20 @@ CRef Solver::propagate(bool duringAddingClauses)
             } // same as goto NextClause;
 
             // Look for new watch:
-            for (int k = 2; k < c.size(); k++)
-                if (value(c[k]) != l_False) {
+            {
+                const int size = c.size();
+                int k = 2;
+                for (; k < 6 && k < size && value(c[k]) == l_False; k++); // most watches are found among the first literals
+                if (k == 6 && k < size) {                                  // scan the remaining literals in blocks
+                    k = simd_scan ? Simd::firstNonFalseAVX2(&c[0], k, size, values, sizeof(VarFlags)) : Simd::firstNonFalse(&c[0], k, size, values, sizeof(VarFlags));
+                }
+                if (k < size) {
                     c[1] = c[k]; c[k] = false_lit;
                     DOUT(if (config.opt_learn_debug) cerr << "c new watched literal for clause " << ca[cr] << " is " << c[1] << endl;);
                     watches[~c[1]].push(w);
                     goto NextClause;
                 } // no need to indicate failure of lhbr, because remaining code is skipped in this case!
+            }
 
 
             // Did not find watch -- clause is unit under assignment:
@@ -1924,6 +2195,17 @@ CRef Solver::propagate(bool duringAddingClauses)
                 }
             } else {
                 DOUT(if (config.opt_learn_debug) cerr << "c current clause is unit clause: " << ca[cr] << endl;);
+                if (chrono_threshold >= 0 && level(var(c[1])) < decisionLevel()) {   // out-of-order implication: watch the literal with the highest level, it is unassigned together with first
+                    int maxIndex = 1;
+                    for (int k = 2; k < c.size(); k++) {
+                        if (level(var(c[k])) > level(var(c[maxIndex]))) { maxIndex = k; }
+                    }
+                    if (maxIndex != 1) {
+                        const Lit tmp = c[1]; c[1] = c[maxIndex]; c[maxIndex] = tmp;
+                        --j;   // the watch has been kept for false_lit already
+                        watches[~c[1]].push(w);
+                    }
+                }
                 uncheckedEnqueue(first, cr, duringAddingClauses);
 
                 // if( config.opt_printLhbr ) cerr << "c final common dominator: " << commonDominator << endl;
@@ -1935,6 +2217,7 @@ CRef Solver::propagate(bool duringAddingClauses)
                             c.setCanBeDel(false);   // LBD of clause improved, so that its not considered for deletion
                         }
                         c.setLBD(newLbd);
+                        updateLearntTier(cr, c);
                     } else if (config.opt_rem_inc_lbd && newLbd > c.lbd()) { c.setCanBeDel(true); }
                 }
             }
@@ -2004,50 +2287,22 @@ void Solver::reduceDB()
     int     i, j;
     nbReduceDB++;
 
-    if (big != 0) {   // build a new BIG that is valid on the current
-        big->recreate(ca, nVars(), clauses, learnts);
-        big->removeDuplicateEdges(nVars());
-        big->generateImplied(nVars(), add_tmp);
+    if (big != 0 && big->hasPendingEdges()) {   // add binary clauses that have been attached since the last reduction, and stamp their components again
+        big->integratePendingEdges(nVars(), add_tmp);
         if (config.opt_uhdProbe > 2) { big->sort(nVars()); }     // sort all the lists once
     }
 
-    double  extra_lim = cla_inc / learnts.size();    // Remove any clause below this activity
+    if (tier2_lbd_threshold > 0) {   // only reduce the local tier, without sorting it
+        reduceLocalTier();
+        if (implicitBinaryMode) { moveBinariesToWatches(learnts); }
+        checkGarbage();
+        reduceDBTime.stop();
+        return;
+    }
 
     if (! activityBasedRemoval) { sort(learnts, reduceDB_lbd_lt(ca)); }    // sort size 2 and lbd 2 to the back!
-    else {
-
-        // automatically choose between activity and LBD based removal!
-        bool useAct = true;
-        if (config.opt_avg_size_lbd_ratio != 0) {  // only perform, if operation is allowed
-            double avgLBD = 0, stddevLBD = 0, avgSIZE = 0, stddevSIZE = 0;
-            double count = 0;
-            for (int i = 0 ; i < learnts.size(); ++ i) {  // calc avg and stddev incrementally in one round
-                Clause& c = ca[ learnts[i] ];
-                if (c.mark() == 0 && c.learnt()) {
-                    count ++;
-                    const double deltaLBD = c.lbd() - avgLBD;
-                    avgLBD = avgLBD + deltaLBD / count;
-                    stddevLBD = stddevLBD + deltaLBD * (c.lbd() - avgLBD);
-                    const double deltaSIZE = c.size() - avgSIZE;
-                    avgSIZE = avgSIZE + deltaSIZE / count;
-                    stddevSIZE = stddevSIZE + deltaSIZE * (c.size() - avgSIZE);
-                }
-            }
-            stddevLBD = (count > 1) ? stddevLBD / (count - 1) : 0.0;
-            stddevSIZE = (count > 1) ? stddevSIZE / (count - 1) : 0.0;
-
-            // choose value based on ratio. negative ratio means that comparison is in the oposite direction
-            useAct = false;
-            if (config.opt_avg_size_lbd_ratio > 0 && stddevLBD * config.opt_avg_size_lbd_ratio > stddevSIZE) {
-                useAct = true;
-            } else if (config.opt_avg_size_lbd_ratio < 0 && stddevLBD * -config.opt_avg_size_lbd_ratio < stddevSIZE) {
-                useAct = true;
-            }
-
-        }
-        if (useAct) { sort(learnts, reduceDB_act_lt(ca)); }
-        else { sort(learnts, reduceDB_lbd_lt(ca)); }
-    }
+    else if (reduceByActivity()) { sort(learnts, reduceDB_act_lt(ca)); }
+    else { sort(learnts, reduceDB_lbd_lt(ca)); }
 
 
     // We have a lot of "good" clauses, it is difficult to compare them. Keep more !
@@ -2088,12 +2343,173 @@ void Solver::reduceDB()
     }
     // FIXME: check whether old variant of removal works with the above code - otherwise include with parameter
     learnts.shrink_(i - j);
+    if (implicitBinaryMode) { moveBinariesToWatches(learnts); }   // binary clauses that have been added since the last reduction (e.g. received or shrinked clauses)
     DOUT(if (config.opt_removal_debug > 0) cerr << "c resulting learnt clauses: " << learnts.size() << endl;);
     checkGarbage();
     reduceDBTime.stop();
 }
 
 
+bool Solver::reduceByActivity()
+{
+    // automatically choose between activity and LBD based removal!
+    bool useAct = true;
+    if (config.opt_avg_size_lbd_ratio != 0) {  // only perform, if operation is allowed
+        double avgLBD = 0, stddevLBD = 0, avgSIZE = 0, stddevSIZE = 0;
+        double count = 0;
+        for (int i = 0 ; i < learnts.size(); ++ i) {  // calc avg and stddev incrementally in one round
+            Clause& c = ca[ learnts[i] ];
+            if (c.mark() == 0 && c.learnt()) {
+                count ++;
+                const double deltaLBD = c.lbd() - avgLBD;
+                avgLBD = avgLBD + deltaLBD / count;
+                stddevLBD = stddevLBD + deltaLBD * (c.lbd() - avgLBD);
+                const double deltaSIZE = c.size() - avgSIZE;
+                avgSIZE = avgSIZE + deltaSIZE / count;
+                stddevSIZE = stddevSIZE + deltaSIZE * (c.size() - avgSIZE);
+            }
+        }
+        stddevLBD = (count > 1) ? stddevLBD / (count - 1) : 0.0;
+        stddevSIZE = (count > 1) ? stddevSIZE / (count - 1) : 0.0;
+
+        // choose value based on ratio. negative ratio means that comparison is in the oposite direction
+        useAct = false;
+        if (config.opt_avg_size_lbd_ratio > 0 && stddevLBD * config.opt_avg_size_lbd_ratio > stddevSIZE) {
+            useAct = true;
+        } else if (config.opt_avg_size_lbd_ratio < 0 && stddevLBD * -config.opt_avg_size_lbd_ratio < stddevSIZE) {
+            useAct = true;
+        }
+    }
+    return useAct;
+}
+
+void Solver::updateLearntTier(CRef cr, Clause& c)
+{
+    if (tier2_lbd_threshold == 0 || !c.learnt() || c.isTier2() || c.size() <= 2 || (int)c.lbd() > tier2_lbd_threshold) { return; }
+    // the entry in learnts is dropped during the next reduction of the local tier
+    c.setTier2(true);
+    c.setTierUsed(true);
+    tier2Learnts.push(cr);
+    tier2StaleEntries ++;
+    nbTier2Promoted ++;
+}
+
+void Solver::reduceTier2()
+{
+    int i, j;
+    if (tier2StaleEntries > 0) {   // demoted clauses are appended to learnts, so their old entries have to be dropped first
+        for (i = j = 0; i < learnts.size(); ++ i) {
+            if (!ca[ learnts[i] ].isTier2()) { learnts[j++] = learnts[i]; }
+        }
+        learnts.shrink_(i - j);
+        tier2StaleEntries = 0;
+    }
+    for (i = j = 0; i < tier2Learnts.size(); ++ i) {
+        Clause& c = ca[ tier2Learnts[i] ];
+        if (c.mark() != 0) { continue; }                                 // clause has been removed already
+        if (!c.learnt()) { c.setTier2(false); continue; }                // clause became a core clause, and is stored in clauses
+        if (!c.wasTierUsed() && !locked(c)) {                            // clause has not been used recently, let reduceDB consider it again
+            c.setTier2(false);
+            learnts.push(tier2Learnts[i]);
+            nbTier2Demoted ++;
+            continue;
+        }
+        c.setTierUsed(false);
+        tier2Learnts[j++] = tier2Learnts[i];
+    }
+    tier2Learnts.shrink_(i - j);
+}
+
+void Solver::reduceLocalTier()
+{
+    // drop entries of clauses that moved to tier2 or became core clauses, and promote clauses with a small LBD
+    int i, j;
+    unsigned minLBD = ~0u;
+    for (i = j = 0; i < learnts.size(); ++ i) {
+        Clause& c = ca[ learnts[i] ];
+        if (c.mark() != 0 || c.isTier2() || !c.learnt()) { continue; }
+        if (c.size() > 2 && (int)c.lbd() <= tier2_lbd_threshold) { updateLearntTier(learnts[i], c); continue; }
+        minLBD = c.lbd() < minLBD ? c.lbd() : minLBD;
+        learnts[j++] = learnts[i];
+    }
+    learnts.shrink_(i - j);
+    tier2StaleEntries = 0;
+
+    const int n = learnts.size();
+    if (n == 0) { return; }
+    CRef* const begin = learnts;
+
+    // select the clauses to be removed instead of sorting: afterwards, [0,delStart) are the worst clauses that are kept,
+    // and [delStart,limit) are the removal candidates, both in arbitrary order
+    const bool useAct = activityBasedRemoval && reduceByActivity();
+    int limit = n * learnts_reduce_fraction;
+    const int delStart = (int)(config.opt_keep_worst_ratio * (double)n);  // keep some of the bad clauses!
+    if (limit < n) {
+        if (useAct) { std::nth_element(begin, begin + limit, begin + n, reduceDB_act_lt(ca)); }
+        else { std::nth_element(begin, begin + limit, begin + n, reduceDB_lbd_lt(ca)); }
+    }
+    if (delStart > 0 && delStart < limit) {
+        if (useAct) { std::nth_element(begin, begin + delStart, begin + limit, reduceDB_act_lt(ca)); }
+        else { std::nth_element(begin, begin + delStart, begin + limit, reduceDB_lbd_lt(ca)); }
+    }
+
+    // We have a lot of "good" clauses, it is difficult to compare them. Keep more !
+    if (limit < n && ca[learnts[limit]].lbd() <= 3) { nbclausesbeforereduce += searchconfiguration.specialIncReduceDB; }
+    // Useless :-)
+    if (minLBD <= 5)  { nbclausesbeforereduce += searchconfiguration.specialIncReduceDB; }
+
+    // protected clauses are kept, so that more candidates are selected from the remaining clauses instead
+    for (int from = delStart; from < limit && limit < n;) {
+        int kept = 0;
+        for (int k = from; k < limit; ++ k) { kept = ca[learnts[k]].canBeDel() ? kept : kept + 1; }
+        if (kept == 0) { break; }
+        const int extended = limit + kept < n ? limit + kept : n;
+        if (extended < n) {
+            if (useAct) { std::nth_element(begin + limit, begin + extended, begin + n, reduceDB_act_lt(ca)); }
+            else { std::nth_element(begin + limit, begin + extended, begin + n, reduceDB_lbd_lt(ca)); }
+        }
+        from = limit;
+        limit = extended;
+    }
+
+    for (i = j = 0; i < n; i++) {
+        Clause& c = ca[learnts[i]];
+        if (i >= delStart
+                && (c.lbd() > 2 || activityBasedRemoval)
+                && c.size() > 2
+                && c.canBeDel()
+                &&  !locked(c)
+                && (i < limit)) {
+            removeClause(learnts[i]);
+            nbRemovedClauses++;
+            DOUT(if (config.opt_removal_debug > 2) cerr << "c remove clause " << c << endl;);
+        } else {
+            c.setCanBeDel(true);       // At the next step, c can be delete
+            learnts[j++] = learnts[i];
+        }
+    }
+    learnts.shrink_(i - j);
+    DOUT(if (config.opt_removal_debug > 0) cerr << "c resulting learnt clauses: " << learnts.size() << " local, " << tier2Learnts.size() << " tier2" << endl;);
+}
+
+void Solver::mergeLearntTiers()
+{
+    if (tier2Learnts.size() == 0) { return; }
+    int i, j;
+    for (i = j = 0; i < learnts.size(); ++ i) {
+        if (!ca[ learnts[i] ].isTier2()) { learnts[j++] = learnts[i]; }
+    }
+    learnts.shrink_(i - j);
+    tier2StaleEntries = 0;
+    for (i = 0; i < tier2Learnts.size(); ++ i) {
+        Clause& c = ca[ tier2Learnts[i] ];
+        if (c.mark() != 0) { continue; }
+        c.setTier2(false);
+        if (c.learnt()) { learnts.push(tier2Learnts[i]); }   // core clauses are stored in clauses already
+    }
+    tier2Learnts.clear();
+}
+
 void Solver::removeSatisfied(vec<CRef>& cs)
 {
     assert(qhead == trail.size() && "only perform in case trail is fully handled as proof already");
@@ -2227,6 +2643,7 @@ bool Solver::simplify()
 {
     // clean watches
     watches.cleanAll();
+    watchesBin.cleanAll();
 
     assert(decisionLevel() == 0);
 
@@ -2250,6 +2667,21 @@ bool Solver::simplify()
         }
         learnts.shrink(i - j);
     }
+    if (tier2_lbd_threshold > 0) {   // drop entries of clauses that are stored in tier2Learnts or clauses, so that they are removed only once
+        int i = 0, j = 0;
+        for (; i < learnts.size(); i++) {
+            if (!ca[learnts[i]].isTier2() && ca[learnts[i]].learnt()) { learnts[j++] = learnts[i]; }
+        }
+        learnts.shrink(i - j);
+        tier2StaleEntries = 0;
+        for (i = j = 0; i < tier2Learnts.size(); i++) {
+            Clause& c = ca[tier2Learnts[i]];
+            if (c.mark() == 0 && c.learnt()) { tier2Learnts[j++] = tier2Learnts[i]; }
+            else { c.setTier2(false); }
+        }
+        tier2Learnts.shrink(i - j);
+        removeSatisfied(tier2Learnts);
+    }
 
     // Remove satisfied clauses:
     removeSatisfied(learnts);
@@ -2419,10 +2851,21 @@ lbool Solver::conflictAnalysis(const CRef confl, vec<Lit>& learnt_clause)
     int ret = analyze(confl, learnt_clause, backtrack_level, nblevels, dependencyLevel);
     analysisTime.stop();
     allowBiAsserting = false;
+    if (vivification.enabled) {   // remember the literals of recent conflicts, to order the candidates for vivification
+        vivification.litConflicts.growTo(2 * nVars(), 0);
+        for (int i = 0 ; i < learnt_clause.size(); ++ i) { vivification.litConflicts[ toInt(learnt_clause[i]) ] ++; }
+    }
     assert((!isBiAsserting || ret == 0) && "cannot be multi unit and bi asserting at the same time");
     DOUT(if (config.opt_rer_debug) cerr << "c analyze returns with " << ret << " , jumpLevel " << backtrack_level << " and set of literals " << learnt_clause << endl;);
     // OTFSS TODO put into extra method!
     bool backTrackedBeyondAsserting = false; // indicate whether learnt clauses can become unit (if no extra backtracking is performed, this stament is true)
+    if (chrono_threshold >= 0 && ret == 0 && !isBiAsserting && !doAddVariablesViaER && learnt_clause.size() > 1
+            && conflicts > (uint64_t)config.opt_chrono_confl && decisionLevel() - backtrack_level > chrono_threshold) {
+        // backtrack chronologically, the asserting literal is assigned out of order on its actual level
+        nbChronoBacktracks ++;
+        nbChronoSaved += trail_lim[decisionLevel() - 1] - trail_lim[backtrack_level];
+        backtrack_level = decisionLevel() - 1;
+    }
     cancelUntil(backtrack_level);  // cancel trail so that learned clause becomes a unit clause
     // add the new clause(s) to the solver, perform more analysis on them
     if (ret > 0) {   // multiple learned clauses
@@ -2789,7 +3232,7 @@ bool Solver::simplifyClause_viviLCM(const Riss::CRef cr, int LCMconfig, bool ful
     assert(qhead == trail.size() && "make sure, we are working on level 0 and the PROOF is up to date!");
     Clause& c = ca[cr];
     bool keepClause = false;
-    bool false_lit = false, sat = false;
+    bool false_lit = false, sat = false, detached = false;
     // in the first 2 positions, there should not be a falsified literal after propagation!
     int i = 2, j = 2;
     if (outputsProof()) { add_tmp.clear(); } // keep track of all literals of the clause to have a proper DRAT proof!
@@ -2819,6 +3262,10 @@ bool Solver::simplifyClause_viviLCM(const Riss::CRef cr, int LCMconfig, bool ful
                     }
                 }
                 nbLCMfalsified += (i - j);
+                if (c.size() - (i - j) == 2) {   // the clause is watched in the long watch lists, which would not be found via its new size
+                    detachClause(cr, true);
+                    detached = true;
+                }
                 c.shrink(i - j);
             }
         }
@@ -2836,11 +3283,16 @@ bool Solver::simplifyClause_viviLCM(const Riss::CRef cr, int LCMconfig, bool ful
 
     if (!config.opt_lcm_full && !fullySimplify) { // use efficiency filters?
         // if clause is in first half of sorted learned clauses, or has been processed in the past, ignore it
+        if (outputsProof() && add_tmp.size() > c.size()) { // falsified literals have been removed above
+            addToProof(c);
+            addToProof(add_tmp, true);
+        }
+        if (detached) { attachClause(cr); } // the clause became binary, and has to be watched again
         return true;
     }
 
     int oldSize = c.size();
-    detachClause(cr, true); // expensive, hence perform as late as possible
+    if (!detached) { detachClause(cr, true); } // expensive, hence perform as late as possible
 
     nbLCMattempts ++;
     // simplifying the clause does not change it's memory location, hence c is still valid afterwards
@@ -2934,6 +3386,7 @@ bool Solver::simplifyLCM()
     assert(decisionLevel() == 0 && "run learned clause minimization only on level 0");
     removeSatisfied(clauses); // TODO: test whether actually necessary when being executed "right after" reduceDB()
     watches.cleanAll();
+    watchesBin.cleanAll();
 
     int ci, cj;
     for (ci = 0, cj = 0; ci < learnts.size(); ci++) {
@@ -2958,6 +3411,74 @@ bool Solver::simplifyLCM()
     return ok;
 }
 
+/** candidate for vivification, clauses with a higher score come first */
+struct ViviCandidate {
+    CRef cr;
+    uint64_t score;
+    bool operator<(const ViviCandidate& other) const { return score > other.score; }
+};
+
+bool Solver::vivifyIrredundant()
+{
+    assert(decisionLevel() == 0 && "vivify only on level 0");
+    vivification.nextConflicts = conflicts + config.opt_vivi_int;
+    const uint64_t budget = (propagations - vivification.lastPropagations) * config.opt_vivi_effort / 1000;
+
+    if (!ok || propagate() != CRef_Undef) {
+        return ok = false;
+    }
+
+    MethodClock viviMethodClock(vivification.time);
+    vivification.rounds ++;
+    removeSatisfied(clauses);
+    watches.cleanAll();
+    watchesBin.cleanAll();
+
+    // clauses that have not been vivified yet, ordered by the occurrences of their literals in recent conflicts
+    vec<ViviCandidate> candidates;
+    vivification.litConflicts.growTo(2 * nVars(), 0);
+    for (int round = 0 ; round < 2 && candidates.size() == 0; ++ round) {
+        for (int i = 0 ; i < clauses.size(); ++ i) {
+            Clause& c = ca[clauses[i]];
+            if (c.mark() || c.size() <= 2) { continue; }
+            if (round == 1) { c.resetLcmSimplified(); }   // all clauses have been vivified, start over
+            if (c.wasLcmSimplified()) { continue; }
+            ViviCandidate candidate = { clauses[i], 0 };
+            for (int j = 0 ; j < c.size(); ++ j) { candidate.score += vivification.litConflicts[ toInt(c[j]) ]; }
+            candidates.push(candidate);
+        }
+    }
+    sort(candidates);
+    vivification.candidates += candidates.size();
+
+    // vivify with the watches of the solver, stop when the propagation budget is used
+    const uint64_t propagationsBefore = propagations;
+    for (int i = 0 ; i < candidates.size() && ok && propagations - propagationsBefore < budget; ++ i) {
+        const Clause& c = ca[ candidates[i].cr ];
+        if (c.mark()) { continue; }   // the clause might have been removed already
+        const int oldSize = c.size();
+        vivification.tried ++;
+        if (!simplifyClause_viviLCM(candidates[i].cr, config.opt_lcm_style, true)) {
+            vivification.removedClauses ++;
+        } else if (c.size() < oldSize) {
+            vivification.strengthened ++;
+            vivification.removedLits += oldSize - c.size();
+        }
+    }
+
+    // drop the clauses that have been removed during vivification
+    int keptClauses = 0;
+    for (int i = 0 ; i < clauses.size(); ++ i) {
+        if (!ca[clauses[i]].mark()) { clauses[keptClauses++] = clauses[i]; }
+    }
+    clauses.shrink_(clauses.size() - keptClauses);
+
+    for (int i = 0 ; i < vivification.litConflicts.size(); ++ i) { vivification.litConflicts[i] = 0; }   // count the next conflicts from scratch
+    vivification.lastPropagations = propagations;
+    checkGarbage();
+    return ok;
+}
+
 /*_________________________________________________________________________________________________
 |
 |  search : (nof_conflicts : int) (params : const SearchParams&)  ->  [lbool]
@@ -2991,22 +3512,34 @@ lbool Solver::search(int nof_conflicts)
             cancelUntil(0);
         }
         performSimplificationNext = 0;
+        mergeLearntTiers();
         sort(learnts, reduceDB_lbd_lt(ca));
         if (!simplifyLCM()) { return l_False; }
         performSimplificationNext = 0;
     }
 
+    // vivify irredundant clauses, with an effort relative to the search since the last round
+    if (vivification.enabled && !vivification.scheduled && conflicts >= vivification.nextConflicts) {
+        if (decisionLevel() > 0) { cancelUntil(0); }
+        if (!vivifyIrredundant()) { return l_False; }
+    }
+
+    // reset the saved phases according to the rephase schedule
+    if (config.opt_rephase > 0 && conflicts >= rephasing.nextRephase) { rephase(); }
+
     for (;;) {
         propagationTime.start();
         const int beforeTrail = trail.size();
         CRef confl = propagate();
         propagationTime.stop();
+        if (rephasing.enabled && confl == CRef_Undef) { rephasing.consistentTrail = trail.size(); }
 
         if (decisionLevel() == 0) { handleTopLevelUnits(beforeTrail, proofTopLevels); }
 
         // in case of full LCM debugging, check for lcm in each round, on level 0, whenever there is no conflict
         DOUT(
         if (config.opt_lcm && (config.opt_lcm_full && decisionLevel() == 0 && confl == CRef_Undef && config.opt_lcm_style > 0)) {
+        mergeLearntTiers();
         sort(learnts, reduceDB_lbd_lt(ca));
             if (!simplifyLCM()) { return l_False; }
             performSimplificationNext = 0;
@@ -3017,10 +3550,20 @@ lbool Solver::search(int nof_conflicts)
 
             conflicts++; conflictC++;
             printConflictTrail(confl);
+            if (communication != 0 && communication->firstConflictTime < 0) { communication->firstConflictTime = wallClockTime(); }
 
             updateDecayAndVMTF(); // update dynamic parameters
             printSearchProgress(); // print current progress
 
+            if (chrono_threshold >= 0) {   // with out-of-order literals on the trail, the conflict might not involve the current level
+                const Clause& c = ca[confl];
+                int conflictLevel = 0;
+                for (int i = 0 ; i < c.size() && conflictLevel < decisionLevel(); ++ i) {
+                    conflictLevel = level(var(c[i])) > conflictLevel ? level(var(c[i])) : conflictLevel;
+                }
+                if (conflictLevel < decisionLevel()) { cancelUntil(conflictLevel); }
+            }
+
             if (decisionLevel() == 0) { // top level conflict - stop!
                 return l_False;
             }
@@ -3502,9 +4045,14 @@ void Solver::EnumerationClient::createBlockingProjectionClause(vec< Lit >& claus
 
 void Solver::clauseRemoval()
 {
-    if ((config.opt_reduceType == 1 && (learnts.size() - nAssigns() >= max_learnts))                                 // minisat style removal
-            || (config.opt_reduceType == 0 && (conflicts >= curRestart * nbclausesbeforereduce && learnts.size() > 0))    // glucose style removal
-            || (config.opt_reduceType == 2 && learnts.size() >= max_learnts)
+    if (tier2_lbd_threshold > 0 && conflicts >= nextTier2Reduce) {   // tier2 has its own schedule, the local tier might be empty
+        reduceTier2();
+        nextTier2Reduce = conflicts + config.opt_tier2_interval;
+    }
+
+    if ((config.opt_reduceType == 1 && (nLocalLearnts() - nAssigns() >= max_learnts))                                 // minisat style removal
+            || (config.opt_reduceType == 0 && (conflicts >= curRestart * nbclausesbeforereduce && nLocalLearnts() > 0))    // glucose style removal
+            || (config.opt_reduceType == 2 && nLocalLearnts() >= max_learnts)
        ) { // perform only if learnt clauses are present
         curRestart = config.opt_reduceType == 0 ? (conflicts / nbclausesbeforereduce) + 1 : curRestart; // update only during dynamic restarts
         reduceDB();
@@ -3520,6 +4068,9 @@ bool Solver::handleRestarts(int& nof_conflicts, const int conflictC)
 {
     if (useNaiveBacktracking) { return false; }  // if we run DPLL style search, we should not perform restarts, as we would redo the whole search
 
+    // checkpoints are written between two calls to search, hence restart as soon as a checkpoint is due
+    if (checkpointDue()) { cancelUntil(0); return true; }
+
     // handle restart heuristic switching first
     if (restartSwitchSchedule.heuristicSwitching()) {  // heuristic switching is enabled
         if (restartSwitchSchedule.reachedIntervalLimit(conflicts)) {    // we reached the limit
@@ -4010,6 +4561,56 @@ bool Solver::laHack(vec<Lit>& toEnqueue)
     return true;
 }
 
+bool Solver::lookaheadSplit(const vec<Lit>& cube, int candidates, Var& split)
+{
+    split = var_Undef;
+    cancelUntil(0);
+    if (!ok || propagate() != CRef_Undef) { return false; }
+
+    newDecisionLevel();   // all cube literals are assigned on level 1, the lookahead decisions on level 2
+    for (int i = 0 ; i < cube.size(); ++ i) {
+        if (value(cube[i]) == l_False) { cancelUntil(0); return false; }
+        if (value(cube[i]) == l_Undef) { uncheckedEnqueue(cube[i]); }
+    }
+    if (propagate() != CRef_Undef) { cancelUntil(0); return false; }
+    const int cubeTrail = trail.size();
+
+    // preselect the unassigned variables with the most watches, the propagation is measured for these only
+    std::vector< std::pair<uint64_t, Var> > preselected;
+    for (Var v = 0 ; v < nVars(); ++ v) {
+        if (value(v) != l_Undef || !varFlags[v].decision) { continue; }
+        const Lit l = mkLit(v, false);
+        preselected.push_back(std::make_pair((uint64_t)watches[l].size() + watches[~l].size() + 2 * (watchesBin[l].size() + watchesBin[~l].size()), v));
+    }
+    if (preselected.size() > (size_t)candidates) {
+        std::nth_element(preselected.begin(), preselected.begin() + candidates, preselected.end(), std::greater< std::pair<uint64_t, Var> >());
+        preselected.resize(candidates);
+    }
+
+    varFlags.copyTo(backupSolverState);   // the lookahead should not change the phases of the search
+    uint64_t bestScore = 0;
+    for (size_t i = 0 ; i < preselected.size(); ++ i) {
+        const Var v = preselected[i].second;
+        int propagated[2];
+        bool failed[2];
+        for (int polarity = 0 ; polarity < 2; ++ polarity) {
+            newDecisionLevel();
+            uncheckedEnqueue(mkLit(v, polarity == 1));
+            failed[polarity] = propagate() != CRef_Undef;
+            propagated[polarity] = trail.size() - cubeTrail;
+            cancelUntil(1);
+        }
+        if (failed[0] && failed[1]) { split = var_Undef; break; }   // both branches fail, the cube is refuted
+        if (failed[0] || failed[1]) { split = v; break; }            // one branch is refuted right away, the other one is forced
+        const uint64_t score = (uint64_t)propagated[0] * propagated[1] + propagated[0] + propagated[1];   // prefer balanced branches
+        if (split == var_Undef || score > bestScore) { split = v; bestScore = score; }
+    }
+    const bool refuted = split == var_Undef && !preselected.empty();
+    cancelUntil(0);
+    for (int i = 0 ; i < backupSolverState.size(); ++ i) { varFlags[i].polarity = backupSolverState[i].polarity; }
+    return !refuted;
+}
+
 
 double Solver::progressEstimate() const
 {
@@ -4050,6 +4651,8 @@ lbool Solver::initSolve(int solves)
     if (config.opt_reset_counters != 0 && solves % config.opt_reset_counters == 0) {
         nbRemovedClauses = 0; nbReducedClauses = 0;
         nbDL2 = 0; nbBin = 0; nbUn = 0; nbReduceDB = 0;
+        nbTier2Promoted = 0; nbTier2Demoted = 0; nextTier2Reduce = config.opt_tier2_interval;
+        nbChronoBacktracks = 0; nbChronoKept = 0; nbChronoSaved = 0;
         starts = 0; decisions = 0; rnd_decisions = 0;
         propagations = 0; conflicts = 0; nbstopsrestarts = 0;
         nbstopsrestartssame = 0; lastblockatrestart = 0;
@@ -4136,6 +4739,10 @@ lbool Solver::initSolve(int solves)
         cerr << "c adopted poarity of " << polLits.size() << " variables" << endl;
     }
 
+    if (rephasing.enabled) {   // the phases of this call are the original phases of the rephase schedule
+        for (Var v = 0 ; v < nVars(); ++ v) { rephasing.original[v] = varFlags[v].polarity; }
+    }
+
 
     // parse for activities from file!
     if (solves == 1 && config.actFile) {   // set initial activities
@@ -4268,6 +4875,347 @@ void Solver::dumpAndExit(const char* filename, bool doExit, bool fullState)
     if (doExit) { exit(1); }
 }
 
+bool Solver::toBinaryCNF(const char* filename)
+{
+    BinaryCNF formula;
+    formula.vars = nVars();
+    if (!okay()) {     // unsat
+        formula.vars = 0;
+        formula.clauses.push_back(lit_Undef);  // the empty clause
+        return formula.write(filename);
+    }
+
+    // units of level 0
+    for (int i = 0; i < trail.size(); ++i) {
+        if (level(var(trail[i])) != 0) { break; } // stop after first level
+        formula.addClause(&trail[i], 1);
+    }
+    for (int i = 0; i < clauses.size(); ++i) {
+        const Clause& c = ca[ clauses[i] ];
+        if (c.mark()) { continue; }
+        formula.addClause(c, c.size());
+    }
+    return formula.write(filename);
+}
+
+static const char checkpointMagic[] = "RISSCKPT";
+static const size_t checkpointMagicSize = 8;
+static const uint32_t checkpointVersion = 1;
+
+/** append the memory representation of the given value */
+template<class T>
+static void putCheckpoint(vector<unsigned char>& out, const T& value)
+{
+    const unsigned char* bytes = (const unsigned char*)&value;
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+/** append a clause, learnt clauses carry their LBD, activity and deletion flag */
+static void putCheckpointClause(vector<unsigned char>& out, const Lit* lits, int size, bool learnt, int lbd, float activity, bool canBeDel)
+{
+    putCheckpoint(out, (int32_t)size);
+    if (learnt) {
+        putCheckpoint(out, (int32_t)lbd);
+        putCheckpoint(out, activity);
+        putCheckpoint(out, (uint8_t)(canBeDel ? 1 : 0));
+    }
+    for (int i = 0 ; i < size; ++ i) { putCheckpoint(out, (int32_t)toInt(lits[i])); }
+}
+
+/** reader for the content of a checkpoint file, stops reading after the first error */
+class CheckpointReader
+{
+    const unsigned char* pos;
+    const unsigned char* end;
+    bool failed;
+
+  public:
+    CheckpointReader(const unsigned char* data, size_t size) : pos(data), end(data + size), failed(false) {}
+
+    bool ok() const { return !failed; }
+
+    template<class T>
+    T get()
+    {
+        T value = T();
+        if (failed || (size_t)(end - pos) < sizeof(T)) { failed = true; return value; }
+        memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    /** read the literals of a clause, the literals have to belong to variables of the formula */
+    void clause(vec<Lit>& lits, int size, int vars)
+    {
+        lits.clear();
+        if (size < 0 || (size_t)size > (size_t)(end - pos) / sizeof(int32_t)) { failed = true; return; }
+        for (int i = 0 ; i < size; ++ i) {
+            const int32_t lit = get<int32_t>();
+            if (lit < 0 || lit >= 2 * vars) { failed = true; return; }
+            lits.push(toLit(lit));
+        }
+    }
+};
+
+bool Solver::writeCheckpoint(const char* filename)
+{
+    checkpointRequested = false;
+    lastCheckpointConflicts = conflicts;
+    cancelUntil(0); // a checkpoint stores the state of a restart
+    mergeLearntTiers();
+
+    const bool withUndo = coprocessor != nullptr && (useCoprocessorPP || useCoprocessorIP || resumedFromCheckpoint);
+
+    vector<unsigned char> out;
+    out.insert(out.end(), checkpointMagic, checkpointMagic + checkpointMagicSize);
+    putCheckpoint(out, checkpointVersion);
+    putCheckpoint(out, (int32_t)nVars());
+    putCheckpoint(out, (uint8_t)(ok ? 1 : 0));
+    putCheckpoint(out, (uint8_t)(withUndo ? 1 : 0));
+
+    // counters, and the state of the restart and clause removal heuristics
+    putCheckpoint(out, conflicts);
+    putCheckpoint(out, decisions);
+    putCheckpoint(out, propagations);
+    putCheckpoint(out, starts);
+    putCheckpoint(out, nbReduceDB);
+    putCheckpoint(out, (int64_t)curRestart);
+    putCheckpoint(out, var_inc);
+    putCheckpoint(out, cla_inc);
+    putCheckpoint(out, searchconfiguration.var_decay);
+    putCheckpoint(out, (int32_t)nbclausesbeforereduce);
+    putCheckpoint(out, sumLBD);
+    putCheckpoint(out, max_learnts);
+    putCheckpoint(out, learntsize_adjust_confl);
+    putCheckpoint(out, (int32_t)learntsize_adjust_cnt);
+    putCheckpoint(out, (int32_t)restartSwitchSchedule.lubyRestarts);
+    putCheckpoint(out, (int32_t)restartSwitchSchedule.geometricRestarts);
+    putCheckpoint(out, (int32_t)restartSwitchSchedule.constantRestarts);
+
+    // activity, phase, and flags of each variable
+    for (Var v = 0 ; v < nVars(); ++ v) {
+        putCheckpoint(out, activity[v]);
+        putCheckpoint(out, (uint8_t)(varFlags[v].polarity | (varFlags[v].decision << 1) | (varFlags[v].frozen << 2)));
+    }
+
+    // top level units
+    putCheckpoint(out, (int32_t)trail.size());
+    for (int i = 0 ; i < trail.size(); ++ i) { putCheckpoint(out, (int32_t)toInt(trail[i])); }
+
+    // implicit binary clauses are present in the watch lists only, collect them once (as in materializeImplicitBinaries)
+    vector<Lit> implicitClauses[2];
+    if (implicitBinaryMode) {
+        watchesBin.cleanAll();
+        for (Var v = 0 ; v < nVars(); ++ v)
+            for (int s = 0 ; s < 2; ++ s) {
+                const Lit p = mkLit(v, s);
+                const BinWatchLists::List ws = watchesBin[p];
+                for (int i = 0 ; i < ws.size(); ++ i) {
+                    if (!ws[i].isImplicit() || toInt(~p) > toInt(ws[i].blocker())) { continue; }
+                    vector<Lit>& list = implicitClauses[ws[i].isLearntImplicit() ? 1 : 0];
+                    list.push_back(~p); list.push_back(ws[i].blocker());
+                }
+            }
+    }
+
+    // irredundant clauses, and learnt clauses
+    for (int l = 0 ; l < 2; ++ l) {
+        const vec<CRef>& list = l == 0 ? clauses : learnts;
+        int32_t count = implicitClauses[l].size() / 2;
+        for (int i = 0 ; i < list.size(); ++ i) { count += (ca[list[i]].mark() || ca[list[i]].can_be_deleted()) ? 0 : 1; }
+        putCheckpoint(out, count);
+
+        for (int i = 0 ; i < list.size(); ++ i) {
+            Clause& c = ca[list[i]];
+            if (c.mark() || c.can_be_deleted()) { continue; }
+            putCheckpointClause(out, &c[0], c.size(), l == 1, l == 1 ? c.lbd() : 0, l == 1 ? c.activity() : 0, l == 1 && c.canBeDel());
+        }
+        for (size_t i = 0 ; i < implicitClauses[l].size(); i += 2) {
+            putCheckpointClause(out, &implicitClauses[l][i], 2, l == 1, 2, 0, false);
+        }
+    }
+
+    FILE* f = fopen(filename, "wb");
+    if (f == nullptr) {
+        cerr << "c ERROR: could not open checkpoint file " << filename << endl;
+        return false;
+    }
+    const bool written = fwrite(&out[0], 1, out.size(), f) == out.size();
+    if (fclose(f) != 0 || !written) {
+        cerr << "c ERROR: could not write checkpoint file " << filename << endl;
+        return false;
+    }
+
+    // the model of the formula of the checkpoint has to be extended with the undo information of the preprocessor
+    if (withUndo && !coprocessor->writeBinaryFormula(string(filename) + ".undo")) { return false; }
+
+    if (verbosity > 0) { printf("c wrote checkpoint %s after %ld conflicts (%d vars, %d clauses, %d learnts)\n", filename, (int64_t)conflicts, nVars(), nClauses(), nLearnts()); }
+    return true;
+}
+
+bool Solver::readCheckpoint(const char* filename)
+{
+    assert(nVars() == 0 && decisionLevel() == 0 && "a checkpoint can only be read into an empty solver");
+
+    FILE* f = fopen(filename, "rb");
+    if (f == nullptr) {
+        cerr << "c ERROR: could not open checkpoint file " << filename << endl;
+        return false;
+    }
+    vector<unsigned char> data;
+    unsigned char buffer[1 << 16];
+    size_t n = 0;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) { data.insert(data.end(), buffer, buffer + n); }
+    fclose(f);
+
+    if (data.size() < checkpointMagicSize || memcmp(data.data(), checkpointMagic, checkpointMagicSize) != 0) {
+        cerr << "c ERROR: " << filename << " is not a checkpoint file" << endl;
+        return false;
+    }
+    CheckpointReader in(data.data() + checkpointMagicSize, data.size() - checkpointMagicSize);
+    if (in.get<uint32_t>() != checkpointVersion) {
+        cerr << "c ERROR: unsupported version of checkpoint file " << filename << endl;
+        return false;
+    }
+
+    const int vars = in.get<int32_t>();
+    const bool okay = in.get<uint8_t>() != 0;
+    const bool withUndo = in.get<uint8_t>() != 0;
+    if (vars < 0) {
+        cerr << "c ERROR: checkpoint file " << filename << " is corrupted" << endl;
+        return false;
+    }
+
+    // counters are restored immediately, so that budgets can be set relative to them
+    conflicts = in.get<uint64_t>();
+    decisions = in.get<uint64_t>();
+    propagations = in.get<uint64_t>();
+    starts = in.get<uint64_t>();
+    nbReduceDB = in.get<uint64_t>();
+    curRestart = (long)in.get<int64_t>();
+    lastCheckpointConflicts = conflicts;
+
+    CheckpointState* state = new CheckpointState();
+    state->var_inc = in.get<double>();
+    state->cla_inc = in.get<double>();
+    state->var_decay = in.get<double>();
+    state->nbclausesbeforereduce = in.get<int32_t>();
+    state->sumLBD = in.get<float>();
+    state->max_learnts = in.get<double>();
+    state->learntsize_adjust_confl = in.get<double>();
+    state->learntsize_adjust_cnt = in.get<int32_t>();
+    state->lubyRestarts = in.get<int32_t>();
+    state->geometricRestarts = in.get<int32_t>();
+    state->constantRestarts = in.get<int32_t>();
+
+    reserveVars(vars);
+    for (Var v = 0 ; v < vars && in.ok(); ++ v) {
+        state->activity.push(in.get<double>());
+        const uint8_t flags = in.get<uint8_t>();
+        state->polarity.push(flags & 1);
+        newVar((flags & 1) != 0, (flags & 2) != 0);
+        varFlags[v].frozen = (flags & 4) != 0;
+    }
+
+    // units first, so that the clauses are simplified accordingly
+    const int units = in.get<int32_t>();
+    for (int i = 0 ; i < units && in.ok(); ++ i) {
+        add_tmp.clear();
+        in.clause(add_tmp, 1, vars);
+        if (in.ok()) { addClause_(add_tmp); }
+    }
+
+    int clauseCount = in.get<int32_t>();
+    for (int i = 0 ; i < clauseCount && in.ok(); ++ i) {
+        in.clause(add_tmp, in.get<int32_t>(), vars);
+        if (in.ok()) { addClause_(add_tmp); }
+    }
+
+    clauseCount = in.get<int32_t>();
+    for (int i = 0 ; i < clauseCount && in.ok(); ++ i) {
+        const int size = in.get<int32_t>();
+        const int lbd = in.get<int32_t>();
+        const float act = in.get<float>();
+        const bool canBeDel = in.get<uint8_t>() != 0;
+        in.clause(add_tmp, size, vars);
+        if (!in.ok() || !ok) { continue; }
+
+        // drop satisfied learnt clauses and falsified literals, as the units might have changed since the clause has been learned
+        int j = 0;
+        bool satisfied = false;
+        for (int k = 0 ; k < add_tmp.size() && !satisfied; ++ k) {
+            satisfied = value(add_tmp[k]) == l_True;
+            if (value(add_tmp[k]) == l_Undef) { add_tmp[j++] = add_tmp[k]; }
+        }
+        add_tmp.shrink_(add_tmp.size() - j);
+        if (satisfied) { continue; }
+
+        if (add_tmp.size() < 2) {
+            if (add_tmp.size() == 0) { ok = false; }
+            else { uncheckedEnqueue(add_tmp[0]); ok = propagate() == CRef_Undef; }
+            continue;
+        }
+        const CRef cr = ca.alloc(add_tmp, true);
+        ca[cr].setLBD(lbd);
+        ca[cr].activity() = act;
+        ca[cr].setCanBeDel(canBeDel);
+        learnts.push(cr);
+        attachClause(cr);
+    }
+
+    if (!in.ok()) {
+        cerr << "c ERROR: checkpoint file " << filename << " is truncated or corrupted" << endl;
+        delete state;
+        return false;
+    }
+
+    if (!okay) { ok = false; }
+    else if (ok) { ok = propagate() == CRef_Undef; }
+
+    if (withUndo) {
+        if (coprocessor == nullptr) {
+            cerr << "c ERROR: checkpoint " << filename << " requires a preprocessor to extend models" << endl;
+            delete state;
+            return false;
+        }
+        if (!coprocessor->parseBinaryUndoInfo(string(filename) + ".undo")) { delete state; return false; }
+    }
+
+    resumedFromCheckpoint = true;
+    if (resumeState != nullptr) { delete resumeState; }
+    resumeState = state;
+
+    if (verbosity > 0) { printf("c resume from checkpoint %s after %ld conflicts (%d vars, %d clauses, %d learnts)\n", filename, (int64_t)conflicts, nVars(), nClauses(), nLearnts()); }
+    return true;
+}
+
+void Solver::applyCheckpointState()
+{
+    assert(resumeState != nullptr && "there has to be a state to be restored");
+    const CheckpointState& state = *resumeState;
+
+    for (Var v = 0 ; v < nVars() && v < state.activity.size(); ++ v) {
+        activity[v] = state.activity[v];
+        varFlags[v].polarity = state.polarity[v];
+    }
+    rebuildOrderHeap();
+
+    var_inc = state.var_inc;
+    cla_inc = state.cla_inc;
+    searchconfiguration.var_decay = state.var_decay;
+    nbclausesbeforereduce = state.nbclausesbeforereduce;
+    sumLBD = state.sumLBD;
+    max_learnts = state.max_learnts;
+    learntsize_adjust_confl = state.learntsize_adjust_confl;
+    learntsize_adjust_cnt = state.learntsize_adjust_cnt;
+    restartSwitchSchedule.lubyRestarts = state.lubyRestarts;
+    restartSwitchSchedule.geometricRestarts = state.geometricRestarts;
+    restartSwitchSchedule.constantRestarts = state.constantRestarts;
+
+    delete resumeState;
+    resumeState = nullptr;
+}
+
 // NOTE: assumptions passed in member-variable 'assumptions'.
 lbool Solver::solve_(const SolveCallType preprocessCall)
 {
@@ -4290,6 +5238,8 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
         lbool initValue = initSolve(solves);
         if (initValue != l_Undef)  { return initValue; }
 
+        if (resumeState != nullptr) { applyCheckpointState(); }  // continue with the search state of the checkpoint
+
         printHeader();
 
         if (preprocessCall == initializeOnly) { return status; }
@@ -4316,6 +5266,8 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
         if (config.opt_uhdProbe > 2) { big->sort(nVars()); }     // sort all the lists once
     }
 
+    implicitizeBinaries(); // keep binary clauses in the watch lists only during search
+
     DOUT(if (config.opt_learn_debug) {
     cerr << "c solver state after preprocessing" << endl;
     cerr << "c start solving with " << nVars() << " vars, " << nClauses() << " clauses and " << nLearnts() << " learnts decision vars: " << order_heap.size() << endl;
@@ -4342,6 +5294,9 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
 
     rerInitRewriteInfo();
 
+    if (hugePages.enabled) { adviseHugePages(); }
+    TlbMissCounter tlbMisses(hugePages.enabled || verbosity > 1);   // measure the data TLB misses of the search, only if they are reported
+    const uint64_t searchPropagations = propagations;
 
     //if (verbosity >= 1) printf("c start solving with %d assumptions\n", assumptions.size() );
     while (status == l_Undef) {
@@ -4359,7 +5314,7 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
             if (nVars() > big->getVars()) {   // rebuild big, if new variables are present
                 big->recreate(ca, nVars(), clauses, learnts);   // build a new BIG that is valid on the "new" formula!
                 big->removeDuplicateEdges(nVars());
-            }
+            } else if (big->hasPendingEdges()) { big->integratePendingEdges(nVars(), add_tmp); }
             big->generateImplied(nVars(), add_tmp);
             if (config.opt_uhdProbe > 2) { big->sort(nVars()); }     // sort all the lists once
             lastReshuffleRestart = curr_restarts; // update number of last restart
@@ -4383,6 +5338,16 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
         restartSwitchSchedule.constantRestarts = searchconfiguration.restarts_type == 3 ? restartSwitchSchedule.constantRestarts + 1 : restartSwitchSchedule.constantRestarts;
 
         status = inprocess(status);
+        if (hugePages.enabled && conflicts >= hugePages.nextAdvise) { adviseHugePages(); }
+
+        // write the search state, if requested by a signal, or periodically
+        if (status == l_Undef && checkpointDue()) { writeCheckpoint(checkpointFile.c_str()); }
+    }
+
+    if (tlbMisses.available()) {
+        hugePages.tlbCounted = true;
+        hugePages.tlbMisses += tlbMisses.read();
+        hugePages.tlbPropagations += propagations - searchPropagations;
     }
 
     if (status == l_False && config.opt_refineConflict) {
@@ -4427,6 +5392,7 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
                sumLearnedClauseLBD / totalLearnedClauses,
                (int64_t)maxLearnedClauseSize
               );
+        if (config.opt_implicit_binaries) { printf("c implicit binaries: %ld irredundant, %ld learnt\n", (int64_t)implicitBinaries, (int64_t)implicitLearntBinaries); }
         printf("c res.ext.res.: %d rer, %d rerSizeCands, %d sizeReject, %d patternReject, %d bloomReject, %d maxSize, %.2lf avgSize, %.2lf totalLits, %d gates\n",
                rerLearnedClause, rerLearnedSizeCandidates, rerSizeReject, rerPatternReject, rerPatternBloomReject, maxRERclause,
                rerLearnedClause == 0 ? 0 : (totalRERlits / (double) rerLearnedClause), totalRERlits, rerExtractedGates);
@@ -4441,9 +5407,15 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
         printf("c decisionClauses: %d\n", learnedDecisionClauses);
         printf("c IntervalRestarts: %d\n", intervalRestart);
         printf("c partial restarts: %d saved decisions: %d saved propagations: %d recursives: %d\n", rs_partialRestarts, rs_savedDecisions, rs_savedPropagations, rs_recursiveRefinements);
+        printf("c rephasing: %d rephases, %lu original, %lu inverted, %lu best, %lu target, %lu random, %lu walk, %lu walkModels\n", rephasing.rephases,
+               rephasing.originalPhases, rephasing.invertedPhases, rephasing.bestPhases, rephasing.targetPhases, rephasing.randomPhases, rephasing.walkPhases, rephasing.walkModels);
+        printf("c huge pages: %d enabled, %lu advises, %lu advisedBytes, %.2lf backedMB, %d tlbCounted, %lu tlbMisses, %lu tlbPropagations\n", hugePages.enabled,
+               hugePages.advises, hugePages.advisedBytes, memHugePages(), hugePages.tlbCounted, hugePages.tlbMisses, hugePages.tlbPropagations);
         printf("c uhd probe: %lf s, %d L2units, %d L3units, %d L4units\n", bigBackboneTime.getCpuTime(), L2units, L3units, L4units);
         printf("c LCM: %lf s, %ld nbLCM, %ld LCMclsAttempts, %ld nbLCMclsSuccess, %ld npConflLCMlits, %ld nbLCMlits, %ld falsified, %ld positiveDrop, %ld litsR1, %ld litsR2\n",
                LCMTime.getCpuTime(), nbLCM, nbLCMattempts, nbLCMsuccess, nbConflLits, nbLitsLCM, nbLCMfalsified, npLCMimpDrop, nbRound1Lits, nbRound2Lits);
+        printf("c vivification: %lf s, %lu rounds, %lu candidates, %lu tried, %lu strengthened, %lu removedLits, %lu removedClauses\n",
+               vivification.time.getCpuTime(), vivification.rounds, vivification.candidates, vivification.tried, vivification.strengthened, vivification.removedLits, vivification.removedClauses);
         #endif
     }
 
@@ -4467,7 +5439,7 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
             }
         }
 
-        if (coprocessor != nullptr && (useCoprocessorPP || useCoprocessorIP)) {
+        if (coprocessor != nullptr && (useCoprocessorPP || useCoprocessorIP || resumedFromCheckpoint)) {
             coprocessor->extendModel(model);
         }
 
@@ -4481,6 +5453,9 @@ lbool Solver::solve_(const SolveCallType preprocessCall)
 
     if (!config.opt_savesearch || config.opt_refineConflict) { cancelUntil(0); }
 
+    materializeImplicitBinaries(); // outside of search, all clauses are present in ca
+    mergeLearntTiers();            // outside of search, all learnt clauses are present in learnts
+
     // cerr << "c finish solving with " << nVars() << " vars, " << nClauses() << " clauses and " << nLearnts() << " learnts and status " << (status == l_Undef ? "UNKNOWN" : ( status == l_True ? "SAT" : "UNSAT" ) ) << endl;
 
     return status;
@@ -4622,6 +5597,7 @@ void Solver::relocAll(ClauseAllocator& to)
     //
     // for (int i = 0; i < watches.size(); i++)
     watches.cleanAll();
+    watchesBin.cleanAll();
     for (int v = 0; v < nVars(); v++)
         for (int s = 0; s < 2; s++) {
             Lit p = mkLit(v, s);
@@ -4630,7 +5606,13 @@ void Solver::relocAll(ClauseAllocator& to)
             for (int j = 0; j < ws.size(); j++) {
                 ca.reloc(ws[j].cref(), to);
             }
+            BinWatchLists::List wbin = watchesBin[p];
+            for (int j = 0; j < wbin.size(); j++) {
+                if (wbin[j].isImplicit()) { continue; }   // there is no clause for implicit binary clauses
+                ca.reloc(wbin[j].cref(), to);
+            }
         }
+    if (implicitConflict != CRef_Undef) { ca.reloc(implicitConflict, to); }
 
     // All reasons:
     //
@@ -4656,6 +5638,14 @@ void Solver::relocAll(ClauseAllocator& to)
         }
     }
     learnts.shrink_(learnts.size() - keptClauses);
+    keptClauses = 0;
+    for (int i = 0; i < tier2Learnts.size(); i++) {
+        if (!ca[ tier2Learnts[i] ].mark()) { // clauses might be relocated already via learnts, reloc takes care of that
+            ca.reloc(tier2Learnts[i], to);
+            tier2Learnts[keptClauses++] = tier2Learnts[i];
+        }
+    }
+    tier2Learnts.shrink_(tier2Learnts.size() - keptClauses);
 
     // All original:
     //
@@ -4679,8 +5669,103 @@ void Solver::relocAll(ClauseAllocator& to)
 }
 
 
+void Solver::compactClauses()
+{
+    // drop references to deleted clauses, like relocAll
+    watches.cleanAll();
+    watchesBin.cleanAll();
+    vec<CRef>* lists[] = { &learnts, &tier2Learnts, &clauses };
+    for (int l = 0 ; l < 3; ++ l) {
+        vec<CRef>& list = *lists[l];
+        int keptClauses = 0;
+        for (int i = 0; i < list.size(); i++) {
+            if (!ca[ list[i] ].mark()) { list[keptClauses++] = list[i]; }
+        }
+        list.shrink_(list.size() - keptClauses);
+    }
+    int keptClauses = 0;
+    for (int i = 0 ; i < otfss.info.size(); ++ i) {
+        if (!ca[otfss.info[i].cr].mark()) { otfss.info[keptClauses++] = otfss.info[i]; }
+    }
+    otfss.info.shrink_(otfss.info.size() - keptClauses);
+    for (int i = 0; i < trail.size(); i++) {   // reasons on level 0 are not needed anymore
+        if (level(var(trail[i])) == 0) { vardata[var(trail[i])].reason = CRef_Undef; }
+    }
+
+    // collect all clauses that are still referenced, reason clauses above level 0 are kept in any case
+    vec<CRef> live;
+    for (int l = 0 ; l < 3; ++ l) {
+        for (int i = 0; i < lists[l]->size(); i++) { live.push((*lists[l])[i]); }
+    }
+    for (int i = 0 ; i < otfss.info.size(); ++ i) { live.push(otfss.info[i].cr); }
+    for (int v = 0; v < nVars(); v++) {
+        for (int s = 0; s < 2; s++) {
+            const vec<Watcher>& ws = watches[mkLit(v, s)];
+            for (int j = 0; j < ws.size(); j++) { live.push(ws[j].cref()); }
+            const BinWatchLists::List wbin = watchesBin[mkLit(v, s)];
+            for (int j = 0; j < wbin.size(); j++) {
+                if (!wbin[j].isImplicit()) { live.push(wbin[j].cref()); }   // there is no clause for implicit binary clauses
+            }
+        }
+    }
+    for (int i = 0; i < trail.size(); i++) {
+        const Var v = var(trail[i]);
+        if (!reason(v).isBinaryClause() && reason(v).getReasonC() != CRef_Undef) { live.push(reason(v).getReasonC()); }
+    }
+    if (implicitConflict != CRef_Undef) { live.push(implicitConflict); }
+    sort(live);
+    int unique = 0;
+    for (int i = 0 ; i < live.size(); ++ i) {
+        if (unique == 0 || live[i] != live[unique - 1]) { live[unique++] = live[i]; }
+    }
+    live.shrink_(live.size() - unique);
+
+    // move the clauses, keep the regions that contain only little garbage in place
+    const uint32_t sizeBefore = ca.size();
+    vec<CRef> moved;
+    const int from = ca.compact(live, config.opt_gc_region, garbage_frac / 2, moved);
+
+    // update all references to moved clauses
+    if (from < live.size()) {
+        for (int l = 0 ; l < 3; ++ l) {
+            vec<CRef>& list = *lists[l];
+            for (int i = 0; i < list.size(); i++) { list[i] = ClauseAllocator::forward(list[i], live, from, moved); }
+        }
+        for (int i = 0 ; i < otfss.info.size(); ++ i) { otfss.info[i].cr = ClauseAllocator::forward(otfss.info[i].cr, live, from, moved); }
+        for (int v = 0; v < nVars(); v++) {
+            for (int s = 0; s < 2; s++) {
+                vec<Watcher>& ws = watches[mkLit(v, s)];
+                for (int j = 0; j < ws.size(); j++) { ws[j].cref() = ClauseAllocator::forward(ws[j].cref(), live, from, moved); }
+                BinWatchLists::List wbin = watchesBin[mkLit(v, s)];
+                for (int j = 0; j < wbin.size(); j++) {
+                    if (!wbin[j].isImplicit()) { wbin[j].cref() = ClauseAllocator::forward(wbin[j].cref(), live, from, moved); }
+                }
+            }
+        }
+        for (int i = 0; i < trail.size(); i++) {
+            const Var v = var(trail[i]);
+            if (!reason(v).isBinaryClause() && reason(v).getReasonC() != CRef_Undef) {
+                vardata[v].reason.setReason(ClauseAllocator::forward(reason(v).getReasonC(), live, from, moved));
+            }
+        }
+        implicitConflict = ClauseAllocator::forward(implicitConflict, live, from, moved);
+    }
+
+    if (verbosity >= 2)
+        printf("c |  Garbage collection:   %12d bytes => %12d bytes, moved %d of %d clauses                      |\n",
+               sizeBefore * ClauseAllocator::Unit_Size, ca.size() * ClauseAllocator::Unit_Size, live.size() - from, live.size());
+}
+
 void Solver::garbageCollect()
 {
+    watchesBin.cleanAll();
+    watchesBin.compact();   // store the binary watch lists one after the other again, in the order of their literals
+
+    if (config.opt_gc_compact || ca.sharedSize() > 0) {   // a shared arena stays in place, copying it would unshare all clauses
+        compactClauses();
+        return;
+    }
+
     // Initialize the next region to a size corresponding to the estimated utilization degree. This
     // is not precise but should avoid some unnecessary reallocations for the new region:
     ClauseAllocator to(ca.size() >= ca.wasted() ? ca.size() - ca.wasted() : 0); //FIXME security-workaround, for CP3 (due to inconsistend wasted-bug)
@@ -4819,9 +5904,8 @@ void Solver::rerInitRewriteInfo()
             hit[j] = 1;
 
             // check binary clauses in watch list
-            const vec<Watcher>&  wbin  = watches[o];
+            const BinWatchLists::List  wbin  = watchesBin[o];
             for (int k = 0; k < wbin.size(); k++) {
-                if (!wbin[k].isBinary()) { continue; }
                 const Lit& imp = wbin[k].blocker(); // (o -> imp) => clause [-o, imp]
                 if (~imp == c[0]) { hit[0] = 1; }  // could have else here. TODO: what is better for branch prediction?
                 if (~imp == c[1]) { hit[1] = 1; }
@@ -5344,6 +6428,7 @@ Solver::rerReturnType Solver::restrictedERITE(const Lit& previousFirst, const ve
 
 void Solver::disjunctionReplace(Lit p, Lit q, const Lit& x, const bool& inLearned, const bool& inBinary)
 {
+    if (inLearned) { mergeLearntTiers(); }
 
     for (int m = 0 ; m < (inLearned ? 2 : 1); ++ m) {
         const vec<CRef>& cls = (m == 0 ? clauses : learnts);
@@ -5413,6 +6498,7 @@ bool Solver::interleavedClauseStrengthening()
     // TODO: have dynamic updates of the limits, so that a good time/result ratio can be reached!
     icsCalls ++;
     MethodClock thisMethodTime(icsTime);   // clock that measures how long the procedure took
+    mergeLearntTiers();
     // freeze current state
     vec<Lit> trailCopy;
     trail.copyTo(trailCopy);
@@ -5687,9 +6773,11 @@ void Solver::printFullSolverState()
         for (int p = 0 ; p < 2; ++p) {
             const Lit l = mkLit(v, p == 1);
             cerr << "c [SOLVER-STATE] watch list(" << l << "): ";
+            for (int i = 0 ; i < watchesBin[l].size(); ++i) {
+                cerr << " " << watchesBin[l][i].cref() << "b";
+            }
             for (int i = 0 ; i < watches[l].size(); ++i) {
                 cerr << " " << watches[l][i].cref();
-                if (watches[l][i].isBinary()) { cerr << "b" ; }
             }
             cerr << endl;
         }
@@ -5734,7 +6822,7 @@ lbool Solver::preprocess()
     // if( coprocessor == 0 && useCoprocessor) coprocessor = new Coprocessor::Preprocessor(this); // use number of threads from coprocessor
     if (decisionLevel() != 0) { return status; }  // might jump back to L 0 once in a while
 
-    if (coprocessor != 0 && useCoprocessorPP) {
+    if (coprocessor != 0 && useCoprocessorPP && !resumedFromCheckpoint) {   // the formula of a checkpoint has been simplified already
         if (processOtfss(otfss)) { return l_False ; }    // make sure we work on the correct clauses still (collected before)
         preprocessCalls++;
         preprocessTime.start();
@@ -5787,7 +6875,10 @@ lbool Solver::inprocess(lbool status)
                 communicationClient.receiveEE = true; // enable receive EE after first inprocessing (as there will be another one)
                 inprocessCalls ++;
                 inprocessTime.start();
+                materializeImplicitBinaries(); // the coprocessor works on the clauses in ca only
+                mergeLearntTiers();            // the coprocessor sees all learnt clauses in learnts
                 status = coprocessor->inprocess();
+                implicitizeBinaries();
                 inprocessTime.stop();
 
                 otfss.clearQueues(); // make sure there are no OTFSS pointers left over //FIXME process OTFSS in coprocessor
@@ -5934,7 +7025,28 @@ lbool Solver::handleLearntClause(vec< Lit >& learnt_clause, bool backtrackedBeyo
         if (value(learnt_clause[0]) == l_Undef) {uncheckedEnqueue(learnt_clause[0]); nbUn++;}
         else if (value(learnt_clause[0]) == l_False) { return l_False; }  // otherwise, we have a top level conflict here!
         DOUT(if (config.opt_printDecisions > 1) cerr << "c enqueue learned unit literal " << learnt_clause[0] << " at level " <<  decisionLevel() << " from clause " << learnt_clause << endl;);
-    } else {
+    }
+    #ifndef CLS_EXTRA_INFO
+    else if (learnt_clause.size() == 2 && implicitBinaryMode && rerClause != rerMemorizeClause) {
+        // learned binary clauses are added to the watch lists only
+        if (nblevels <= 2) { nbDL2++; } // stats
+        nbBin++; // stats
+        attachImplicitBinary(learnt_clause[0], learnt_clause[1], nblevels > lbd_core_threshold && learnt_clause.size() > config.opt_keep_permanent_size);
+
+        // attach unit only, if  rer does allow it
+        if (rerClause != rerDontAttachAssertingLit) {
+            if (!isBiAsserting) {
+                uncheckedEnqueue(learnt_clause[0], ~learnt_clause[1], false); // the reason is the satisfied complement of the other literal
+                DOUT(if (config.opt_printDecisions > 1) cerr << "c enqueue literal " << learnt_clause[0] << " at level " <<  decisionLevel() << " from implicit learned clause " << learnt_clause << endl;);
+            } else {
+                biAssertingPostCount++;
+                lastBiAsserting = conflicts; // store number of conflicts for the last occurred bi-asserting clause so that the distance can be calculated
+                isBiAsserting = false; // handled the current conflict clause, set this flag to false again
+            }
+        }
+    }
+    #endif
+    else {
         CRef cr = CRef_Undef;
 
         // assert( !hasComplementary(learnt_clause) && !hasDuplicates(learnt_clause) && "do not have duplicate literals in the learned clause" );
@@ -5953,7 +7065,11 @@ lbool Solver::handleLearntClause(vec< Lit >& learnt_clause, bool backtrackedBeyo
             assert(!hasComplementary(learnt_clause) && !hasDuplicates(learnt_clause) && "do not have duplicate literals in the learned clause");
             cr = ca.alloc(learnt_clause, true);
             // ca[cr].mark(no_LBD ? 0 : nblevels < 6 ? 3 : 2);
-            learnts.push(cr);
+            if (nblevels <= tier2_lbd_threshold && learnt_clause.size() > 2) {  // good clauses are not considered by reduceDB
+                ca[cr].setTier2(true);
+                ca[cr].setTierUsed(true);
+                tier2Learnts.push(cr);
+            } else { learnts.push(cr); }
             if (rerClause == rerMemorizeClause) { rerFuseClauses.push(cr); }    // memorize this clause reference for RER
 
             if (config.opt_cls_act_bump_mode != 2) {
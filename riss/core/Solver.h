@@ -36,6 +36,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "riss/utils/Options.h"
 #include "riss/utils/System.h"
 #include "riss/utils/Compression.h"
+#include "riss/utils/Simd.h"
 #include "riss/core/SolverTypes.h"
 #include "riss/core/BoundedQueue.h"
 #include "riss/core/Constants.h"
@@ -187,12 +188,25 @@ class Solver
     bool    solve(Lit p, Lit q, Lit r);             /// Search for a model that respects three assumptions.
     bool    okay() const;                           /// FALSE means solver is in a conflicting state
 
+    /** select a variable to split the formula under the given cube, with a lookahead on the candidates that occur most often
+     *  (cube-and-conquer), the solver is at level 0 afterwards, and the phases of the variables are kept
+     *  @param split variable that propagates most literals in both branches, var_Undef if there is no unassigned variable
+     *  @return false, if the formula under the cube is refuted by unit propagation
+     */
+    bool    lookaheadSplit(const vec<Lit>& cube, int candidates, Var& split);
+
     void    toDimacs(FILE* f, const vec<Lit>& assumps);                 // Write CNF to file in DIMACS-format.
     void    toDimacs(const char *file, const vec<Lit>& assumps);
     void    toDimacs(FILE* f, Clause& c, vec<Var>& map, Var& max);
     void printLit(Lit l);
     void printClause(CRef c);
     void dumpAndExit(const char* filename, bool doExit = true, bool fullState = false);  // print the current formula without assumptions (p line, trail, clauses)
+    bool toBinaryCNF(const char* filename);  // write the current formula without assumptions (trail, clauses) in the binary CNF format
+
+    bool writeCheckpoint(const char* filename);  // write clauses, learnt clauses and the search state (heuristics, restarts) into a binary file, jumps back to level 0
+    bool readCheckpoint(const char* filename);   // read a checkpoint into this empty solver, the next call to solve continues the search from this state
+    void requestCheckpoint();                    // write a checkpoint at the next restart (can be called from a signal handler)
+    void setCheckpointFile(const std::string& filename); // file for requested and periodic checkpoints (empty disables checkpoints)
 
     // Convenience versions of 'toDimacs()':
     void    toDimacs(const char* file);
@@ -233,6 +247,7 @@ class Solver
     int     nAssigns()      const;          /// The current number of assigned literals.
     int     nClauses()      const;          /// The current number of original clauses.
     int     nLearnts()      const;          /// The current number of learnt clauses.
+    int     nLocalLearnts() const;          /// The current number of learnt clauses in the local tier (all learnt clauses, if tier2 is disabled).
     int     nVars()      const;             /// The current number of variables.
     int     nTotLits()      const;          /// The current number of total literals in the formula.
     int     nFreeVars()      const;
@@ -244,6 +259,7 @@ class Solver
     void    budgetOff();
     void    interrupt();          /// Trigger a (potentially asynchronous) interruption of the solver.
     void    clearInterrupt();     /// Clear interrupt indicator flag.
+    bool    interrupted() const;  /// Return true, if the solver has been interrupted.
 
     // Memory managment:
     //
@@ -468,6 +484,8 @@ class Solver
     //
     uint64_t nbRemovedClauses, nbReducedClauses, nbDL2, nbBin, nbUn, nbReduceDB, solves, starts, decisions, rnd_decisions, propagations, conflicts, nbstopsrestarts, nbstopsrestartssame, lastblockatrestart;
     uint64_t dec_vars, clauses_literals, learnts_literals, max_literals, tot_literals;
+    uint64_t nbTier2Promoted, nbTier2Demoted; // learnt clauses that moved between the local tier and tier2
+    uint64_t nbChronoBacktracks, nbChronoKept, nbChronoSaved; // chronological backtracks, out-of-order literals kept on the trail, assignments that did not have to be propagated again
 
     void applyConfiguration(); // assigns relevant values of search configuration to data structures/counters
   protected:
@@ -490,6 +508,29 @@ class Solver
 
     int simplifyLearntLCM(Clause& c, int vivificationConfig); // simplify a non-watched clause, and perform vivification on it
 
+  public:
+    /** vivification of irredundant clauses during search, with the watches of the solver
+     *  candidates are ordered by the occurrences of their literals in the clauses learned since the last round
+     */
+    struct Vivification {
+        bool enabled;                 // vivify irredundant clauses during search
+        bool scheduled;               // rounds are triggered by the inprocessing scheduler of the coprocessor, not by conflicts
+        vec<uint32_t> litConflicts;   // occurrences of each literal in the learnt clauses since the last round
+        uint64_t nextConflicts;       // number of conflicts, after which the next round is done
+        uint64_t lastPropagations;    // propagations at the end of the last round, the effort is relative to the search since then
+        uint64_t rounds, candidates, tried, strengthened, removedLits, removedClauses; // statistics
+        Clock time;
+
+        Vivification(int interval) : enabled(interval > 0), scheduled(false), nextConflicts(interval), lastPropagations(0),
+            rounds(0), candidates(0), tried(0), strengthened(0), removedLits(0), removedClauses(0) {}
+    } vivification;
+
+  protected:
+    /** vivify the irredundant clauses that appeared most often in recent conflicts, until the propagation budget is used
+     * @return false, if the formula is found to be unsatisfiable
+     */
+    bool vivifyIrredundant();
+
     long curRestart;
     // Helper structures:
     //
@@ -574,8 +615,8 @@ class Solver
   protected:
     double              var_inc;          // Amount to bump next variable with.
   public: // TODO FIXME undo after debugging!
-    OccLists<Lit, vec<Watcher>, WatcherDeleted> watches;          // 'watches[lit]' is a list of constraints watching 'lit' (will go there if literal becomes true).
-    // no watchesBin, incorporated into watches
+    OccLists<Lit, vec<Watcher>, WatcherDeleted> watches;          // 'watches[lit]' is a list of constraints with more than 2 literals watching 'lit' (will go there if literal becomes true).
+    BinWatchLists watchesBin;                                     // 'watchesBin[lit]' is the list of binary clauses watching 'lit', scanned before 'watches' during propagation
 
     /** structure to hande reverse minimization nicely
      *  uses data structures of solver for incomplete propagation
@@ -599,11 +640,57 @@ class Solver
 
     } reverseMinimization;
 
+    /** phases of interesting assignments, used to decide with target phases and to reset the saved phases from time to time
+     *  phases are stored like VarFlags::polarity (1 = assign false), 2 marks variables that have not been assigned
+     */
+    struct Rephasing {
+        bool enabled;           // track target and best phases
+        bool useTarget;         // decide with the target phase, if there is one
+        vec<char> original;     // phases at the beginning of the current solve call
+        vec<char> target;       // phases of the largest conflict-free trail since the last rephase
+        vec<char> best;         // phases of the largest conflict-free trail since the last rephase to best
+        int targetSize;         // number of assignments of the target trail
+        int bestSize;           // number of assignments of the best trail
+        int consistentTrail;    // size of the prefix of the current trail that has been propagated without a conflict
+        uint64_t nextRephase;   // number of conflicts, after which the next rephase is done
+        int rephases;           // number of rephases so far (position in the schedule)
+
+        uint64_t originalPhases, invertedPhases, bestPhases, targetPhases, randomPhases, walkPhases, walkModels; // statistics
+
+        Rephasing(bool useTargetPhase, int interval) : enabled(useTargetPhase || interval > 0), useTarget(useTargetPhase), targetSize(0), bestSize(0), consistentTrail(0), nextRephase(interval), rephases(0),
+            originalPhases(0), invertedPhases(0), bestPhases(0), targetPhases(0), randomPhases(0), walkPhases(0), walkModels(0) {}
+    } rephasing;
+
+    /** store the phases of the conflict-free part of the trail as target and best phases, if it is larger than the current ones
+     * @param level level the trail is about to be cancelled to
+     */
+    void saveTargetPhases(int level);
+
+    /** overwrite the saved phases with the next phase of the rephase schedule */
+    void rephase();
+
+    /** backing of the search data structures with transparent huge pages, and the data TLB misses during search */
+    struct HugePages {
+        bool enabled;            // advise huge pages for the clause arena, the watch lists, vardata and varFlags
+        uint64_t advisedBytes;   // bytes advised in the last call to adviseHugePages
+        uint64_t advises;        // number of calls to adviseHugePages
+        uint64_t nextAdvise;     // number of conflicts, after which the grown data structures are advised again
+        bool tlbCounted;         // true, if the hardware counter for TLB misses was available during search
+        uint64_t tlbMisses;      // data TLB read misses during search
+        uint64_t tlbPropagations;// propagations during the measured search
+
+        HugePages(bool enable) : enabled(enable), advisedBytes(0), advises(0), nextAdvise(0), tlbCounted(false), tlbMisses(0), tlbPropagations(0) {}
+    } hugePages;
+
+    /** ask for transparent huge pages for the clause arena, the watch lists, vardata and varFlags (see -hugepages) */
+    void adviseHugePages();
+
     bool earlyAssumptionConflict; // abort incremental calls as soon as we know it conflicts
 
   public: // TODO: set more nicely, or write method!
     vec<CRef>           clauses;          // List of problem clauses.
-    vec<CRef>           learnts;          // List of learnt clauses.
+    vec<CRef>           learnts;          // List of learnt clauses (the local tier, if tier2 is enabled).
+    vec<CRef>           tier2Learnts;     // learnt clauses with a small LBD, that are not considered by reduceDB (empty, if tier2 is disabled)
 
     struct VarFlags {
         lbool assigns;
@@ -783,6 +870,8 @@ class Solver
     double              progress_estimate;// Set by 'search()'.
     bool                remove_satisfied; // Indicates whether possibly inefficient linear scan for satisfied clauses should be performed in 'simplify'.
     MarkArray           lbd_marker;
+    bool                useSimd;          // use the AVX2 kernels for watch search and LBD computation
+    vec<int32_t>        lbdLevels;        // levels of the literals of the clause whose LBD is computed with AVX2
 
     #ifdef UPDATEVARACTIVITY
     // UPDATEVARACTIVITY trick (see competition'09 companion paper)
@@ -843,6 +932,7 @@ class Solver
 
     CRef     propagate(bool duringAddingClauses = false);                              // Perform unit propagation. Returns possibly conflicting clause (during adding clauses, to add proof infos, if necessary)
     void     cancelUntil(int level);                                                   // Backtrack until a certain level.
+    int      implicationLevel(const Lit p, const CRef from) const;                     // Level of a literal that is implied by the given reason clause with chronological backtracking (highest level of the other literals)
 
     int      analyze(CRef confl, vec< Lit >& out_learnt, int& out_btlevel, unsigned int& lbd, unsigned& dependencyLevel);               // // (bt = backtrack, return is number of unit clauses in out_learnt. if 0, treat as usual!)
     void     analyzeFinal(Lit p, vec<Lit>& out_conflict);                              // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
@@ -866,6 +956,11 @@ class Solver
 
   protected:
     void     reduceDB();                                                               // Reduce the set of learnt clauses.
+    bool     reduceByActivity();                                                       // decide whether activity based removal should use activities or LBDs in this reduction
+    void     reduceLocalTier();                                                        // Reduce the local tier in linear time, promote clauses with a small LBD to tier2.
+    void     reduceTier2();                                                            // move tier2 clauses that have not been used since the last call back to the local tier
+    void     updateLearntTier(CRef cr, Clause& c);                                     // move a learnt clause into tier2, if its LBD is small enough
+    void     mergeLearntTiers();                                                       // move all tier2 clauses back into learnts, for methods that work on all learnt clauses
     void     removeSatisfied(vec<CRef>& cs);                                           // Shrink 'cs' to contain only non-satisfied clauses.
   public:
     void     rebuildOrderHeap();
@@ -908,6 +1003,47 @@ class Solver
 
 
     void     relocAll(ClauseAllocator& to);
+    void     compactClauses();   // garbage collection in place, moves clauses down region by region and updates their references
+
+    /** implicit binary clauses are only present in the watch lists, and are not allocated in ca (see opt_implicit_binaries)
+     *  Note: the reason of a literal that is implied by such a clause is the literal whose propagation triggered the clause
+     */
+    bool     implicitBinaryMode;       // true, if the watch lists might contain implicit binary clauses
+    CRef     implicitConflict;         // binary clause in ca that is used to represent conflicting implicit binary clauses
+    uint64_t implicitBinaries, implicitLearntBinaries; // number of binary clauses that have been moved into the watch lists (stats)
+
+    void     attachImplicitBinary(const Lit& a, const Lit& b, bool learnt);  // add the binary clause [a,b] to the watch lists only
+    CRef     implicitBinaryConflict(const Lit& a, const Lit& b);              // store [a,b] in the conflict clause and return its reference
+    void     moveBinariesToWatches(vec<CRef>& list);                         // turn all binary clauses of the list into implicit binary clauses
+
+    /** search state of a checkpoint that is overwritten when the solver is initialized for search, hence it is restored afterwards
+     *  (see writeCheckpoint and readCheckpoint)
+     */
+    struct CheckpointState {
+        vec<double>  activity;
+        vec<uint8_t> polarity;
+        double var_inc, cla_inc, var_decay;
+        int    nbclausesbeforereduce;
+        float  sumLBD;
+        double max_learnts, learntsize_adjust_confl;
+        int    learntsize_adjust_cnt;
+        int    lubyRestarts, geometricRestarts, constantRestarts;
+    };
+
+    volatile bool    checkpointRequested;     // write a checkpoint at the next restart
+    uint64_t         lastCheckpointConflicts; // conflicts when the last checkpoint has been written
+    std::string      checkpointFile;          // file to write checkpoints to (empty, if checkpoints are disabled)
+    bool             resumedFromCheckpoint;   // the formula and the search state have been read from a checkpoint
+    CheckpointState* resumeState;             // state of a read checkpoint that still has to be restored
+
+    void     applyCheckpointState();          // restore the search state of a read checkpoint, after the solver has been initialized for search
+    bool     checkpointDue() const;           // a checkpoint has been requested, or the next periodic checkpoint should be written
+
+  public:
+    /** turn all binary clauses of the formula into implicit binary clauses, if enabled */
+    void     implicitizeBinaries();
+    /** allocate all implicit binary clauses in ca again, e.g. before the formula is handed to the Coprocessor */
+    void     materializeImplicitBinaries();
 
     // Misc:
     //
@@ -1276,11 +1412,12 @@ class Solver
      */
     bool searchUHLE(vec<Lit>& learned_clause, unsigned int& lbd, unsigned& dependencyLevel);
 
-    /// sort according to position of literal in trail
+    /// sort according to position of literal in trail (levels first, as literals can be out of order with chronological backtracking)
     struct TrailPosition_Gt {
         vec<VarData>& varData;  // data to use for sorting
         bool operator()(const Lit& x, const Lit& y) const
         {
+            if (varData[ var(x) ].level != varData[ var(y) ].level) { return varData[ var(x) ].level > varData[ var(y) ].level; }
             return varData[ var(x) ].position > varData[ var(y) ].position; // compare data of x and y instead of elements themselves
         }
         TrailPosition_Gt(vec<VarData>& _varData) : varData(_varData) {}
@@ -1470,6 +1607,11 @@ class Solver
     // 999 MS hack
     bool   activityBasedRemoval;     // use minisat or glucose style of clause removal and activities
     int    lbd_core_threshold;        // threadhold to move clause from learnt to formula (if LBD is low enough)
+    int    tier2_lbd_threshold;       // learnt clauses with at most this LBD are kept in tier2Learnts (0 = off)
+    uint64_t nextTier2Reduce;         // number of conflicts when unused tier2 clauses are demoted next
+    int    tier2StaleEntries;         // entries in learnts of clauses that have been promoted to tier2 since these entries were dropped last
+    int    chrono_threshold;          // backtrack chronologically, if a backjump would undo more levels (-1 = off)
+    vec<Lit> chronoKeptLits;          // literals that stay on the trail during chronological backtracking
     double learnts_reduce_fraction;   // fraction of how many learned clauses should be removed
 
 
@@ -1563,6 +1705,11 @@ class Solver
      */
     void updateDynamicLimits(bool failed, bool sizeOnly = false);
 
+    /** move the minimal send limits towards the fraction of useful clauses the receivers should see, based on their feedback
+     *  note: checks the feedback only every feedbackInterval conflicts
+     */
+    void updateFeedbackLimits();
+
     /** inits the protection environment for variables
      */
     void initVariableProtection();
@@ -1612,10 +1759,42 @@ class Solver
 
         double lbdFactor;                          /// how to construct the LBD for a received clause (0 = set LBD of clause to 0, positive: relative to size of clause [0-1], negative: relative to average lbd/size ratio)
 
+        uint64_t nextFeedbackCheck;                /// number of conflicts, when the feedback of the receivers is checked next
+        uint64_t feedbackImported, feedbackUseful; /// clauses of this thread that the receivers imported, and found useful, at the last check
+
         CommunicationClient() : currentTries(0), receiveEvery(0), currentSendSizeLimit(0), currentSendLbdLimit(0), receiveEE(false),
             refineReceived(false), resendRefined(false), doReceive(true), succesfullySend(0), succesfullyReceived(0),
             sendSize(0), sendLbd(0), sendMaxSize(0), sendMaxLbd(0), sizeChange(0), lbdChange(0), sendRatio(0),
-            checkLiterals(true), useDynamicLimits(false), sendAll(false), receiveAll(false), keepLonger(false), lbdFactor(0) {}
+            checkLiterals(true), useDynamicLimits(false), sendAll(false), receiveAll(false), keepLonger(false), lbdFactor(0),
+            nextFeedbackCheck(0), feedbackImported(0), feedbackUseful(0) {}
+
+        /** move the minimal send limits towards the fraction of useful clauses the receivers should see
+         * @param imported number of clauses of this thread the receivers imported so far
+         * @param useful number of these clauses the receivers used in conflict analysis so far
+         * @param target fraction of the newly imported clauses that should be useful
+         * @param change relative change of the minimal limits, if the target is missed
+         * @return false, if there are not enough new imports to judge
+         */
+        bool adaptToFeedback(const uint64_t imported, const uint64_t useful, const float target, const float change)
+        {
+            const uint64_t newImported = imported - feedbackImported, newUseful = useful - feedbackUseful;
+            if (newImported < 100) { return false; }   // collect more feedback until the next check
+            feedbackImported = imported;
+            feedbackUseful = useful;
+
+            // too few useful clauses: send only better clauses, many useful clauses: send more clauses
+            // note: a clause is useful once it is used in conflict analysis, so recently imported clauses are counted too low
+            const float factor = (double)newUseful < target * newImported ? 1.0 - change : 1.0 + change;
+            sendSize = sendSize * factor < 2.0f ? 2.0f : sendSize * factor;
+            sendSize = sendSize > sendMaxSize ? sendMaxSize : sendSize;
+            sendLbd  = sendLbd * factor < 2.0f ? 2.0f : sendLbd * factor;
+            sendLbd  = sendLbd > sendMaxLbd ? sendMaxLbd : sendLbd;
+
+            // keep the dynamic limits that the sender adapted so far, they only must not fall below the new minimum
+            currentSendSizeLimit = currentSendSizeLimit < sendSize ? sendSize : currentSendSizeLimit;
+            currentSendLbdLimit  = currentSendLbdLimit  < sendLbd  ? sendLbd  : currentSendLbdLimit;
+            return true;
+        }
     } communicationClient;
 
     class VariableInformation
@@ -1626,14 +1805,16 @@ class Solver
         VariableInformation(vec<VarFlags>& _varInfo, bool checkLits)
             : varInfo(_varInfo), receiveUseLit(checkLits) {}
 
-        /** check based on the variable flags whether a certain literal is allowed to be received */
+        /** check based on the variable flags whether a certain literal is allowed to be received
+         *  note: as for sending, literals whose models have been modified by simplification are rejected
+         */
         bool canBeReceived(const Lit& l) const
         {
             const Var v = var(l);
             if (receiveUseLit) {
-                if (sign(l)) { return varInfo[v].modifiedNegativeModels; }
-                else { return varInfo[v].modifiedPositiveModels; }
-            } else { return varInfo[v].modifiedNegativeModels || varInfo[v].modifiedPositiveModels; }
+                if (sign(l)) { return !varInfo[v].modifiedNegativeModels; }
+                else { return !varInfo[v].modifiedPositiveModels; }
+            } else { return !varInfo[v].modifiedNegativeModels && !varInfo[v].modifiedPositiveModels; }
         }
 
         /** set dependency of a variable */
@@ -1850,6 +2031,14 @@ inline bool     Solver::addEmptyClause()                      { add_tmp.clear();
 inline bool     Solver::addClause(Lit p)                 { add_tmp.clear(); add_tmp.push(p); return addClause_(add_tmp); }
 inline bool     Solver::addClause(Lit p, Lit q)          { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); return addClause_(add_tmp); }
 inline bool     Solver::addClause(Lit p, Lit q, Lit r)   { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addClause_(add_tmp); }
+inline CRef Solver::implicitBinaryConflict(const Lit& a, const Lit& b)
+{
+    assert(implicitConflict != CRef_Undef && "conflict clause for implicit binary clauses has to be allocated");
+    Clause& c = ca[implicitConflict];
+    c[0] = a; c[1] = b;
+    return implicitConflict;
+}
+
 inline bool     Solver::locked(const Clause& c) const
 {
     if (c.size() > 2) {
@@ -1879,7 +2068,8 @@ inline lbool    Solver::modelValue(Var x) const   { return model[x]; }
 inline lbool    Solver::modelValue(Lit p) const   { return model[var(p)] ^ sign(p); }
 inline int      Solver::nAssigns()      const   { return trail.size(); }
 inline int      Solver::nClauses()      const   { return clauses.size(); }
-inline int      Solver::nLearnts()      const   { return learnts.size(); }
+inline int      Solver::nLearnts()      const   { return nLocalLearnts() + tier2Learnts.size(); }
+inline int      Solver::nLocalLearnts() const   { return learnts.size() - tier2StaleEntries; }
 inline int      Solver::nVars()      const   { return vardata.size(); }
 inline int      Solver::nTotLits()      const   { return clauses_literals + learnts_literals; }
 inline int      Solver::nFreeVars()      const   { return (int)dec_vars - (trail_lim.size() == 0 ? trail.size() : trail_lim[0]); }
@@ -1897,6 +2087,14 @@ inline void     Solver::setConfBudget(int64_t x) { conflict_budget    = conflict
 inline void     Solver::setPropBudget(int64_t x) { propagation_budget = propagations + x; }
 inline void     Solver::interrupt() { asynch_interrupt = true; }
 inline void     Solver::clearInterrupt() { asynch_interrupt = false; }
+inline bool     Solver::interrupted() const { return asynch_interrupt; }
+inline void     Solver::requestCheckpoint() { checkpointRequested = true; }
+inline void     Solver::setCheckpointFile(const std::string& filename) { checkpointFile = filename; }
+inline bool     Solver::checkpointDue() const
+{
+    return checkpointFile.size() > 0 &&
+           (checkpointRequested || (config.opt_checkpointEvery > 0 && conflicts >= lastCheckpointConflicts + config.opt_checkpointEvery));
+}
 inline void     Solver::budgetOff() { conflict_budget = propagation_budget = -1; }
 inline bool     Solver::withinBudget() const
 {
@@ -1997,8 +2195,31 @@ inline bool Solver::reverseLearntClause(T& learned_clause, unsigned int& lbd, un
         // first propagate, then add literals. this way, the empty clause could be learned
         CRef    confl     = CRef_Undef;
         watches.cleanAll();
+        watchesBin.cleanAll();
         while (trailHead < reverseMinimization.trail.size()) {
             const Lit p   = reverseMinimization.trail[trailHead++];     // 'p' is enqueued fact to propagate.
+
+            // handle binary clauses as usual (no write access necessary!)
+            const BinWatchLists::List wbin = watchesBin[p];
+            for (int k = 0 ; k < wbin.size(); ++ k) {
+                const Lit& imp = wbin[k].blocker();
+                if (reverseMinimization.value(imp) == l_False) {
+                    confl = wbin[k].cref();              // store the conflict (only checked against CRef_Undef)
+                    trailHead = reverseMinimization.trail.size(); // to stop propagation (condition of the above while loop)
+                    DOUT(if (localDebug) {
+                    std::cerr << "reverse minimization hit a conflict during propagation" << std::endl;
+                    std::cerr << "c qhead: " << qhead << " level 0: " << (trail_lim.size() == 0 ? trail.size() : trail_lim[0]) << " trail: " << trail << std::endl;
+                        std::cerr << "c trailHead: " << trailHead << " rev-trail: " << reverseMinimization.trail << std::endl;
+                    }
+                        );
+                    break;
+                } else if (reverseMinimization.value(imp) == l_Undef) {  // imply other literal
+                    if (localDebug) { std::cerr << "c enqueue " << imp << " due to binary clause with " << ~p << std::endl; }
+                    reverseMinimization.uncheckedEnqueue(imp);
+                }
+            }
+            if (confl != CRef_Undef) { break; }
+
             vec<Watcher>&  ws  = watches[p];                // do not modify watch list!
             Watcher        *i, *end;
             // propagate longer clauses here!
@@ -2006,24 +2227,6 @@ inline bool Solver::reverseLearntClause(T& learned_clause, unsigned int& lbd, un
 
                 if (localDebug) { std::cerr << "c propagate " << p << " on clause " << ca[i->cref()] << std::endl; }
 
-                if (i->isBinary()) {   // handle binary clauses as usual (no write access necessary!)
-                    const Lit& imp = i->blocker();
-                    if (reverseMinimization.value(imp) == l_False) {
-                        confl = i->cref();              // store the conflict
-                        trailHead = reverseMinimization.trail.size(); // to stop propagation (condition of the above while loop)
-                        DOUT(if (localDebug) {
-                        std::cerr << "reverse minimization hit a conflict during propagation" << std::endl;
-                        std::cerr << "c qhead: " << qhead << " level 0: " << (trail_lim.size() == 0 ? trail.size() : trail_lim[0]) << " trail: " << trail << std::endl;
-                            std::cerr << "c trailHead: " << trailHead << " rev-trail: " << reverseMinimization.trail << std::endl;
-                        }
-                            );
-                        break;
-                    } else if (reverseMinimization.value(imp) == l_Undef) {  // imply other literal
-                        if (localDebug) { std::cerr << "c enqueue " << imp << " due to " << ca[ i->cref() ] << std::endl; }
-                        reverseMinimization.uncheckedEnqueue(imp);
-                    }
-                    continue;
-                }
                 // Try to avoid inspecting the clause:
                 const Lit blocker = i->blocker();
                 if (reverseMinimization.value(blocker) == l_True) { // keep binary clauses, and clauses where the blocking literal is satisfied
@@ -2135,13 +2338,21 @@ inline int Solver::computeLBD(const T& lits, const int& litsSize)
 
     int distance = 0;
 
+    // gather the levels of long clauses with AVX2 first, the marking below is sequential anyways
+    const int32_t* levels = 0;
+    if (useSimd && litsSize >= 16 && nVars() < INT32_MAX / (int)sizeof(VarData)) {   // offsets of the kernel have 32 bit
+        lbdLevels.growTo(litsSize);
+        Simd::gatherFieldsAVX2(Simd::literals(lits), litsSize, &vardata[0].level, sizeof(VarData), &lbdLevels[0]);
+        levels = &lbdLevels[0];
+    }
+
     // Generate a unique identifier (aka step) for this function call
     lbd_marker.nextStep();
     bool withLevelZero = false;
     const int minLevel = (config.opt_lbd_ignore_assumptions ? assumptions.size() : 0);
     for (int i = 0; i < litsSize; i++) {
         // decision level of the literal
-        const int& dec_level = level(var(lits[i]));
+        const int dec_level = levels != 0 ? levels[i] : level(var(lits[i]));
         if (dec_level < minLevel) { continue; }  // ignore literals for assumptions
         withLevelZero = (dec_level == 0);
 
@@ -9,6 +9,7 @@ on the Communicator implementation.
 #ifndef RISS_Minisat_SolverCommunication_h
 #define RISS_Minisat_SolverCommunication_h
 
+#include <algorithm>
 #include <cmath>
 
 #include "riss/mtl/Sort.h"
@@ -33,7 +34,6 @@ void Solver::setCommunication(Communicator* comm)
 {
     assert(communication == 0 && "Will not overwrite already set communication interface");
     communication = comm;
-    initLimits();  // set communication limits
     // copy values from communicator object
     communicationClient.sendSize = communication->sendSize;
     communicationClient.sendLbd = communication->sendLbd;
@@ -45,6 +45,7 @@ void Solver::setCommunication(Communicator* comm)
     communicationClient.checkLiterals = communication->checkLiterals; // allow sending with literals/variables (to check whether sound wrt inprocessing)
     communicationClient.useDynamicLimits = communicationClient.useDynamicLimits || communication->useDynamicLimits; // one of the two overwrites the other
     communicationClient.receiveEE = communication->receiveEqiuvalences;
+    initLimits();  // set communication limits
 
     assert(communication->nrSendCls == 0 && "cannot send clauses before initialization");
 }
@@ -216,6 +217,7 @@ inline
         toSendSize = keep; // set to number of elements that can be shared
 
         if (!multiUnits && !equivalences && !communicationClient.sendAll) {   // check sharing limits, if its not units, and no equivalences
+            updateFeedbackLimits();
             // calculated size of the send clause
             int s = 0;
             if (communication->variableProtection()) {   // check whether there are protected literals inside the clause!
@@ -249,12 +251,12 @@ inline
 
         #ifdef PCASSO
         VariableInformation vi(varFlags, communicationClient.checkLiterals);    // setup variable information object
-        communication->addClause(*toSend, toSendSize, dependencyLevel, vi, multiUnits, equivalences);
+        const bool added = communication->addClause(*toSend, toSendSize, dependencyLevel, vi, multiUnits, equivalences);
         #else
-        communication->addClause(*toSend, toSendSize, multiUnits, equivalences);
+        const bool added = communication->addClause(*toSend, toSendSize, multiUnits, equivalences);
         if (toSendSize == 0) { cerr << "c send clause of size 0 (" << toSendSize << "), multiUnit: " << multiUnits << " eqs: " << equivalences << endl; }
         #endif
-        if (! equivalences && !multiUnits) {  // update limits only if a clause was sent
+        if (! equivalences && !multiUnits && added) {  // update limits only if a clause was sent, duplicates do not count
             updateDynamicLimits(false); // a clause could be send
             communication->nrSendCls++;
         }
@@ -432,6 +434,7 @@ inline
                             return 1;
                         }
                     } else { // attach the clause, if its not a unit clause!
+                        communication->data->reportImport(communication->getID(), c.importedFrom());   // the sender learns later whether the clause was useful
                         addToProof(ca[communicationClient.receiveClauses[i]]);   // the shared clause stays in the solver, hence add this clause to the proof!
                         learnts.push(communicationClient.receiveClauses[i]);
                         if (communication->doBumpClauseActivity) {
@@ -490,6 +493,17 @@ void Solver::updateDynamicLimits(bool failed, bool sizeOnly)
     return;
 }
 
+inline
+void Solver::updateFeedbackLimits()
+{
+    if (communication->feedbackTarget <= 0 || conflicts < communicationClient.nextFeedbackCheck) { return; }
+    communicationClient.nextFeedbackCheck = conflicts + communication->feedbackInterval;
+
+    uint64_t imported = 0, useful = 0;
+    communication->data->senderFeedback(communication->getID(), imported, useful);
+    communicationClient.adaptToFeedback(imported, useful, communication->feedbackTarget, communication->feedbackChange);
+}
+
 inline
 void Solver::initVariableProtection()
 {
@@ -501,8 +515,8 @@ void Solver::initVariableProtection()
 inline
 void Solver::initLimits()
 {
-    communicationClient.currentSendSizeLimit = communication->sendSize;
-    communicationClient.currentSendLbdLimit  = communication->sendLbd;
+    communicationClient.currentSendSizeLimit = communicationClient.sendSize;   // the minimal limits might be adapted to the feedback of the receivers
+    communicationClient.currentSendLbdLimit  = communicationClient.sendLbd;
 }
 
 }
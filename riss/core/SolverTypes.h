@@ -184,7 +184,11 @@ class Clause
         unsigned has_extra : 1;
         unsigned reloced   : 1;
         #ifndef PCASSO
-        unsigned lbd       : 20;
+        unsigned lbd       : 16; // saturates, larger LBDs are not distinguished
+        unsigned importedFrom : 7; // 1 + id of the thread that shared this clause, 0 for own clauses (and unknown authors)
+        unsigned importUsed : 1; // imported clause has been used in conflict analysis of this solver
+        unsigned tier2     : 1; // learnt clause is stored in the tier2 vector of the solver
+        unsigned tierUsed  : 1; // tier2 clause was used in conflict analysis since the last tier2 reduction
         unsigned lcm_simplified : 1; // run clause vivification on this clause already?
         unsigned wasPropagated : 1; // indicate that this clause triggere unit propagation (during propagation, not immediately after learning)
         unsigned usedInAnalyze : 1; // indicate that this clause was used for conflict resolution
@@ -192,7 +196,7 @@ class Clause
         unsigned canbedel  : 1;
         unsigned can_subsume : 1;
         unsigned can_strengthen : 1;
-        unsigned size      : 32;
+        unsigned size      : 26; // the header fits into 64 bits, larger clauses are not supported
         #else
         unsigned shared     : 1;
         unsigned shCleanDelay : 1;
@@ -204,7 +208,9 @@ class Clause
         unsigned can_strengthen : 1;
         unsigned pt_level   : 11;     // level of the clause in the decision tree
         unsigned isCore    : 1;
-        unsigned lbd       : 19;
+        unsigned tier2     : 1; // learnt clause is stored in the tier2 vector of the solver
+        unsigned tierUsed  : 1; // tier2 clause was used in conflict analysis since the last tier2 reduction
+        unsigned lbd       : 17;
         #endif
 
         #ifdef CLS_EXTRA_INFO
@@ -218,6 +224,10 @@ class Clause
             , has_extra(0)
             , reloced(0)
             , lbd(0)
+            , importedFrom(0)
+            , importUsed(0)
+            , tier2(0)
+            , tierUsed(0)
             , lcm_simplified(0)
             , wasPropagated(0)
             , usedInAnalyze(0)
@@ -241,6 +251,10 @@ class Clause
             has_extra = rhs.has_extra;
             reloced = rhs.reloced;
             lbd = rhs.lbd;
+            importedFrom = rhs.importedFrom;
+            importUsed = rhs.importUsed;
+            tier2 = rhs.tier2;
+            tierUsed = rhs.tierUsed;
             lcm_simplified = rhs.lcm_simplified;
             wasPropagated = rhs.wasPropagated;
             usedInAnalyze = rhs.usedInAnalyze;
@@ -264,6 +278,10 @@ class Clause
             has_extra = rhs.has_extra;
             reloced = rhs.reloced;
             lbd = rhs.lbd;
+            importedFrom = rhs.importedFrom;
+            importUsed = rhs.importUsed;
+            tier2 = rhs.tier2;
+            tierUsed = rhs.tierUsed;
             lcm_simplified = rhs.lcm_simplified;
             wasPropagated = rhs.wasPropagated;
             usedInAnalyze = rhs.usedInAnalyze;
@@ -294,6 +312,7 @@ class Clause
         header.learnt    = learnt;
         header.has_extra = use_extra;
         header.size      = ps.size();
+        assert(header.size == (unsigned)ps.size() && "clause is too large for the header");
         header.canbedel = 1;
         header.can_subsume = 1;
         header.can_strengthen = 1;
@@ -326,6 +345,7 @@ class Clause
         header.learnt    = learnt;
         header.has_extra = use_extra;
         header.size      = psSize;
+        assert(header.size == (unsigned)psSize && "clause is too large for the header");
         header.canbedel = 1;
         header.can_subsume = 1;
         header.can_strengthen = 1;
@@ -404,7 +424,7 @@ class Clause
     /** set the literal that should be stored in the extradata */
     void         setExtraLiteral(const Lit& l) { assert(header.has_extra); data[header.size].lit = l; }
 
-    void         setLBD(int i)  {header.lbd = i;}
+    void         setLBD(int i)  {header.lbd = i; if ((int)header.lbd != i) { header.lbd = 0; --header.lbd; } } // saturate at the largest value of the bit field
     // unsigned int&       lbd    ()              { return header.lbd; }
     unsigned int        lbd() const        { return header.lbd; }
     void setCanBeDel(bool b) {header.canbedel = b;}
@@ -414,6 +434,11 @@ class Clause
     bool isCoreClause() const { return header.isCore; }
     void setCoreClause(bool c) { header.isCore = c; }
 
+    bool isTier2() const { return header.tier2; }
+    void setTier2(bool t) { header.tier2 = t; }
+    bool wasTierUsed() const { return header.tierUsed; }
+    void setTierUsed(bool u) { header.tierUsed = u; }
+
     bool wasLcmSimplified() const { return header.lcm_simplified; }
     void setLcmSimplified() { header.lcm_simplified = 1; }
     void resetLcmSimplified() { header.lcm_simplified = 0; }
@@ -424,6 +449,12 @@ class Clause
     bool wasUsedInAnalyze() const { return header.usedInAnalyze; }
     void setUsedInAnalyze() { header.usedInAnalyze = 1; }
 
+    /** id of the thread that shared this clause, -1 for own clauses */
+    int importedFrom() const { return (int)header.importedFrom - 1; }
+    void setImportedFrom(int author) { header.importedFrom = author >= 0 && author < 127 ? author + 1 : 0; }
+    bool wasImportUsed() const { return header.importUsed; }
+    void setImportUsed() { header.importUsed = 1; }
+
     void         print(bool nl = false) const
     {
         for (int i = 0; i < size(); i++) {
@@ -658,8 +689,31 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
     }
     bool extra_clause_field;
 
-    ClauseAllocator(uint32_t start_cap) : RegionAllocator<uint32_t>(start_cap), extra_clause_field(false) {}
-    ClauseAllocator() : extra_clause_field(false) {}
+    enum { Max_Free_Words = 32 };   // unused blocks with up to this many words are kept in free lists for short clauses
+
+  private:
+    vec<CRef> freeBlocks[Max_Free_Words + 1];  // unused blocks that can be reused, indexed by their size in words
+    uint32_t  freeBlockWords;                  // number of words in all free blocks
+
+    /** take a block for a clause with the given number of words from the free lists, best fit, CRef_Undef if there is none */
+    CRef allocFreeBlock(int words)
+    {
+        if (freeBlockWords == 0 || words > Max_Free_Words) { return CRef_Undef; }
+        for (int w = words; w <= Max_Free_Words; ++ w) {
+            if (freeBlocks[w].size() == 0) { continue; }
+            const CRef cr = freeBlocks[w].last();
+            freeBlocks[w].pop();
+            freeBlockWords -= w;
+            if (w - words >= clauseWord32Size(2, false)) { addFreeBlock(cr + words, w - words); }   // keep the rest, if another clause fits
+            reuse(words);                                                                          // a too small rest stays wasted
+            return cr;
+        }
+        return CRef_Undef;
+    }
+
+  public:
+    ClauseAllocator(uint32_t start_cap) : RegionAllocator<uint32_t>(start_cap), extra_clause_field(false), freeBlockWords(0) {}
+    ClauseAllocator() : extra_clause_field(false), freeBlockWords(0) {}
 
     /** reduce used space to exactly fit the space that is needed */
     void fitSize()
@@ -670,15 +724,129 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
     void moveTo(ClauseAllocator& to)
     {
         to.extra_clause_field = extra_clause_field;
+        for (int w = 0 ; w <= Max_Free_Words; ++ w) { freeBlocks[w].moveTo(to.freeBlocks[w]); }
+        to.freeBlockWords = freeBlockWords;
+        freeBlockWords = 0;
         RegionAllocator<uint32_t>::moveTo(to);
     }
 
     void copyTo(ClauseAllocator& to) const
     {
         to.extra_clause_field = extra_clause_field;
+        for (int w = 0 ; w <= Max_Free_Words; ++ w) { freeBlocks[w].copyTo(to.freeBlocks[w]); }
+        to.freeBlockWords = freeBlockWords;
         RegionAllocator<uint32_t>::copyTo(to);
     }
 
+    /** take the clauses of the given allocator from the file written by its shareMemory(), copy on write (see RegionAllocator::mapShared) */
+    bool mapShared(int fd, const ClauseAllocator& from)
+    {
+        if (!RegionAllocator<uint32_t>::mapShared(fd, from)) { return false; }
+        extra_clause_field = from.extra_clause_field;
+        if (&from != this) {
+            for (int w = 0 ; w <= Max_Free_Words; ++ w) { from.freeBlocks[w].copyTo(freeBlocks[w]); }
+            freeBlockWords = from.freeBlockWords;
+        }
+        return true;
+    }
+
+    /** number of words in blocks that are ready to be reused for new clauses */
+    uint32_t freeBlockSpace() const { return freeBlockWords; }
+
+    /** make an unused block available for new clauses, blocks larger than Max_Free_Words are split
+     * NOTE: only safe if no clause reference points into the block anymore, i.e. during garbage collection
+     */
+    void addFreeBlock(CRef cr, uint32_t words)
+    {
+        const uint32_t maxWords = Max_Free_Words;
+        for (; words >= (uint32_t)clauseWord32Size(2, false); words = words > maxWords ? words - maxWords : 0) {
+            const uint32_t blockWords = words > maxWords ? maxWords : words;
+            freeBlocks[blockWords].push(cr);
+            freeBlockWords += blockWords;
+            cr += blockWords;
+        }
+    }
+
+    void clearFreeBlocks()
+    {
+        for (int w = 0 ; w <= Max_Free_Words; ++ w) { freeBlocks[w].clear(); }
+        freeBlockWords = 0;
+    }
+
+    /** compact the arena in place, without a second arena
+     *
+     * The arena is split into regions of regionSize words (0 means the whole arena). Clauses in front of the first
+     * region whose unused fraction exceeds maxWaste stay where they are, and the gaps between them become free blocks.
+     * All clauses from this region on are moved down, their new references are stored in moved, such that references
+     * can be updated with forward(). Clauses in the shared part of a mapped arena are never moved.
+     * @param live sorted references of all clauses that are still used, without duplicates
+     * @return index of the first clause in live that has been moved
+     */
+    int compact(const vec<CRef>& live, uint32_t regionSize, double maxWaste, vec<CRef>& moved)
+    {
+        clearFreeBlocks();
+
+        // find the first region with too much waste, a region in which no clause starts is all waste
+        int from = regionSize == 0 ? 0 : live.size();
+        for (int first = 0 ; first < from;) {
+            const uint32_t region = live[first] / regionSize;
+            if (region > (first == 0 ? 0 : live[first - 1] / regionSize + 1)) { from = first; break; }
+
+            int last = first;
+            uint64_t used = 0;
+            for (; last < live.size() && live[last] / regionSize == region; ++ last) {
+                const Clause& c = operator[](live[last]);
+                used += clauseWord32Size(c.size(), c.has_extra());
+            }
+            const uint64_t regionStart = (uint64_t)region * regionSize;
+            const uint64_t extent = (regionStart + regionSize < size() ? regionStart + regionSize : size()) - regionStart;
+            if (used < extent && extent - used > maxWaste * extent) { from = first; break; }
+            first = last;
+        }
+
+        // clauses in the shared part of the memory stay in place, so that they are not copied
+        while (from < live.size() && live[from] < sharedSize()) { ++ from; }
+
+        // the gaps in front of the first moved clause can be reused
+        CRef start = 0;
+        uint32_t wastedBelow = 0;
+        for (int i = 0 ; i < from; ++ i) {
+            if (live[i] > start) {
+                addFreeBlock(start, live[i] - start);
+                wastedBelow += live[i] - start;
+            }
+            const Clause& c = operator[](live[i]);
+            start = live[i] + clauseWord32Size(c.size(), c.has_extra());
+        }
+
+        // move all other clauses down, in order, such that no clause overwrites a clause that has not been moved yet
+        moved.clear();
+        for (int i = from ; i < live.size(); ++ i) {
+            const Clause& c = operator[](live[i]);
+            const int words = clauseWord32Size(c.size(), c.has_extra());
+            assert(start <= live[i] && "clauses can only move down");
+            if (start != live[i]) { memmove(RegionAllocator<uint32_t>::lea(start), RegionAllocator<uint32_t>::lea(live[i]), sizeof(uint32_t) * words); }
+            moved.push(start);
+            start += words;
+        }
+        shrinkTo(start, wastedBelow);
+        return from;
+    }
+
+    /** reference of a clause after compact(), references in front of the first moved clause stay the same */
+    static CRef forward(CRef cr, const vec<CRef>& live, int from, const vec<CRef>& moved)
+    {
+        if (cr == CRef_Undef || from == live.size() || cr < live[from]) { return cr; }
+        int lower = from, upper = live.size() - 1;
+        while (lower < upper) {   // binary search for cr in live[from, size)
+            const int middle = lower + (upper - lower) / 2;
+            if (live[middle] < cr) { lower = middle + 1; }
+            else { upper = middle; }
+        }
+        assert(live[lower] == cr && "only references of live clauses can be forwarded");
+        return moved[lower - from];
+    }
+
     template<class Lits>
     CRef alloc(const Lits& ps, bool learnt = false)
     {
@@ -686,7 +854,9 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
         assert(sizeof(float)    == sizeof(uint32_t));
         bool use_extra = learnt | extra_clause_field;
 
-        CRef cid = RegionAllocator<uint32_t>::alloc(clauseWord32Size(ps.size(), use_extra));
+        const int words = clauseWord32Size(ps.size(), use_extra);
+        CRef cid = allocFreeBlock(words);   // short clauses reuse gaps found by the last garbage collection
+        if (cid == CRef_Undef) { cid = RegionAllocator<uint32_t>::alloc(words); }
         new (lea(cid)) Clause(ps, use_extra, learnt);
 
         return cid;
@@ -699,7 +869,9 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
         assert(sizeof(float)    == sizeof(uint32_t));
         bool use_extra = learnt | extra_clause_field;
 
-        CRef cid = RegionAllocator<uint32_t>::alloc(clauseWord32Size(psSize, use_extra));
+        const int words = clauseWord32Size(psSize, use_extra);
+        CRef cid = allocFreeBlock(words);   // short clauses reuse gaps found by the last garbage collection
+        if (cid == CRef_Undef) { cid = RegionAllocator<uint32_t>::alloc(words); }
         new (lea(cid)) Clause(ps, psSize, use_extra, learnt);
 
         return cid;
@@ -723,6 +895,7 @@ class ClauseAllocator : public RegionAllocator<uint32_t>
      */
     void clear(bool clean = false)
     {
+        clearFreeBlocks();
         RegionAllocator<uint32_t>::clear(clean);
     }
 
@@ -875,6 +1048,24 @@ class OccLists
 
     void  cleanAll();
     void  clean(const Idx& idx);
+
+    /** back the array of lists, and the memory range that holds the elements of the lists, with transparent huge pages
+     *  note: the elements are allocated with malloc, so that other data of the same thread can share the range
+     * @return number of advised bytes
+     */
+    size_t adviseHugePages()
+    {
+        size_t advised = advise_huge_pages((Vec*)occs, sizeof(Vec) * occs.capacity());
+        uintptr_t low = UINTPTR_MAX, high = 0;
+        for (int i = 0 ; i < occs.size(); ++ i) {
+            if (occs[i].size() == 0) { continue; }
+            const uintptr_t begin = (uintptr_t)&occs[i][0], end = begin + sizeof(occs[i][0]) * occs[i].capacity();
+            low = begin < low ? begin : low;
+            high = end > high ? end : high;
+        }
+        if (high > low) { advised += advise_huge_pages((void*)low, high - low); }
+        return advised;
+    }
     void  smudge(const Idx& idx)
     {
         if (dirty[toInt(idx)] == 0) {
@@ -923,6 +1114,174 @@ void OccLists<Idx, Vec, Deleted>::clean(const Idx& idx)
 }
 
 
+//=================================================================================================
+// PackedOccLists -- occurrence lists with lazy deletion, that store all elements in a single arena:
+
+/** the list of each index is a segment of one region, which is addressed by its offset
+ *  A full list is extended in place, if it is the last segment of the region, and moved behind the last segment
+ *  otherwise. Once half of the region is wasted, all lists are stored one after the other again, in the order of
+ *  their index (see compact). Adding an element to a list can move the region, so that pointers to elements
+ *  become invalid, while the List handles stay valid as long as no index is added.
+ */
+template<class Idx, class T, class Deleted>
+class PackedOccLists
+{
+    struct Segment {
+        uint32_t offset; // position of the first element in the region
+        uint32_t sz;     // elements in the list
+        uint32_t cap;    // elements that fit into the segment
+        Segment() : offset(0), sz(0), cap(0) {}
+    };
+
+    RegionAllocator<T> region;
+    vec<Segment>       segments;
+    vec<char>          dirty;
+    vec<Idx>           dirties;
+    Deleted            deleted;
+
+    /** give the segment enough space for the given number of elements, by moving it if necessary */
+    void grow(Segment& s, uint32_t minCap)
+    {
+        uint32_t newCap = s.cap < 2 ? 4 : s.cap * 2;
+        while (newCap < minCap) { newCap *= 2; }
+        if (s.cap > 0 && s.offset + s.cap == region.size()) {   // last segment, grow in place
+            region.alloc(newCap - s.cap);
+            s.cap = newCap;
+            return;
+        }
+        if (region.wasted() > region.size() / 2) { compact(); }
+        const uint32_t offset = region.alloc(newCap);
+        if (s.sz > 0) { memcpy(region.lea(offset), region.lea(s.offset), sizeof(T) * s.sz); }
+        region.free(s.cap);
+        s.offset = offset;
+        s.cap = newCap;
+    }
+
+    /** give the memory of the segment back */
+    void release(Segment& s)
+    {
+        region.free(s.cap);
+        s = Segment();
+    }
+
+  public:
+
+    /** handle to the list of a single index, with the interface of vec */
+    class List
+    {
+        PackedOccLists* lists;
+        Segment*        segment;
+
+      public:
+        List(PackedOccLists* _lists, Segment* _segment) : lists(_lists), segment(_segment) {}
+
+        int  size() const     { return segment->sz; }
+        int  capacity() const { return segment->cap; }
+        bool empty() const    { return segment->sz == 0; }
+
+        T*   data() const     { return segment->cap == 0 ? nullptr : lists->region.lea(segment->offset); }
+        T&   operator [](int index) const { assert(0 <= index && index < (int)segment->sz); return lists->region[segment->offset + index]; }
+        T&   last() const     { return (*this)[segment->sz - 1]; }
+
+        void push(const T& elem) const
+        {
+            if (segment->sz == segment->cap) { lists->grow(*segment, segment->sz + 1); }
+            lists->region[segment->offset + segment->sz ++] = elem;
+        }
+        void pop() const                   { assert(segment->sz > 0); segment->sz --; }
+        void shrink(int nelems) const      { assert(nelems <= (int)segment->sz); segment->sz -= nelems; }
+        void shrink_(int nelems) const     { shrink(nelems); }
+        void clear(bool dealloc = false) const
+        {
+            if (dealloc) { lists->release(*segment); }
+            else { segment->sz = 0; }
+        }
+    };
+
+    PackedOccLists(const Deleted& d) : region(1024), deleted(d) {}
+
+    void  init(const Idx& idx) { segments.growTo(toInt(idx) + 1); dirty.growTo(toInt(idx) + 1, 0); }
+    List  operator[](const Idx& idx) { return List(this, &segments[toInt(idx)]); }
+
+    void  cleanAll();
+    void  clean(const Idx& idx);
+
+    /** store all lists one after the other, in the order of their index, keep size/8 slack per list */
+    void  compact()
+    {
+        uint64_t needed = 0;
+        for (int i = 0 ; i < segments.size(); ++ i) { needed += segments[i].sz == 0 ? 0 : segments[i].sz + (segments[i].sz >> 3) + 1; }
+
+        RegionAllocator<T> compacted(needed > 1024 ? needed : 1024);
+        for (int i = 0 ; i < segments.size(); ++ i) {
+            Segment& s = segments[i];
+            if (s.sz == 0) { s = Segment(); continue; }
+            const uint32_t cap = s.sz + (s.sz >> 3) + 1;
+            const uint32_t offset = compacted.alloc(cap);
+            memcpy(compacted.lea(offset), region.lea(s.offset), sizeof(T) * s.sz);
+            s.offset = offset;
+            s.cap = cap;
+        }
+        compacted.moveTo(region);
+    }
+
+    /** back the array of lists and the region with transparent huge pages, also after the region grows
+     * @return number of advised bytes
+     */
+    size_t adviseHugePages()
+    {
+        return advise_huge_pages((Segment*)segments, sizeof(Segment) * segments.capacity()) + region.useHugePages(true);
+    }
+
+    void  smudge(const Idx& idx)
+    {
+        if (dirty[toInt(idx)] == 0) {
+            dirty[toInt(idx)] = 1;
+            dirties.push(idx);
+        }
+    }
+
+    void  clear(bool free = true)
+    {
+        segments.clear(free);
+        dirty   .clear(free);
+        dirties .clear(free);
+        region  .clear(free);
+    }
+
+    /** clear dirties -- careful use, use only after clearing all watch lists */
+    void clearDirties() { dirties.clear(); }
+
+    int size() const { return segments.size(); }
+};
+
+
+template<class Idx, class T, class Deleted>
+void PackedOccLists<Idx, T, Deleted>::cleanAll()
+{
+    for (int i = 0; i < dirties.size(); i++)
+        // Dirties may contain duplicates so check here if a variable is already cleaned:
+        if (dirty[toInt(dirties[i])]) {
+            clean(dirties[i]);
+        }
+    dirties.clear();
+}
+
+
+template<class Idx, class T, class Deleted>
+void PackedOccLists<Idx, T, Deleted>::clean(const Idx& idx)
+{
+    List list = (*this)[idx];
+    int  i, j;
+    for (i = j = 0; i < list.size(); i++)
+        if (!deleted(list[i])) {
+            list[j++] = list[i];
+        }
+    list.shrink(i - j);
+    dirty[toInt(idx)] = 0;
+}
+
+
 //=================================================================================================
 // CMap -- a class for mapping clauses to values:
 
@@ -1097,7 +1456,7 @@ struct Watcher {
     CRef clauseReference;
 
 //     unsigned blockingLit: 30;
-//     unsigned watchType: 2; // 0 = binary, 1 = long clause, 2= 3=
+//     unsigned watchType: 2; // 0 = binary, 1 = long clause, 2 = implicit binary, 3 = implicit learnt binary
     uint32_t blockingLitData;
 
     // wrapper
@@ -1107,8 +1466,10 @@ struct Watcher {
     void cref(const CRef& newRef) { clauseReference = newRef; }
     void blocker(const Lit& newBlocker) { assert(toInt(newBlocker) < (1 << 30) && "can only handle 30 bits here"); blockingLitData = ((uint32_t)toInt(newBlocker) & 0x3fffffff); }
 
-    bool isBinary() const { return (blockingLitData & 0xc0000000) == 0; }          // non of the type bits is set
+    bool isBinary() const { return (blockingLitData & 0xc0000000) != 0x40000000; } // not a long clause, hence either a binary clause in the allocator, or an implicit one
     bool isLong()   const { return (blockingLitData & 0xc0000000) == 0x40000000; } // only the lower of the type bits is set
+    bool isImplicit() const { return (blockingLitData & 0x80000000) != 0; }        // binary clause that is only present in the watch lists (clause reference is invalid)
+    bool isLearntImplicit() const { return (blockingLitData & 0xc0000000) == 0xc0000000; } // both type bits are set
     bool matchWatchType(const int type) const { return (blockingLitData & 0xc0000000) == ((type & 3) << 30); }
 
     // constructor and comparators
@@ -1125,9 +1486,12 @@ struct Watcher {
 struct WatcherDeleted {
     const ClauseAllocator& ca;
     WatcherDeleted(const ClauseAllocator& _ca) : ca(_ca) {}
-    bool operator()(const Watcher& w) const { return ca[w.clauseReference].mark() == 1; }
+    bool operator()(const Watcher& w) const { return !w.isImplicit() && ca[w.clauseReference].mark() == 1; }  // implicit binary clauses have no clause in the allocator
 };
 
+/** watch lists of binary clauses, all lists are stored in one region */
+typedef PackedOccLists<Lit, Watcher, WatcherDeleted> BinWatchLists;
+
 //=================================================================================================
 
 /** class that is used as mark array */
@@ -24,6 +24,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "riss/mtl/XAlloc.h"
 #include "riss/mtl/Vec.h"
 #include "riss/mtl/HPVec.h"
+#include "riss/utils/System.h"
 
 #include <iostream>
 namespace Riss
@@ -39,9 +40,21 @@ class RegionAllocator
     uint32_t  sz;
     uint32_t  cap;
     uint32_t  wasted_;
+    bool      hugePages;   // advise the kernel to use transparent huge pages for the memory
+    size_t    reserved;    // bytes of reserved address space, if the memory is a mapping (0: memory from malloc)
+    uint32_t  shared_;     // elements in front, that are mapped copy on write from a shared file
 
     void capacity(uint32_t min_cap);
 
+    void freeMemory()
+    {
+        if (reserved != 0) { Riss::releaseMemory(memory, reserved); }
+        else if (memory != nullptr) { ::free(memory); }
+        memory = nullptr;
+        reserved = 0;
+        shared_ = 0;
+    }
+
   public:
     // TODO: make this a class for better type-checking?
     typedef uint32_t Ref;
@@ -49,17 +62,54 @@ class RegionAllocator
     enum { Ref_Error = (UINT32_MAX >> 1) - 1};   // divide by 2, as we sometimes cut off the highest bit
     enum { Unit_Size = sizeof(uint32_t) };
 
-    explicit RegionAllocator(uint32_t start_cap = 1024 * 1024) : memory(nullptr), sz(0), cap(0), wasted_(0) { capacity(start_cap); }
+    explicit RegionAllocator(uint32_t start_cap = 1024 * 1024) : memory(nullptr), sz(0), cap(0), wasted_(0), hugePages(false), reserved(0), shared_(0) { capacity(start_cap); }
     ~RegionAllocator()
     {
-        if (memory != nullptr) {
-            ::free(memory);
-        }
+        freeMemory();
     }
 
     uint32_t currentCap() const      { return cap;}
     uint32_t size() const      { return sz; }
     uint32_t wasted() const      { return wasted_; }
+    uint32_t sharedSize() const  { return shared_; }
+
+    /** write the used elements into a new file in memory, which other allocators can map with mapShared
+     * @return file descriptor, -1 if shared memory is not supported
+     */
+    int      shareMemory(const char* name) const { return sz == 0 ? -1 : sharedMemoryFile(name, memory, sizeof(T) * sz); }
+
+    /** replace the memory by a copy on write mapping of the file, that has been written by shareMemory of the given allocator
+     *  The elements are shared with all other mappings of the file, until they are written to. New elements are added
+     *  behind the mapping, in reserved address space, so that the memory never moves.
+     *  @return false, if the file cannot be mapped, the memory is not changed then
+     */
+    bool     mapShared(int fd, const RegionAllocator& from)
+    {
+        const uint32_t fromSize = from.sz, fromWasted = from.wasted_;
+        const size_t page = memoryPageSize();
+        const size_t mapped = (sizeof(T) * fromSize + page - 1) / page * page;
+        const size_t bytes = sizeof(T) * (size_t)UINT32_MAX;   // enough for all references
+        T* base = (T*)reserveMemory(bytes, fd, mapped);
+        if (base == nullptr) { return false; }
+
+        freeMemory();
+        memory = base;
+        reserved = bytes;
+        cap = mapped / sizeof(T);
+        sz = shared_ = fromSize;
+        wasted_ = fromWasted;
+        if (hugePages) { advise_huge_pages(memory, sizeof(T) * cap); }
+        return true;
+    }
+
+    /** back the memory with transparent huge pages, also after the memory grows
+     * @return number of bytes that have been advised
+     */
+    size_t   useHugePages(bool use)
+    {
+        hugePages = use;
+        return hugePages ? advise_huge_pages(memory, sizeof(T) * cap) : 0;
+    }
 
     Ref      alloc(int size);
     void     free(int size)    { wasted_ += size; }
@@ -85,20 +135,25 @@ class RegionAllocator
     /** reduce used space to exactly fit the space that is needed */
     void fitSize()
     {
+        if (reserved != 0) { return; }   // mapped memory does not move
         cap = sz;                                      // reduce capacity to the number of currently used elements
         memory = (T*)::realloc(memory, sizeof(T) * cap); // free resources
     }
 
     void     moveTo(RegionAllocator& to)
     {
-        if (to.memory != nullptr) { ::free(to.memory); }
+        to.freeMemory();
         to.memory = memory;
         to.sz = sz;
         to.cap = cap;
         to.wasted_ = wasted_;
+        to.reserved = reserved;
+        to.shared_ = shared_;
+        if (to.hugePages) { advise_huge_pages(to.memory, sizeof(T) * to.cap); }   // the destination keeps its setting
 
         memory = nullptr;
-        sz = cap = wasted_ = 0;
+        sz = cap = wasted_ = shared_ = 0;
+        reserved = 0;
     }
 
     void     copyTo(RegionAllocator& to) const
@@ -115,10 +170,22 @@ class RegionAllocator
     {
         sz = 0; wasted_ = 0;
         if (clean) {   // free used resources
-            if (memory != nullptr) { ::free(memory); memory = nullptr; }
+            freeMemory();
             cap = 0;
         }
     }
+
+  protected:
+    /** mark wasted elements as used again, e.g. when a freed block is reused */
+    void     reuse(uint32_t size) { assert(wasted_ >= size); wasted_ -= size; }
+
+    /** cut the used space after newSize elements (after in-place compaction), and set the number of wasted elements below */
+    void     shrinkTo(uint32_t newSize, uint32_t newWasted)
+    {
+        assert(newSize <= sz && newWasted <= newSize);
+        sz = newSize;
+        wasted_ = newWasted;
+    }
 };
 
 template<class T>
@@ -142,10 +209,16 @@ void RegionAllocator<T>::capacity(uint32_t min_cap)
     // printf(" .. (%p) cap = %u\n", this, cap);
 
     assert(cap > 0);
+    if (reserved != 0) {   // grow in place, inside the reserved address space
+        commitMemory(memory, sizeof(T) * prev_cap, sizeof(T) * cap);
+        if (hugePages) { advise_huge_pages(memory, sizeof(T) * cap); }
+        return;
+    }
     memory = (T*)::realloc(memory, sizeof(T) * cap);
 
     // we want to get an error if the allocation failed
     if (memory == 0) { throw OutOfMemoryException(); }
+    if (hugePages) { advise_huge_pages(memory, sizeof(T) * cap); }
 }
 
 
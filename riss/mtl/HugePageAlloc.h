@@ -108,6 +108,22 @@ void *realloc_huge_pages(void *ptr, size_t size)
     return newMemory;
 }
 
+/** ask the kernel to back the memory with transparent huge pages, which works for memory from malloc as well
+ *  @return number of advised bytes, only the huge pages that lie completely inside the memory are advised
+ */
+static inline
+size_t advise_huge_pages(void *ptr, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    const size_t start = ALIGN_TO_PAGE_SIZE((size_t)ptr);
+    const size_t end = ((size_t)ptr + size) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    if (ptr == NULL || end <= start || madvise((void *)start, end - start, MADV_HUGEPAGE) != 0) { return 0; }
+    return end - start;
+#else
+    return 0;
+#endif
+}
+
 //=================================================================================================
 }
 
@@ -124,6 +124,7 @@ int main(int argc, char** argv)
     BoolOption   opt_modelStyle("MAIN", "oldModel", "present model on screen in old format", false);
     BoolOption   opt_quiet("MAIN", "quiet", "Do not print the model", false);
     BoolOption   opt_parseOnly("MAIN", "parseOnly", "abort after parsing", false);
+    IntOption    opt_parseThreads("MAIN", "parseThreads", "Threads to parse uncompressed input files (0=all cores, -1=stream parser only)", 0, IntRange(-1, 256));
     BoolOption   opt_cmdLine("MAIN", "cmd", "print the relevant options", false);
     BoolOption   opt_nounsat("MAIN", "nounsat", "turn UNSAT answers into UNKNOWN", false);
 
@@ -215,7 +216,7 @@ int main(int argc, char** argv)
         S.proofFile = (drupFile) ? fopen((const char*) drupFile, "wb") : nullptr;
         if (opt_proofFormat && strlen(opt_proofFormat) > 0 && S.proofFile != nullptr) { fprintf(S.proofFile, "o proof %s\n", (const char*)opt_proofFormat); }     // we are writing proofs of the given format!
 
-        parse_DIMACS(in, S);
+        parse_DIMACS(argc == 1 ? nullptr : argv[1], in, S, opt_parseThreads);
         gzclose(in);
         FILE* res = (argc >= 3) ? fopen(argv[2], "wb") : nullptr;
 
@@ -589,6 +589,8 @@ bool SimpSolver::eliminateVar(Var v)
     // Free watchers lists for this variable, if possible:
     if (watches[ mkLit(v)].size() == 0) { watches[ mkLit(v)].clear(true); }
     if (watches[~mkLit(v)].size() == 0) { watches[~mkLit(v)].clear(true); }
+    if (watchesBin[ mkLit(v)].size() == 0) { watchesBin[ mkLit(v)].clear(true); }
+    if (watchesBin[~mkLit(v)].size() == 0) { watchesBin[~mkLit(v)].clear(true); }
 
     return backwardSubsumptionCheck();
 }
@@ -0,0 +1,188 @@
+/************************************************************************************[BinaryCNF.cc]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include "BinaryCNF.h"
+
+using namespace std;
+
+namespace Riss
+{
+
+static const char binaryCNFMagic[] = "RISSBCNF";
+static const size_t binaryCNFMagicSize = 8;
+static const uint64_t binaryCNFVersion = 1;
+
+static void writeVarint(vector<unsigned char>& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((unsigned char)value);
+}
+
+/** append the clauses of the given list, each clause is terminated by lit_Undef */
+static void writeClauses(vector<unsigned char>& out, const vector<Lit>& lits)
+{
+    size_t clauses = 0;
+    for (size_t i = 0 ; i < lits.size(); ++ i) { clauses += lits[i] == lit_Undef ? 1 : 0; }
+    writeVarint(out, clauses);
+
+    size_t i = 0;
+    while (i < lits.size()) {
+        size_t end = i;
+        while (lits[end] != lit_Undef) { ++ end; }
+        writeVarint(out, end - i);
+        int64_t previous = 0;
+        for (; i < end; ++ i) {
+            const int64_t diff = (int64_t)toInt(lits[i]) - previous;
+            writeVarint(out, (uint64_t)((diff << 1) ^ (diff >> 63)));   // zigzag encoding
+            previous = toInt(lits[i]);
+        }
+        ++ i; // skip terminating lit_Undef
+    }
+}
+
+/** reader for the content of a binary CNF file, stops reading after the first error */
+class BinaryCNFReader
+{
+    const unsigned char* pos;
+    const unsigned char* end;
+    bool failed;
+
+  public:
+    BinaryCNFReader(const unsigned char* data, size_t size) : pos(data), end(data + size), failed(false) {}
+
+    bool ok() const { return !failed; }
+
+    uint64_t varint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= end) { failed = true; return 0; }
+            const unsigned char byte = *pos++;
+            value |= (uint64_t)(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) { return value; }
+        }
+        failed = true;
+        return 0;
+    }
+
+    void clauses(vector<Lit>& lits)
+    {
+        lits.clear();
+        const uint64_t count = varint();
+        for (uint64_t c = 0 ; c < count && !failed; ++ c) {
+            const uint64_t size = varint();
+            if (size > (uint64_t)(end - pos)) { failed = true; return; }  // each literal needs at least one byte
+            int64_t previous = 0;
+            for (uint64_t i = 0 ; i < size; ++ i) {
+                const uint64_t zigzag = varint();
+                previous += (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+                if (previous < 0 || previous > INT32_MAX) { failed = true; return; }
+                lits.push_back(toLit((int)previous));
+            }
+            lits.push_back(lit_Undef);
+        }
+    }
+};
+
+bool BinaryCNF::write(const string& filename) const
+{
+    vector<unsigned char> out;
+    out.reserve(binaryCNFMagicSize + clauses.size() * 2 + undo.size() * 2 + mapping.size() * 4 + 64);
+    out.insert(out.end(), binaryCNFMagic, binaryCNFMagic + binaryCNFMagicSize);
+
+    writeVarint(out, binaryCNFVersion);
+    writeVarint(out, vars);
+    writeClauses(out, clauses);
+
+    writeVarint(out, formulaVariables + 1);
+    writeClauses(out, undo);
+
+    assert(mapping.size() == trail.size() && "compression map and trail have to have the same size");
+    writeVarint(out, mapping.size());
+    for (size_t i = 0 ; i < mapping.size(); ++ i) { writeVarint(out, mapping[i] + 1); }
+    for (size_t i = 0 ; i < trail.size(); ++ i) { writeVarint(out, toInt(trail[i])); }
+
+    FILE* f = fopen(filename.c_str(), "wb");
+    if (f == nullptr) {
+        cerr << "c ERROR: could not open binary CNF file " << filename << endl;
+        return false;
+    }
+    const bool written = fwrite(&out[0], 1, out.size(), f) == out.size();
+    return fclose(f) == 0 && written;
+}
+
+bool BinaryCNF::read(const string& filename)
+{
+    FILE* f = fopen(filename.c_str(), "rb");
+    if (f == nullptr) {
+        cerr << "c ERROR: could not open binary CNF file " << filename << endl;
+        return false;
+    }
+    vector<unsigned char> data;
+    unsigned char buffer[1 << 16];
+    size_t n = 0;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) { data.insert(data.end(), buffer, buffer + n); }
+    fclose(f);
+
+    if (!isBinaryCNF((const char*)data.data(), data.size())) {
+        cerr << "c ERROR: " << filename << " is not a binary CNF file" << endl;
+        return false;
+    }
+
+    BinaryCNFReader in(data.data() + binaryCNFMagicSize, data.size() - binaryCNFMagicSize);
+    if (in.varint() != binaryCNFVersion) {
+        cerr << "c ERROR: unsupported version of binary CNF file " << filename << endl;
+        return false;
+    }
+    vars = in.varint();
+    in.clauses(clauses);
+    formulaVariables = (int)in.varint() - 1;
+    in.clauses(undo);
+
+    const uint64_t mapVars = in.varint();
+    mapping.clear();
+    trail.clear();
+    for (uint64_t i = 0 ; i < mapVars && in.ok(); ++ i) { mapping.push_back((Var)in.varint() - 1); }
+    for (uint64_t i = 0 ; i < mapVars && in.ok(); ++ i) {
+        const int value = (int)in.varint();
+        if (value > 3) { break; }   // l_Undef might be represented by 2 or 3
+        trail.push_back(toLbool(value));
+    }
+
+    if (!in.ok() || trail.size() != mapping.size()) {
+        cerr << "c ERROR: binary CNF file " << filename << " is truncated or corrupted" << endl;
+        return false;
+    }
+    return true;
+}
+
+bool BinaryCNF::isBinaryCNF(const char* data, size_t size)
+{
+    return size >= binaryCNFMagicSize && memcmp(data, binaryCNFMagic, binaryCNFMagicSize) == 0;
+}
+
+bool BinaryCNF::isBinaryCNFFile(const string& filename)
+{
+    FILE* f = fopen(filename.c_str(), "rb");
+    if (f == nullptr) { return false; }
+    char header[binaryCNFMagicSize];
+    const size_t n = fread(header, 1, binaryCNFMagicSize, f);
+    fclose(f);
+    return isBinaryCNF(header, n);
+}
+
+} // namespace Riss
@@ -0,0 +1,77 @@
+/*************************************************************************************[BinaryCNF.h]
+
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef RISS_BINARYCNF_H
+#define RISS_BINARYCNF_H
+
+#include <string>
+#include <vector>
+
+#include "riss/core/SolverTypes.h"
+
+namespace Riss
+{
+
+/**
+ * Compact binary representation of a (simplified) formula, that can be written and read much faster than DIMACS.
+ *
+ * Besides the clauses, the file can carry the information that is necessary to extend a model of the formula
+ * to a model of the original formula: the undo stack of Coprocessor and the compression map of Dense.
+ *
+ * File layout: the magic string "RISSBCNF", followed by unsigned LEB128 varints. The literals of a clause are
+ * stored as zigzag encoded differences of consecutive literals (in the Lit encoding), preceded by the size of the
+ * clause. The sections are: header (version, variables, clauses), clauses, formula variables, undo clauses,
+ * compression map (mapping of each original variable, shifted by one so that UNIT becomes 0, and the value of
+ * each variable in the trail of the compression).
+ */
+class BinaryCNF
+{
+  public:
+
+    int vars;                    // number of variables of the formula
+    std::vector<Lit> clauses;    // clauses of the formula, each clause is terminated by lit_Undef
+
+    int formulaVariables;        // number of variables in the original formula (-1, if unknown)
+    std::vector<Lit> undo;       // clauses of the undo stack (in the original formula), each clause is terminated by lit_Undef
+
+    std::vector<Var> mapping;    // compression map, mapping from original variables to compressed variables (empty, if there is no compression)
+    std::vector<lbool> trail;    // value of each original variable that has been removed as unit by the compression
+
+    BinaryCNF() : vars(0), formulaVariables(-1) {}
+
+    /** add a clause to the formula part */
+    template<class T>
+    void addClause(const T& c, int size)
+    {
+        for (int i = 0 ; i < size; ++ i) { clauses.push_back(c[i]); }
+        clauses.push_back(lit_Undef);
+    }
+
+    /** write the whole object into the given file
+     * @return false, if the file could not be written
+     */
+    bool write(const std::string& filename) const;
+
+    /** read the whole object from the given file
+     * @return false, if the file could not be opened or is not a valid binary CNF file
+     */
+    bool read(const std::string& filename);
+
+    /** check whether the given memory starts like a binary CNF file */
+    static bool isBinaryCNF(const char* data, size_t size);
+
+    /** check whether the given file is a binary CNF file */
+    static bool isBinaryCNFFile(const std::string& filename);
+};
+
+} // namespace Riss
+
+#endif // RISS_BINARYCNF_H
@@ -0,0 +1,80 @@
+/*****************************************************************************************[Simd.cc]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#include <cassert>
+
+#include "riss/utils/Simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define RISS_SIMD_X86
+    #include <immintrin.h>
+#endif
+
+namespace Riss
+{
+
+namespace Simd
+{
+
+#ifdef RISS_SIMD_X86
+
+bool avx2Supported()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+__attribute__((target("avx2")))
+int firstNonFalseAVX2(const Lit* lits, int from, int size, const uint8_t* values, int stride)
+{
+    assert(stride >= 4 && "gather reads 32 bit per variable");
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i byteMask = _mm256_set1_epi32(0xff);
+    const __m256i falseValue = _mm256_set1_epi32(toInt(l_False));
+    const __m256i strides = _mm256_set1_epi32(stride);
+
+    for (; from + 8 <= size; from += 8) {
+        const __m256i l = _mm256_loadu_si256((const __m256i*)(lits + from));
+        const __m256i offsets = _mm256_mullo_epi32(_mm256_srli_epi32(l, 1), strides);
+        __m256i v = _mm256_and_si256(_mm256_i32gather_epi32((const int*)values, offsets, 1), byteMask);
+        v = _mm256_xor_si256(v, _mm256_and_si256(l, one));   // value of the literal
+        const int falseLanes = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, falseValue)));
+        if (falseLanes != 0xff) { return from + __builtin_ctz(~falseLanes & 0xff); }
+    }
+    return firstNonFalse(lits, from, size, values, stride);
+}
+
+__attribute__((target("avx2")))
+void gatherFieldsAVX2(const Lit* lits, int size, const int32_t* field, int stride, int32_t* out)
+{
+    assert(stride >= 4 && "gather reads 32 bit per variable");
+    const __m256i strides = _mm256_set1_epi32(stride);
+    int i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const __m256i l = _mm256_loadu_si256((const __m256i*)(lits + i));
+        const __m256i offsets = _mm256_mullo_epi32(_mm256_srli_epi32(l, 1), strides);
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_i32gather_epi32((const int*)field, offsets, 1));
+    }
+    gatherFields(lits + i, size - i, field, stride, out + i);
+}
+
+#else // no x86 CPU, always use the scalar versions
+
+bool avx2Supported() { return false; }
+
+int firstNonFalseAVX2(const Lit* lits, int from, int size, const uint8_t* values, int stride)
+{
+    return firstNonFalse(lits, from, size, values, stride);
+}
+
+void gatherFieldsAVX2(const Lit* lits, int size, const int32_t* field, int stride, int32_t* out)
+{
+    gatherFields(lits, size, field, stride, out);
+}
+
+#endif
+
+}
+
+}
@@ -0,0 +1,61 @@
+/******************************************************************************************[Simd.h]
+Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+**************************************************************************************************/
+
+#ifndef RISS_SIMD_H
+#define RISS_SIMD_H
+
+#include "riss/core/SolverTypes.h"
+
+namespace Riss
+{
+
+/** vectorized kernels that gather per-variable data for the literals of a clause
+ *
+ *  Per-variable data is described by the address of the field for variable 0 and the stride between two variables
+ *  in bytes, so that fields of the solver's structs can be read directly. The AVX2 versions are compiled for the
+ *  target only, and must only be called if avx2Supported() returns true. Fields are read as 32 bit values, so the
+ *  stride has to be at least 4 bytes, and var * stride has to fit into 31 bits.
+ */
+namespace Simd
+{
+
+/** address of the first literal of a clause, to pass clauses and literal vectors to the kernels */
+inline const Lit* literals(const Clause& c) { return (const Lit*)c; }
+inline const Lit* literals(const vec<Lit>& lits) { return &lits[0]; }
+inline const Lit* literals(const Lit* lits) { return lits; }
+
+/** return true, if the current CPU can execute the AVX2 kernels (checked once) */
+bool avx2Supported();
+
+/** index of the first literal in lits[from, size) whose value is not l_False, size if there is no such literal
+ * @param values address of the lbool of variable 0
+ */
+inline int firstNonFalse(const Lit* lits, int from, int size, const uint8_t* values, int stride)
+{
+    for (; from < size; ++ from) {
+        if ((values[ var(lits[from]) * stride ] ^ (uint8_t)sign(lits[from])) != toInt(l_False)) { return from; }
+    }
+    return size;
+}
+
+/** AVX2 version of firstNonFalse, checks 8 literals per step */
+int firstNonFalseAVX2(const Lit* lits, int from, int size, const uint8_t* values, int stride);
+
+/** copy the 32 bit field of the variable of each literal into out[0, size)
+ * @param field address of the field of variable 0
+ */
+inline void gatherFields(const Lit* lits, int size, const int32_t* field, int stride, int32_t* out)
+{
+    const char* base = (const char*)field;
+    for (int i = 0 ; i < size; ++ i) { out[i] = *(const int32_t*)(base + var(lits[i]) * stride); }
+}
+
+/** AVX2 version of gatherFields, gathers 8 fields per step */
+void gatherFieldsAVX2(const Lit* lits, int size, const int32_t* field, int stride, int32_t* out);
+
+}
+
+}
+
+#endif
@@ -25,6 +25,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 using namespace Riss;
 
@@ -107,3 +108,135 @@ double Riss::memUsed()
 
 double Riss::memUsedPeak(void) { return memUsed(); }
 #endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <string>
+
+double Riss::memHugePages()
+{
+    FILE* in = fopen("/proc/self/smaps_rollup", "rb");
+    if (in == nullptr) { return 0; }
+
+    // Find the correct line, beginning with "AnonHugePages:":
+    int huge_kb = 0;
+    while (!feof(in) && fscanf(in, "AnonHugePages: %d kB", &huge_kb) != 1)
+        while (!feof(in) && fgetc(in) != '\n')
+            ;
+    fclose(in);
+    return huge_kb / 1024.0;
+}
+
+int Riss::sharedMemoryFile(const char* name, const void* data, size_t bytes)
+{
+    const int fd = syscall(__NR_memfd_create, name, 0);   // the file lives as long as it is open or mapped
+    if (fd < 0) { return -1; }
+    const size_t page = memoryPageSize();
+    const size_t padded = (bytes + page - 1) / page * page;
+    if (ftruncate(fd, padded) != 0) { close(fd); return -1; }
+    for (size_t written = 0; written < bytes;) {
+        const ssize_t w = write(fd, (const char*)data + written, bytes - written);
+        if (w <= 0) { close(fd); return -1; }
+        written += w;
+    }
+    return fd;
+}
+
+void* Riss::reserveMemory(size_t bytes, int fd, size_t mapped)
+{
+    void* base = mmap(nullptr, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED) { return nullptr; }
+    if (fd >= 0 && mapped > 0 && mmap(base, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(base, bytes);
+        return nullptr;
+    }
+    return base;
+}
+
+void Riss::commitMemory(void* base, size_t from, size_t to)
+{
+    const size_t page = memoryPageSize();
+    from = from / page * page;
+    to = (to + page - 1) / page * page;
+    if (to > from && mprotect((char*)base + from, to - from, PROT_READ | PROT_WRITE) != 0) { throw OutOfMemoryException(); }
+}
+
+void Riss::releaseMemory(void* base, size_t bytes)
+{
+    if (base != nullptr) { munmap(base, bytes); }
+}
+
+size_t Riss::memoryPageSize()
+{
+    static const size_t page = sysconf(_SC_PAGESIZE);
+    return page;
+}
+
+bool Riss::sharedMemoryUsage(const char* name, double& shared, double& copied)
+{
+    shared = copied = 0;
+    FILE* in = fopen("/proc/self/smaps", "rb");
+    if (in == nullptr) { return false; }
+
+    // sum up the pages of all mappings of the file, copied pages are anonymous, the proportional size counts pages that
+    // are mapped several times only once
+    const std::string file = std::string("/memfd:") + name;
+    bool inFile = false;
+    int pss = 0, anonymous = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), in) != nullptr) {
+        unsigned long start = 0, end = 0;
+        if (sscanf(line, "%lx-%lx", &start, &end) == 2) {
+            inFile = strstr(line, file.c_str()) != nullptr;   // header line of the next mapping
+        } else if (inFile && sscanf(line, "Pss: %d kB", &pss) == 1) {
+            shared += pss / 1024.0;
+        } else if (inFile && sscanf(line, "Anonymous: %d kB", &anonymous) == 1) {
+            shared -= anonymous / 1024.0;
+            copied += anonymous / 1024.0;
+        }
+    }
+    fclose(in);
+    return true;
+}
+
+TlbMissCounter::TlbMissCounter(bool open) : fd(-1)
+{
+    if (!open) { return; }
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);   // fails without permission, e.g. in containers
+}
+
+TlbMissCounter::~TlbMissCounter()
+{
+    if (fd >= 0) { close(fd); }
+}
+
+uint64_t TlbMissCounter::read() const
+{
+    uint64_t misses = 0;
+    if (fd < 0 || ::read(fd, &misses, sizeof(misses)) != sizeof(misses)) { return 0; }
+    return misses;
+}
+
+#else
+
+double Riss::memHugePages() { return 0; }
+int Riss::sharedMemoryFile(const char* name, const void* data, size_t bytes) { return -1; }
+void* Riss::reserveMemory(size_t bytes, int fd, size_t mapped) { return nullptr; }
+void Riss::commitMemory(void* base, size_t from, size_t to) {}
+void Riss::releaseMemory(void* base, size_t bytes) {}
+size_t Riss::memoryPageSize() { return 4096; }
+bool Riss::sharedMemoryUsage(const char* name, double& shared, double& copied) { shared = copied = 0; return false; }
+Riss::TlbMissCounter::TlbMissCounter(bool open) : fd(-1) {}
+Riss::TlbMissCounter::~TlbMissCounter() {}
+uint64_t Riss::TlbMissCounter::read() const { return 0; }
+
+#endif
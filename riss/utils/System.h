@@ -39,6 +39,26 @@ static inline double cpuTime(void); // CPU-time in seconds.
 static inline double wallClockTime(void); //Wall-Clock-time in seconds
 extern double memUsed();            // Memory in mega bytes (returns 0 for unsupported architectures).
 extern double memUsedPeak();        // Peak-memory in mega bytes (returns 0 for unsupported architectures).
+extern double memHugePages();       // Memory backed by transparent huge pages in mega bytes (returns 0 for unsupported architectures).
+
+// Memory that several threads share copy on write, pages are copied only when a thread writes to them (Linux only).
+extern int sharedMemoryFile(const char* name, const void* data, size_t bytes); // File in memory with the given content, padded to full pages, returns the file descriptor (-1 if unsupported).
+extern void* reserveMemory(size_t bytes, int fd, size_t mapped); // Reserve address space, and map the first mapped bytes of the file copy on write into it (nullptr if unsupported).
+extern void commitMemory(void* base, size_t from, size_t to);   // Make the reserved bytes [from, to) usable, they are zero.
+extern void releaseMemory(void* base, size_t bytes);             // Unmap reserved memory.
+extern size_t memoryPageSize();                                  // Bytes per page of the mappings above.
+extern bool sharedMemoryUsage(const char* name, double& shared, double& copied); // Mega bytes of all mappings of the named file, that are still shared and that have been copied.
+
+/** counts the data TLB misses of the calling thread with a hardware performance counter, if the system allows it */
+class TlbMissCounter
+{
+    int fd;
+  public:
+    TlbMissCounter(bool open = true);   // open the counter only if it is used, the system call is not free
+    ~TlbMissCounter();
+    bool available() const { return fd >= 0; }
+    uint64_t read() const;      // misses since the counter has been created, 0 if not available
+};
 
 }
 
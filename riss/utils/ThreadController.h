@@ -9,8 +9,9 @@ Copyright (c) 2012, Norbert Manthey, LGPL v2, see LICENSE
 
 #include "riss/utils/LockCollection.h"
 
-#include <vector>
+#include <functional>
 #include <iostream>
+#include <vector>
 
 // using namespace std;
 
@@ -93,6 +94,42 @@ class ThreadData
     static void* executeThread(void* threadData);
 };
 
+/** distribute the index range [begin,end) of a work queue among workers
+ *  Each worker starts with an equal part of the range and processes it in chunks of the given grain size from the back.
+ *  Once a worker runs out of work, it steals the front half of the remaining part of another worker.
+ */
+class RangeScheduler
+{
+    struct Part {
+        SpinLock lock;
+        unsigned begin, end;
+        char dummy [64 - sizeof(SpinLock) - 2 * sizeof(unsigned)];  // one part per cache line
+        Part() : begin(0), end(0) {}
+    };
+
+    std::vector<Part> parts;
+    unsigned grain;
+
+  public:
+    RangeScheduler(unsigned workers, unsigned begin, unsigned end, unsigned _grain)
+        : parts(workers == 0 ? 1 : workers), grain(_grain == 0 ? 1 : _grain)
+    {
+        const unsigned size = end > begin ? end - begin : 0;
+        for (unsigned i = 0 ; i < parts.size(); ++ i) {
+            parts[i].begin = begin + (unsigned)(((uint64_t)size * i) / parts.size());
+            parts[i].end   = begin + (unsigned)(((uint64_t)size * (i + 1)) / parts.size());
+        }
+    }
+
+    /** number of workers the range has been split for */
+    unsigned workers() const { return parts.size(); }
+
+    /** get the next chunk [start,end) for the given worker
+     * @return false, if there is no work left for this worker
+     */
+    bool next(unsigned worker, unsigned& start, unsigned& end);
+};
+
 /** main class to controll the execution of multiple threads */
 class ThreadController
 {
@@ -124,6 +161,11 @@ class ThreadController
 
     /** return the number of threads */
     unsigned size() const { return threads; }
+
+    /** split [begin,end) into chunks of size grain and call f(worker, start, end) for each chunk on all threads,
+     *  idle threads steal the remaining work of other threads
+     */
+    void parallelFor(unsigned begin, unsigned end, unsigned grain, const std::function<void(unsigned, unsigned, unsigned)>& f);
 };
 
 /*
@@ -189,6 +231,50 @@ inline void ThreadData::run()
     ownLock.unlock();
 }
 
+inline bool RangeScheduler::next(unsigned worker, unsigned& start, unsigned& end)
+{
+    assert(worker < parts.size() && "there is no part for this worker");
+    Part& own = parts[worker];
+    own.lock.lock();
+    if (own.end > own.begin) {
+        end = own.end;
+        start = own.end - own.begin > grain ? own.end - grain : own.begin;
+        own.end = start;
+        own.lock.unlock();
+        return true;
+    }
+    own.lock.unlock();
+
+    // steal from the other workers, start with the neighbor
+    for (unsigned i = 1 ; i < parts.size(); ++ i) {
+        Part& victim = parts[(worker + i) % parts.size()];
+        if (victim.end <= victim.begin) { continue; }  // racy pre-check, avoid locking empty parts
+        victim.lock.lock();
+        const unsigned remaining = victim.end > victim.begin ? victim.end - victim.begin : 0;
+        if (remaining == 0) { victim.lock.unlock(); continue; }
+        if (remaining <= grain) {   // take the last chunk of the victim
+            start = victim.begin;
+            end = victim.end;
+            victim.begin = victim.end;
+            victim.lock.unlock();
+            return true;
+        }
+        const unsigned stolenBegin = victim.begin, stolenEnd = victim.begin + remaining / 2;
+        victim.begin = stolenEnd;
+        victim.lock.unlock();
+
+        // keep the stolen part as own part, and process its last chunk
+        own.lock.lock();
+        end = stolenEnd;
+        start = stolenEnd - stolenBegin > grain ? stolenEnd - grain : stolenBegin;
+        own.begin = stolenBegin;
+        own.end = start;
+        own.lock.unlock();
+        return true;
+    }
+    return false;
+}
+
 inline ThreadController::ThreadController(int _threads)
     : threads(_threads), threadHandles(0), data(0)
 {}
@@ -313,6 +399,36 @@ inline void ThreadController::waitForOneFinished()
 }
 
 
+/** data of a single worker of ThreadController::parallelFor */
+struct ParallelForData {
+    RangeScheduler* scheduler;
+    const std::function<void(unsigned, unsigned, unsigned)>* function;
+    unsigned worker;
+
+    static void* run(void* argument)
+    {
+        ParallelForData* forData = (ParallelForData*) argument;
+        unsigned start = 0, end = 0;
+        while (forData->scheduler->next(forData->worker, start, end)) { (*forData->function)(forData->worker, start, end); }
+        return 0;
+    }
+};
+
+inline void ThreadController::parallelFor(unsigned begin, unsigned end, unsigned grain, const std::function<void(unsigned, unsigned, unsigned)>& f)
+{
+    RangeScheduler scheduler(threads, begin, end, grain);
+    std::vector<ParallelForData> forData(scheduler.workers());
+    for (unsigned i = 0 ; i < forData.size(); ++ i) {
+        forData[i].scheduler = &scheduler;
+        forData[i].function = &f;
+        forData[i].worker = i;
+    }
+    if (threads == 0) { ParallelForData::run(&forData[0]); return; }
+
+    std::vector<Job> jobs(threads);
+    for (int i = 0 ; i < threads; ++ i) { jobs[i] = Job(ParallelForData::run, &forData[i]); }
+    runJobs(jobs);
+}
 
 }
 
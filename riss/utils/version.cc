@@ -0,0 +1,11 @@
+/*
+ * This file was created automatically. Do not change it.
+ * If you want to distribute the source code without
+ * git, make sure you include this file in your bundle.
+ */
+#include "riss/utils/version.h"
+
+const char* Riss::gitSHA1         = "88d8a45-dirty";
+const char* Riss::gitDate         = "Sun Oct 18 05:00:38 2026";
+const char* Riss::solverVersion   = "7.1.0";
+const char* Riss::signature       = "riss 7.1.0 build 88d8a45-dirty";
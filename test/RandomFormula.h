@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#ifndef RISS_TEST_RANDOMFORMULA_H
+#define RISS_TEST_RANDOMFORMULA_H
+
+#include <cstdlib>
+#include <vector>
+
+#include "riss/core/Solver.h"
+
+/** random k-SAT formula, a fixed seed gives the same formula on each run
+ *  note: reseeds rand(), 3-SAT is close to the phase transition with about 4.26 clauses per variable
+ */
+inline std::vector< std::vector<Riss::Lit> > randomFormula(int vars, int k, int clauses, unsigned seed)
+{
+    srand(seed);
+    std::vector< std::vector<Riss::Lit> > formula(clauses);
+    for (int i = 0 ; i < clauses; ++ i) {
+        for (int j = 0 ; j < k; ++ j) {
+            const Riss::Var v = rand() % vars;
+            formula[i].push_back(Riss::mkLit(v, rand() % 2 == 0));
+        }
+    }
+    return formula;
+}
+
+/** add the formula to the solver, after creating its variables */
+inline void addFormula(Riss::Solver& S, const std::vector< std::vector<Riss::Lit> >& formula, int vars)
+{
+    while (S.nVars() < vars) { S.newVar(); }
+    Riss::vec<Riss::Lit> ps;
+    for (size_t i = 0 ; i < formula.size(); ++ i) {
+        ps.clear();
+        for (size_t j = 0 ; j < formula[i].size(); ++ j) { ps.push(formula[i][j]); }
+        S.addClause_(ps);
+    }
+}
+
+/** return true, if the model satisfies each clause of the formula */
+inline bool satisfies(const Riss::vec<Riss::lbool>& model, const std::vector< std::vector<Riss::Lit> >& formula)
+{
+    for (size_t i = 0 ; i < formula.size(); ++ i) {
+        bool satisfied = false;
+        for (size_t j = 0 ; j < formula[i].size(); ++ j) {
+            satisfied = satisfied || (model[Riss::var(formula[i][j])] ^ Riss::sign(formula[i][j])) == l_True;
+        }
+        if (!satisfied) { return false; }
+    }
+    return true;
+}
+
+#endif
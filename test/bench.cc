@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ *
+ * micro-benchmarks for the hot paths of the solver and the preprocessor
+ *
+ * usage: riss-bench [-o file.json] [cnf files]
+ *
+ * Each benchmark runs on a fixed set of generated instances, and on the given CNF files. The results are written as
+ * JSON (to stdout, or to the given file), one object per instance and benchmark, with the number of operations, the
+ * time, ns/op, and operations per second. Operations are propagated literals for propagate and search (also with
+ * transparent huge pages, search-hugepages), conflicts for analyze, literals for parsing, and clauses for reduceDB,
+ * subsumption and BVE.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "riss/core/Solver.h"
+#include "riss/core/Dimacs.h"
+#include "coprocessor/Coprocessor.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+using namespace Coprocessor;
+
+/** formula with DIMACS literals */
+struct Instance {
+    string name;
+    int vars;
+    vector< vector<int> > clauses;
+};
+
+/** result of one benchmark on one instance */
+struct Result {
+    string instance, benchmark, unit;
+    uint64_t ops;
+    double seconds;
+};
+
+static double now()
+{
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** solver that exposes the internal methods to be measured */
+class BenchSolver : public Solver
+{
+  public:
+    BenchSolver(CoreConfig* config) : Solver(config) {}
+    using Solver::propagate;
+    using Solver::analyze;
+    using Solver::reduceDB;
+    using Solver::newDecisionLevel;
+    using Solver::uncheckedEnqueue;
+    using Solver::cancelUntil;
+    using Solver::decisionLevel;
+};
+
+/** random k-SAT formula */
+static Instance randomInstance(const string& name, int vars, int k, int clauses, unsigned seed)
+{
+    Instance instance;
+    instance.name = name;
+    instance.vars = vars;
+    const vector< vector<Lit> > formula = randomFormula(vars, k, clauses, seed);
+    instance.clauses.resize(clauses);
+    for (int i = 0 ; i < clauses; ++ i) {
+        for (size_t j = 0 ; j < formula[i].size(); ++ j) { instance.clauses[i].push_back((var(formula[i][j]) + 1) * (sign(formula[i][j]) ? -1 : 1)); }
+    }
+    return instance;
+}
+
+/** n+1 pigeons in n holes */
+static Instance pigeonHole(int holes)
+{
+    Instance instance;
+    instance.name = "php-" + to_string(holes + 1) + "-" + to_string(holes);
+    instance.vars = (holes + 1) * holes;
+    for (int p = 0 ; p <= holes; ++ p) {
+        instance.clauses.push_back(vector<int>());
+        for (int h = 0 ; h < holes; ++ h) { instance.clauses.back().push_back(p * holes + h + 1); }
+    }
+    for (int h = 0 ; h < holes; ++ h) {
+        for (int p = 0 ; p <= holes; ++ p) {
+            for (int q = p + 1 ; q <= holes; ++ q) { instance.clauses.push_back(vector<int>({ -(p * holes + h + 1), -(q * holes + h + 1) })); }
+        }
+    }
+    return instance;
+}
+
+/** read a DIMACS file into an instance, return false if the file cannot be read */
+static bool readInstance(const char* filename, Instance& instance)
+{
+    gzFile in = gzopen(filename, "rb");
+    if (in == nullptr) { return false; }
+    Solver S;
+    parse_DIMACS(in, S);
+    gzclose(in);
+    instance.name = filename;
+    instance.vars = S.nVars();
+    instance.clauses.clear();
+    for (int i = 0 ; i < S.clauses.size(); ++ i) {   // units and binary clauses have been handled by the solver already
+        const Clause& c = S.ca[ S.clauses[i] ];
+        instance.clauses.push_back(vector<int>());
+        for (int j = 0 ; j < c.size(); ++ j) { instance.clauses.back().push_back(sign(c[j]) ? -(var(c[j]) + 1) : var(c[j]) + 1); }
+    }
+    for (int i = 0 ; i < S.trail.size(); ++ i) { instance.clauses.push_back(vector<int>(1, sign(S.trail[i]) ? -(var(S.trail[i]) + 1) : var(S.trail[i]) + 1)); }
+    return true;
+}
+
+static void load(Solver& S, const Instance& instance)
+{
+    while (S.nVars() < instance.vars) { S.newVar(); }
+    vec<Lit> ps;
+    for (size_t i = 0 ; i < instance.clauses.size(); ++ i) {
+        ps.clear();
+        for (size_t j = 0 ; j < instance.clauses[i].size(); ++ j) {
+            const int l = instance.clauses[i][j];
+            ps.push(mkLit(abs(l) - 1, l < 0));
+        }
+        if (!S.addClause_(ps)) { return; }
+    }
+}
+
+static uint64_t literals(const Instance& instance)
+{
+    uint64_t count = 0;
+    for (size_t i = 0 ; i < instance.clauses.size(); ++ i) { count += instance.clauses[i].size(); }
+    return count;
+}
+
+/** parse the instance from a temporary DIMACS file, with the stream parser and the mapped parser */
+static void benchParse(const Instance& instance, vector<Result>& results)
+{
+    char filename[] = "/tmp/riss-bench-XXXXXX";
+    const int fd = mkstemp(filename);
+    if (fd < 0) { return; }
+    FILE* f = fdopen(fd, "w");
+    fprintf(f, "p cnf %d %zu\n", instance.vars, instance.clauses.size());
+    for (size_t i = 0 ; i < instance.clauses.size(); ++ i) {
+        for (size_t j = 0 ; j < instance.clauses[i].size(); ++ j) { fprintf(f, "%d ", instance.clauses[i][j]); }
+        fprintf(f, "0\n");
+    }
+    fclose(f);
+
+    for (int mapped = 0 ; mapped < 2; ++ mapped) {
+        Solver S;
+        const double start = now();
+        if (mapped) { parse_DIMACS_mapped(filename, S, 1); }
+        else {
+            gzFile in = gzopen(filename, "rb");
+            parse_DIMACS(in, S);
+            gzclose(in);
+        }
+        const Result r = { instance.name, mapped ? "parse-mapped" : "parse", "literals", literals(instance), now() - start };
+        results.push_back(r);
+    }
+    unlink(filename);
+}
+
+/** assign random decisions and propagate them until a conflict or a full assignment, analyze each conflict */
+static void benchPropagate(const Instance& instance, vector<Result>& results)
+{
+    CoreConfig config;
+    BenchSolver S(&config);
+    load(S, instance);
+    if (!S.okay() || S.propagate() != CRef_Undef) { return; }
+
+    srand(42);
+    vec<Lit> learnt;
+    double propagateTime = 0, analyzeTime = 0;
+    uint64_t analyzed = 0;
+    const uint64_t propagationsBefore = S.propagations;
+    for (int round = 0 ; round < 2000; ++ round) {
+        while (true) {
+            Var v = rand() % S.nVars();
+            for (int tries = 0 ; S.value(v) != l_Undef && tries < S.nVars(); ++ tries) { v = (v + 1) % S.nVars(); }
+            if (S.value(v) != l_Undef) { break; }   // full assignment
+
+            S.newDecisionLevel();
+            S.uncheckedEnqueue(mkLit(v, rand() % 2 == 0));
+            double start = now();
+            const CRef confl = S.propagate();
+            propagateTime += now() - start;
+            if (confl != CRef_Undef) {
+                learnt.clear();
+                int btlevel = 0;
+                unsigned lbd = 0, dependencyLevel = 0;
+                start = now();
+                S.analyze(confl, learnt, btlevel, lbd, dependencyLevel);
+                analyzeTime += now() - start;
+                analyzed ++;
+                break;
+            }
+        }
+        S.cancelUntil(0);
+    }
+    const Result p = { instance.name, "propagate", "propagations", S.propagations - propagationsBefore, propagateTime };
+    const Result a = { instance.name, "analyze", "conflicts", analyzed, analyzeTime };
+    results.push_back(p);
+    results.push_back(a);
+}
+
+/** run the search with a conflict budget, and remove learnt clauses afterwards
+ *  the search is repeated with huge pages, the search is the same, so that the speedup is the ratio of the times
+ */
+static void benchSearch(const Instance& instance, vector<Result>& results)
+{
+    for (int huge = 0 ; huge < 2; ++ huge) {
+        CoreConfig config;
+        if (huge) { config.parseOptions("-hugepages", false); }
+        BenchSolver S(&config);
+        load(S, instance);
+        if (!S.okay()) { return; }
+
+        S.setConfBudget(30000);
+        double start = now();
+        S.solveLimited(vec<Lit>());
+        const double seconds = now() - start;
+        const Result props = { instance.name, huge ? "search-hugepages" : "search", "propagations", S.propagations, seconds };
+        results.push_back(props);
+        if (huge) { continue; }
+        const Result confl = { instance.name, "search-conflicts", "conflicts", S.conflicts, seconds };
+        results.push_back(confl);
+
+        const uint64_t learnts = S.learnts.size();
+        if (learnts == 0) { continue; }
+        start = now();
+        S.reduceDB();
+        const Result reduce = { instance.name, "reduceDB", "clauses", learnts, now() - start };
+        results.push_back(reduce);
+    }
+}
+
+/** run subsumption and BVE on the formula, the time of the technique is taken from the technique profiler */
+static void benchSimplification(const Instance& instance, vector<Result>& results)
+{
+    for (int technique = 0 ; technique < 2; ++ technique) {
+        CoreConfig config;
+        CP3Config cp3config;
+        // the profile is not needed as a file, the measurements are read from the profiler
+        cp3config.parseOptions(technique == 0 ? "-enabled_cp3 -subsimp -cp3_profile=/dev/null" : "-enabled_cp3 -bve -cp3_profile=/dev/null", false);
+        Solver S(&config);
+        load(S, instance);
+        if (!S.okay()) { return; }
+        Preprocessor preprocessor(&S, cp3config, 0);
+        preprocessor.performSimplificationScheduled(technique == 0 ? "s" : "v");
+
+        double seconds = 0;
+        const vector<TechniqueProfiler::Measurement>& measurements = preprocessor.getProfiler().getMeasurements();
+        for (size_t i = 0 ; i < measurements.size(); ++ i) { seconds += measurements[i].wallTime; }
+        const Result r = { instance.name, technique == 0 ? "subsumption" : "bve", "clauses", instance.clauses.size(), seconds };
+        results.push_back(r);
+    }
+}
+
+static void writeResults(FILE* f, const vector<Result>& results)
+{
+    fprintf(f, "[\n");
+    for (size_t i = 0 ; i < results.size(); ++ i) {
+        const Result& r = results[i];
+        fprintf(f, "  {\"instance\": \"%s\", \"benchmark\": \"%s\", \"unit\": \"%s\", \"ops\": %" PRIu64 ", \"seconds\": %.6f, \"ns_per_op\": %.2f, \"per_sec\": %.0f}%s\n",
+                r.instance.c_str(), r.benchmark.c_str(), r.unit.c_str(), r.ops, r.seconds,
+                r.ops == 0 ? 0 : r.seconds * 1e9 / r.ops, r.seconds == 0 ? 0 : r.ops / r.seconds, i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "]\n");
+}
+
+int main(int argc, char** argv)
+{
+    const char* output = nullptr;
+    vector<Instance> instances;
+    instances.push_back(randomInstance("rnd3-5000", 5000, 3, 21000, 1));
+    instances.push_back(randomInstance("rnd5-1000", 1000, 5, 20000, 2));
+    instances.push_back(randomInstance("rnd7-300", 300, 7, 24000, 3));
+    instances.push_back(pigeonHole(9));
+
+    for (int i = 1 ; i < argc; ++ i) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) { output = argv[++i]; continue; }
+        Instance instance;
+        if (!readInstance(argv[i], instance)) {
+            fprintf(stderr, "c cannot read %s\n", argv[i]);
+            return 1;
+        }
+        instances.push_back(instance);
+    }
+
+    vector<Result> results;
+    for (size_t i = 0 ; i < instances.size(); ++ i) {
+        fprintf(stderr, "c benchmark %s\n", instances[i].name.c_str());
+        benchParse(instances[i], results);
+        benchPropagate(instances[i], results);
+        benchSearch(instances[i], results);
+        benchSimplification(instances[i], results);
+    }
+
+    FILE* f = output == nullptr ? stdout : fopen(output, "w");
+    if (f == nullptr) {
+        fprintf(stderr, "c cannot write %s\n", output);
+        return 1;
+    }
+    writeResults(f, results);
+    if (f != stdout) { fclose(f); }
+    return 0;
+}
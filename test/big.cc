@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+#include "coprocessor/CoprocessorTypes.h"
+
+using namespace std;
+using namespace Riss;
+using namespace Coprocessor;
+
+/** return true, if "to" can be reached from "from" with the given binary clauses */
+static bool reachable(const vector< vector<Lit> >& graph, Lit from, Lit to)
+{
+    vector<char> seen(graph.size(), 0);
+    vector<Lit> queue(1, from);
+    seen[toInt(from)] = 1;
+    for (size_t i = 0 ; i < queue.size(); ++ i) {
+        if (queue[i] == to) { return true; }
+        const vector<Lit>& succ = graph[toInt(queue[i])];
+        for (size_t j = 0 ; j < succ.size(); ++ j) {
+            if (!seen[toInt(succ[j])]) { seen[toInt(succ[j])] = 1; queue.push_back(succ[j]); }
+        }
+    }
+    return false;
+}
+
+int main()
+{
+    const int vars = 100;
+    srand(42);
+
+    ClauseAllocator ca;
+    vec<CRef> clauses;
+    vector< vector<Lit> > graph(2 * vars);
+    vector<Lit> added;   // clauses that are added incrementally, two literals per clause
+    vec<Lit> ps;
+    for (int i = 0 ; i < 2 * vars; ++ i) {
+        ps.clear();
+        ps.push(mkLit(rand() % vars, rand() % 2 == 0));
+        ps.push(mkLit(rand() % vars, rand() % 2 == 0));
+        if (var(ps[0]) == var(ps[1])) { continue; }
+        graph[toInt(~ps[0])].push_back(ps[1]);
+        graph[toInt(~ps[1])].push_back(ps[0]);
+        if (i % 2 == 0) { clauses.push(ca.alloc(ps, false)); }
+        else { added.push_back(ps[0]); added.push_back(ps[1]); }
+    }
+
+    BIG big;
+    vec<Lit> tmp;
+    big.recreate(ca, vars, clauses);
+    big.removeDuplicateEdges(vars);
+    big.generateImplied(vars, tmp);
+
+    for (size_t i = 0 ; i < added.size(); i += 2) { big.addEdge(added[i], added[i + 1]); }
+    big.addEdge(mkLit(vars, false), mkLit(0, false));   // unknown variables are ignored
+    assert(big.hasPendingEdges());
+    big.integratePendingEdges(vars, tmp);
+    assert(!big.hasPendingEdges());
+
+    // all edges are present after the update
+    for (int l = 0 ; l < 2 * vars; ++ l) {
+        for (size_t j = 0 ; j < graph[l].size(); ++ j) { assert(big.isChild(toLit(l), graph[l][j])); }
+        for (int j = 0 ; j < big.getSize(toLit(l)); ++ j) {
+            const Lit child = big.getArray(toLit(l))[j];
+            bool found = false;
+            for (size_t k = 0 ; k < graph[l].size(); ++ k) { found = found || graph[l][k] == child; }
+            assert(found && "no other edges are added");
+        }
+    }
+
+    // the stamps of old and new components only report implications that hold in the full graph
+    for (int a = 0 ; a < 2 * vars; ++ a) {
+        for (int b = 0 ; b < 2 * vars; ++ b) {
+            if (a != b && big.implies(toLit(a), toLit(b))) { assert(reachable(graph, toLit(a), toLit(b))); }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include "riss/utils/BinaryCNF.h"
+
+using namespace std;
+using namespace Riss;
+
+int main()
+{
+    BinaryCNF formula;
+    formula.vars = 200;
+
+    vector<Lit> clause;
+    clause.push_back(mkLit(0, false));
+    clause.push_back(mkLit(199, true));
+    clause.push_back(mkLit(5, false));
+    formula.addClause(clause, clause.size());
+    formula.addClause(&clause[1], 1);
+    formula.clauses.push_back(lit_Undef);   // empty clause
+
+    formula.formulaVariables = 250;
+    formula.undo.push_back(mkLit(230, true));
+    formula.undo.push_back(mkLit(3, false));
+    formula.undo.push_back(lit_Undef);
+
+    for (Var v = 0 ; v < 250; ++ v) {
+        formula.mapping.push_back(v % 10 == 0 ? -1 : v);
+        formula.trail.push_back(v % 10 == 0 ? (v % 20 == 0 ? l_True : l_False) : l_Undef);
+    }
+
+    assert(formula.write("debug.bcnf"));
+    assert(BinaryCNF::isBinaryCNFFile("debug.bcnf"));
+
+    BinaryCNF read;
+    assert(read.read("debug.bcnf"));
+
+    assert(read.vars == formula.vars);
+    assert(read.clauses == formula.clauses);
+    assert(read.formulaVariables == formula.formulaVariables);
+    assert(read.undo == formula.undo);
+    assert(read.mapping == formula.mapping);
+    assert(read.trail.size() == formula.trail.size());
+    for (size_t i = 0 ; i < read.trail.size(); ++ i) {
+        assert(read.trail[i] == formula.trail[i]);
+    }
+
+    return 0;
+}
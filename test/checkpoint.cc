@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include "riss/core/Solver.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+
+int main()
+{
+    const int vars = 300;
+    const vector< vector<Lit> > formula = randomFormula(vars, 3, vars * 415 / 100, 42);
+
+    Solver first;
+    addFormula(first, formula, vars);
+    first.setConfBudget(500);
+    const lbool firstResult = first.solveLimited(vec<Lit>());
+    if (firstResult != l_Undef) { return 0; }   // nothing left to resume
+
+    const bool written = first.writeCheckpoint("debug.ckpt");
+    assert(written);
+
+    Solver second;
+    const bool read = second.readCheckpoint("debug.ckpt");
+    assert(read);
+    assert(second.nVars() == first.nVars());
+    assert(second.nClauses() <= first.nClauses());
+    assert(second.nLearnts() > 0 && second.nLearnts() <= first.nLearnts());
+    assert(second.conflicts == first.conflicts);
+
+    const lbool result = second.solveLimited(vec<Lit>());
+    assert(result != l_Undef);
+    assert(second.conflicts > first.conflicts && "search continues with the counters of the checkpoint");
+
+    // compare with solving the formula from scratch, and check the model
+    Solver reference;
+    addFormula(reference, formula, vars);
+    const lbool referenceResult = reference.solveLimited(vec<Lit>());
+    assert(referenceResult == result);
+    assert((result != l_True || satisfies(second.model, formula)) && "model of the resumed search has to satisfy the formula");
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include "riss/core/Solver.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+
+int main()
+{
+    const int vars = 200;
+    uint64_t chronoBacktracks = 0;
+
+    for (int seed = 1 ; seed <= 8; ++ seed) {
+        CoreConfig config;
+        config.parseOptions("-chrono=0", false);   // always backtrack chronologically
+        const vector< vector<Lit> > formula = randomFormula(vars, 3, vars * 426 / 100, seed);
+        Solver chrono(&config);
+        addFormula(chrono, formula, vars);
+        const lbool result = chrono.solveLimited(vec<Lit>());
+        chronoBacktracks += chrono.nbChronoBacktracks;
+
+        // compare with the usual non-chronological backjumping
+        Solver reference;
+        addFormula(reference, formula, vars);
+        const lbool referenceResult = reference.solveLimited(vec<Lit>());
+        assert(referenceResult == result);
+        assert(reference.nbChronoBacktracks == 0 && "chronological backtracking is disabled by default");
+        assert((result != l_True || satisfies(chrono.model, formula)) && "model found with chronological backtracking has to satisfy the formula");
+    }
+
+    assert(chronoBacktracks > 0 && "some conflicts have to jump over more than one level");
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+#include "riss/core/Solver.h"
+
+using namespace std;
+using namespace Riss;
+
+/** allocate random clauses, remove some of them, and check that in-place compaction keeps the others intact */
+static void checkCompaction(uint32_t regionSize, bool keepFront)
+{
+    ClauseAllocator ca;
+    vector< vector<Lit> > contents;
+    vec<CRef> refs;
+    vec<Lit> ps;
+    for (int i = 0 ; i < 20000; ++ i) {
+        ps.clear();
+        const int size = 2 + rand() % (rand() % 4 == 0 ? 60 : 6);
+        for (int j = 0 ; j < size; ++ j) { ps.push(mkLit(j * 16 + rand() % 16, rand() % 2 == 0)); }   // no complementary literals
+        refs.push(ca.alloc(ps, rand() % 2 == 0));
+        contents.push_back(vector<Lit>(&ps[0], &ps[0] + ps.size()));
+    }
+
+    // remove most clauses in the back of the arena, and only few in the front
+    vec<CRef> live;
+    vector< vector<Lit> > liveContents;
+    for (int i = 0 ; i < refs.size(); ++ i) {
+        if (rand() % 100 < (i < refs.size() / 2 ? 5 : 60)) { ca.free(refs[i]); }
+        else {
+            live.push(refs[i]);
+            liveContents.push_back(contents[i]);
+        }
+    }
+
+    vec<CRef> moved;
+    const uint32_t sizeBefore = ca.size();
+    const int from = ca.compact(live, regionSize, 0.1, moved);
+    assert(moved.size() == live.size() - from && "each clause behind the first moved one is moved");
+    assert(ca.size() < sizeBefore && "the back of the arena has to be compacted");
+    assert(keepFront == (from > 0) && "dense regions stay in place");
+    assert((regionSize != 0 || ca.wasted() == 0) && "compacting everything leaves no garbage");
+
+    for (int i = 0 ; i < live.size(); ++ i) {
+        const CRef cr = ClauseAllocator::forward(live[i], live, from, moved);
+        assert((i >= from || cr == live[i]) && "clauses in front of the first moved clause keep their reference");
+        const Clause& c = ca[cr];
+        assert(c.size() == (int)liveContents[i].size());
+        for (int j = 0 ; j < c.size(); ++ j) { assert(c[j] == liveContents[i][j] && "moved clauses keep their literals"); }
+    }
+
+    // binary clauses fit into every free block, and fill the gaps in front of the moved clauses without growing the arena
+    const uint32_t sizeAfter = ca.size(), freeSpace = ca.freeBlockSpace(), wasted = ca.wasted();
+    assert(keepFront == (freeSpace > 0) && "the gaps between the kept clauses have to be reused");
+    ps.clear();
+    ps.push(mkLit(1, false)); ps.push(mkLit(2, true));
+    while (ca.freeBlockSpace() > 0) {
+        const CRef cr = ca.alloc(ps);
+        assert(cr < sizeAfter && ca.size() == sizeAfter && "new clauses are placed into free blocks first");
+        assert(ca[cr].size() == 2 && ca[cr][1] == mkLit(2, true));
+    }
+    assert(ca.wasted() < wasted || freeSpace == 0);
+}
+
+int main()
+{
+    srand(1);
+    checkCompaction(0, false);
+    checkCompaction(4096, true);
+    checkCompaction(1 << 20, false);   // a single region with too much garbage, that is compacted completely
+    return 0;
+}
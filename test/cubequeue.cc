@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+#include "riss/core/Solver.h"
+#include "pfolio/CubeQueue.h"
+
+using namespace std;
+using namespace Riss;
+
+/** worker that splits each cube on the next variable, and refutes cubes with the given number of literals */
+static void worker(CubeQueue* queue, int depth)
+{
+    vec<Lit> cube;
+    while (queue->pop(cube)) {
+        if (cube.size() < depth) { queue->split(cube, mkLit(cube.size(), false)); }
+        else { queue->refute(); }
+    }
+}
+
+int main()
+{
+    // all workers stop once each cube of the full binary tree has been refuted
+    CubeQueue queue;
+    queue.push(vec<Lit>());
+    vector<thread> workers;
+    for (int t = 0 ; t < 4; ++ t) { workers.push_back(thread(worker, &queue, 10)); }
+    for (int t = 0 ; t < 4; ++ t) { workers[t].join(); }
+    assert(queue.exhausted() && queue.open() == 0);
+    assert(queue.refuted == 1024 && queue.splits == 1023 && queue.maxSize == 10);
+
+    // an aborted queue does not hand out cubes, and is not exhausted
+    queue.reset();
+    vec<Lit> cube;
+    queue.push(cube);
+    queue.abort();
+    assert(!queue.pop(cube) && !queue.exhausted());
+
+    // lookahead: the split variable is unassigned under the cube, and a refuted cube is detected
+    Solver S;
+    while (S.nVars() < 6) { S.newVar(); }
+    vec<Lit> ps;
+    for (int v = 0 ; v + 1 < 6; ++ v) {   // chain of implications x0 -> x1 -> ... -> x5
+        ps.clear(); ps.push(mkLit(v, true)); ps.push(mkLit(v + 1, false));
+        S.addClause(ps);
+    }
+    ps.clear(); ps.push(mkLit(0, false)); ps.push(mkLit(3, false)); ps.push(mkLit(5, true));
+    S.addClause(ps);
+    Var split = var_Undef;
+    cube.clear();
+    assert(S.lookaheadSplit(cube, 6, split) && split != var_Undef);
+    cube.push(mkLit(split, false));
+    assert(S.lookaheadSplit(cube, 6, split) && split != var_Undef && split != var(cube[0]));
+    cube.clear(); cube.push(mkLit(2, false)); cube.push(mkLit(5, true));   // x2 implies x5
+    assert(!S.lookaheadSplit(cube, 6, split));
+    assert(S.okay() && S.solve() && "the lookahead does not change the formula");
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+#include "riss/core/Solver.h"
+#include "riss/core/Communication.h"
+
+using namespace std;
+using namespace Riss;
+
+/** let the receiver report the given number of imported, and useful clauses of the sender */
+static void report(CommunicationData& data, int receiver, int sender, int imported, int useful)
+{
+    for (int i = 0 ; i < imported; ++ i) { data.reportImport(receiver, sender); }
+    for (int i = 0 ; i < useful; ++ i) { data.reportUsefulImport(receiver, sender); }
+}
+
+/** compare float limits, that are computed with rounding errors */
+static bool near(float value, float expected) { return fabs(value - expected) < 0.001; }
+
+int main()
+{
+    CommunicationData data(1000);
+    data.initFeedback(3);
+    uint64_t imported = 0, useful = 0;
+
+    Solver::CommunicationClient client;
+    client.sendSize = 10; client.sendLbd = 5;
+    client.sendMaxSize = 20; client.sendMaxLbd = 10;
+    client.currentSendSizeLimit = 16; client.currentSendLbdLimit = 8;   // limits the sender adapted dynamically
+
+    // the feedback of all receivers is summed up, and too few new imports are not judged
+    report(data, 1, 0, 40, 2);
+    report(data, 2, 0, 40, 2);
+    report(data, 0, 1, 500, 500);   // feedback for another sender
+    data.senderFeedback(0, imported, useful);
+    assert(imported == 80 && useful == 4);
+    assert(!client.adaptToFeedback(imported, useful, 0.5, 0.1));
+    assert(client.sendSize == 10 && client.sendLbd == 5);
+
+    // too few useful clauses: the minimal limits shrink, the current limits are kept
+    report(data, 1, 0, 40, 2);
+    data.senderFeedback(0, imported, useful);
+    assert(client.adaptToFeedback(imported, useful, 0.5, 0.1));
+    assert(near(client.sendSize, 9) && near(client.sendLbd, 4.5));
+    assert(client.currentSendSizeLimit == 16 && client.currentSendLbdLimit == 8);
+
+    // the next check judges only the new imports: most are useful, so the minimal limits grow
+    report(data, 2, 0, 100, 90);
+    data.senderFeedback(0, imported, useful);
+    assert(client.adaptToFeedback(imported, useful, 0.5, 0.1));
+    assert(client.sendSize > 9.8 && client.sendSize < 10 && client.sendLbd > 4.9 && client.sendLbd < 5);
+    assert(client.currentSendSizeLimit == 16 && client.currentSendLbdLimit == 8);
+
+    // growing minimal limits raise the current limits, but never exceed the maximal limits
+    for (int round = 0 ; round < 20; ++ round) {
+        report(data, 1, 0, 100, 100);
+        data.senderFeedback(0, imported, useful);
+        assert(client.adaptToFeedback(imported, useful, 0.5, 0.1));
+        assert(client.currentSendSizeLimit >= client.sendSize && client.currentSendLbdLimit >= client.sendLbd);
+    }
+    assert(client.sendSize == 20 && client.sendLbd == 10);   // saturated at the maximal limits
+    assert(client.currentSendSizeLimit == 20 && client.currentSendLbdLimit == 10);
+
+    // shrinking minimal limits stop at 2
+    for (int round = 0 ; round < 50; ++ round) {
+        report(data, 2, 0, 100, 0);
+        data.senderFeedback(0, imported, useful);
+        assert(client.adaptToFeedback(imported, useful, 0.5, 0.1));
+    }
+    assert(client.sendSize == 2 && client.sendLbd == 2);
+    assert(client.currentSendSizeLimit == 20 && client.currentSendLbdLimit == 10);
+
+    cout << "c feedback limits: ok" << endl;
+    return 0;
+}
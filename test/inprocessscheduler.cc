@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <string>
+
+#include "coprocessor/InprocessScheduler.h"
+
+using namespace std;
+using namespace Coprocessor;
+
+/** run the given techniques, each one takes a second, only subsumption removes clauses */
+static void runRound(InprocessScheduler& scheduler, const string& techniques, double& now)
+{
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        scheduler.start(techniques[i], now, 1000, 3000);
+        now += 1;
+        scheduler.stop(now, techniques[i] == 's' ? 900 : 1000, techniques[i] == 's' ? 2700 : 3000);
+    }
+    scheduler.finishRound(now);
+}
+
+int main()
+{
+    InprocessScheduler scheduler("sv", 0.1, 0.5);
+    assert(scheduler.schedules('s') && scheduler.schedules('v') && !scheduler.schedules('p'));
+
+    // techniques that have not been called yet are run in the first round
+    double now = 0;
+    assert(scheduler.due(now));
+    assert(scheduler.select() == "sv");
+    runRound(scheduler, "sv", now);
+    assert(scheduler.getTechniques()[0].payoff > scheduler.getTechniques()[1].payoff);
+
+    // ten seconds of search pay for one second of inprocessing, which is not enough to run any technique again
+    now += 10;
+    assert(!scheduler.due(now));
+    assert(scheduler.select().empty());
+
+    // after more search, only the technique that paid off has collected enough credit
+    now += 20;
+    assert(scheduler.due(now));
+    assert(scheduler.select() == "s");
+    runRound(scheduler, "s", now);
+
+    // the other technique still gets credit, and is run again eventually
+    for (int rounds = 0 ; true; ++ rounds) {
+        assert(rounds < 1000 && "each technique has to be tried again");
+        now += 30;
+        scheduler.due(now);
+        const string techniques = scheduler.select();
+        runRound(scheduler, techniques, now);
+        if (techniques.find('v') != string::npos) { break; }
+    }
+
+    // inprocessing does not use more than the given share of the search time
+    double inprocessing = 0;
+    for (size_t i = 0 ; i < scheduler.getTechniques().size(); ++ i) { inprocessing += scheduler.getTechniques()[i].time; }
+    assert(inprocessing <= 0.1 * (now - inprocessing) + 2 && "only the first round may exceed the share");
+    return 0;
+}
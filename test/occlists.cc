@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+
+#include "coprocessor/OccurrenceLists.h"
+#include "riss/core/SolverTypes.h"
+
+using namespace std;
+using namespace Riss;
+using namespace Coprocessor;
+
+/** check that the arena lists store the same elements as plain vectors */
+static void compare(const OccurrenceLists& lists, const vector< vector<CRef> >& reference)
+{
+    assert(lists.size() == (int)reference.size());
+    for (size_t i = 0 ; i < reference.size(); ++ i) {
+        assert(lists[i].size() == (int)reference[i].size());
+        for (size_t j = 0 ; j < reference[i].size(); ++ j) { assert(lists[i][j] == reference[i][j]); }
+    }
+}
+
+/** elements with the highest bit set are deleted lazily */
+struct HighBitDeleted {
+    bool operator()(const CRef& r) const { return (r & 0x80000000u) != 0; }
+};
+
+/** check that the lists in a single region store the same elements as plain vectors */
+static void comparePacked(PackedOccLists<int, CRef, HighBitDeleted>& lists, const vector< vector<CRef> >& reference)
+{
+    assert(lists.size() == (int)reference.size());
+    for (size_t i = 0 ; i < reference.size(); ++ i) {
+        const PackedOccLists<int, CRef, HighBitDeleted>::List list = lists[i];
+        assert(list.size() == (int)reference[i].size());
+        for (size_t j = 0 ; j < reference[i].size(); ++ j) { assert(list[j] == reference[i][j]); }
+    }
+}
+
+/** lists that move inside their region, lazy deletion and compaction */
+static void testPacked(int literals)
+{
+    PackedOccLists<int, CRef, HighBitDeleted> lists((HighBitDeleted()));
+    lists.init(literals - 1);
+    vector< vector<CRef> > reference(literals);
+
+    for (int i = 0 ; i < 50000; ++ i) {
+        const int l = rand() % literals;
+        if (rand() % 4 == 0 && !reference[l].empty()) {
+            lists.cleanAll();   // positions of the reference are the positions without marked elements
+            PackedOccLists<int, CRef, HighBitDeleted>::List list = lists[l];
+            const int pos = rand() % reference[l].size();
+            if (rand() % 2 == 0) {   // mark the element, and remove it lazily
+                list[pos] |= 0x80000000u;
+                lists.smudge(l);
+                reference[l].erase(reference[l].begin() + pos);
+            } else {
+                removeUnSort(list, list[pos]);
+                reference[l][pos] = reference[l].back();
+                reference[l].pop_back();
+            }
+        } else {
+            lists[l].push(i);
+            reference[l].push_back(i);
+        }
+        if (rand() % 1000 == 0) { lists.cleanAll(); lists[l].clear(true); reference[l].clear(); }
+    }
+    lists.cleanAll();
+    comparePacked(lists, reference);
+
+    lists.compact();
+    comparePacked(lists, reference);
+    for (int l = 0 ; l + 1 < literals; ++ l) {   // compacted lists are stored in the order of their index
+        if (lists[l].size() > 0 && lists[l + 1].size() > 0) { assert(lists[l].data() + lists[l].capacity() == lists[l + 1].data()); }
+    }
+
+    // lists have to be able to grow after compaction
+    for (int l = 0 ; l < literals; ++ l) {
+        for (int i = 0 ; i < l % 7; ++ i) { lists[l].push(l); reference[l].push_back(l); }
+    }
+    comparePacked(lists, reference);
+}
+
+int main()
+{
+    const int literals = 200;
+    srand(42);
+
+    OccurrenceLists lists;
+    lists.resize(literals);
+    vector< vector<CRef> > reference(literals);
+
+    for (int round = 0 ; round < 3; ++ round) {
+        // add and remove elements randomly, lists grow and release segments
+        for (int i = 0 ; i < 20000; ++ i) {
+            const int l = rand() % literals;
+            if (rand() % 4 == 0 && !reference[l].empty()) {
+                const int pos = rand() % reference[l].size();
+                lists[l][pos] = lists[l].back();
+                lists[l].pop_back();
+                reference[l][pos] = reference[l].back();
+                reference[l].pop_back();
+            } else {
+                lists[l].push_back(i);
+                reference[l].push_back(i);
+            }
+            if (rand() % 1000 == 0) { lists[l].release(); reference[l].clear(); }
+        }
+        compare(lists, reference);
+
+        lists.compact();
+        compare(lists, reference);
+        assert(lists.usedBytes() == lists.elements() * sizeof(CRef));
+
+        // lists have to be able to grow after compaction
+        for (int l = 0 ; l < literals; ++ l) {
+            for (int i = 0 ; i < l % 7; ++ i) { lists[l].push_back(l); reference[l].push_back(l); }
+        }
+        compare(lists, reference);
+    }
+
+    lists.checkCompact(0);
+    compare(lists, reference);
+    assert(lists.getCompactions() == 4);
+
+    lists.resize(literals / 2);
+    reference.resize(literals / 2);
+    compare(lists, reference);
+
+    const vector<CRef> copy(lists[0]);   // copies have to be explicit
+    assert(copy == reference[0]);
+
+    // the peak memory is kept after the lists have been freed
+    lists.resetPeak();
+    assert(lists.peakBytes() == lists.bytes());
+    for (int i = 0 ; i < 100000; ++ i) { lists[0].push_back(i); }
+    const uint64_t grown = lists.bytes();
+    assert(lists.peakBytes() == grown);
+    lists.clear();
+    assert(lists.bytes() < grown && lists.peakBytes() == grown);
+
+    testPacked(literals);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "riss/core/Solver.h"
+#include "coprocessor/Coprocessor.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+using namespace Coprocessor;
+
+/** read all lines of the given file */
+static vector<string> readLines(const string& filename)
+{
+    vector<string> lines;
+    ifstream file(filename.c_str());
+    string line;
+    while (getline(file, line)) { lines.push_back(line); }
+    return lines;
+}
+
+/** preprocess a random formula, and write the profile to the given file */
+static vector<TechniqueProfiler::Measurement> preprocess(const string& filename)
+{
+    const int vars = 300;
+    const vector< vector<Lit> > formula = randomFormula(vars, 3, vars * 4, 1);
+    Solver S;
+    addFormula(S, formula, vars);
+
+    CP3Config config;
+    config.parseOptions("-enabled_cp3 -subsimp -bve -dense -symm -sls -sls-flips=1000 -cp3_profile=" + filename, false);
+    Preprocessor preprocessor(&S, config);
+    preprocessor.preprocess();
+    return preprocessor.getProfiler().getMeasurements();
+}
+
+/** return true, if each technique appears in the measurements */
+static bool measured(const vector<TechniqueProfiler::Measurement>& measurements, const string& techniques)
+{
+    for (size_t i = 0 ; i < techniques.size(); ++ i) {
+        bool found = false;
+        for (size_t j = 0 ; j < measurements.size(); ++ j) { found = found || measurements[j].technique == techniques[i]; }
+        if (!found) { return false; }
+    }
+    return true;
+}
+
+int main()
+{
+    char directory[] = "/tmp/riss-profile-XXXXXX";
+    if (mkdtemp(directory) == 0) { perror("mkdtemp"); return 1; }
+    const string json = string(directory) + "/profile.json", csv = string(directory) + "/profile.csv";
+
+    // JSON: one object per call, in a single array
+    const vector<TechniqueProfiler::Measurement> measurements = preprocess(json);
+    assert(measured(measurements, "svdyS") && "techniques outside of the grammar have to be measured as well");
+    for (size_t i = 0 ; i < measurements.size(); ++ i) {
+        assert(measurements[i].occGrowth >= 0 && "the peak of the occurrence lists cannot be below their start");
+        assert(!measurements[i].inprocessing);
+    }
+    vector<string> lines = readLines(json);
+    assert(lines.size() == measurements.size() + 2);
+    assert(lines.front() == "[" && lines.back() == "]");
+    for (size_t i = 0 ; i < measurements.size(); ++ i) {
+        const string& line = lines[i + 1];
+        assert(line.find(string("\"technique\": \"") + TechniqueProfiler::techniqueName(measurements[i].technique) + "\"") != string::npos);
+        assert(line.find("\"occ_growth\": ") != string::npos);
+        assert((line[line.size() - 1] == ',') == (i + 1 < measurements.size()) && "objects have to be separated by commas");
+    }
+
+    // CSV: a header, and a line with the same number of fields per call
+    const vector<TechniqueProfiler::Measurement> csvMeasurements = preprocess(csv);
+    lines = readLines(csv);
+    assert(lines.size() == csvMeasurements.size() + 1);
+    assert(lines[0].compare(0, 15, "technique,call,") == 0);
+    for (size_t i = 0 ; i < lines.size(); ++ i) {
+        size_t fields = 1;
+        for (size_t j = 0 ; j < lines[i].size(); ++ j) { fields += lines[i][j] == ','; }
+        assert(fields == 13);
+        if (i > 0) {
+            const string name = string(TechniqueProfiler::techniqueName(csvMeasurements[i - 1].technique)) + ",";
+            assert(lines[i].compare(0, name.size(), name) == 0);
+        }
+    }
+
+    remove(json.c_str());
+    remove(csv.c_str());
+    rmdir(directory);
+    printf("c %d calls measured\n", (int)measurements.size());
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "riss/core/Solver.h"
+#include "riss/utils/Simd.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+
+/** random k-SAT formula, a fixed seed gives the same formula on each run */
+struct Instance {
+    int vars, k, clauses, seed;
+};
+
+/** compare the AVX2 kernels with their scalar versions on random literals and values */
+static bool checkKernels()
+{
+    const int vars = 1000;
+    struct Data { uint8_t value; int32_t level; };   // value and level of a variable, like in the solver
+    vec<Data> data(vars);
+    vec<Lit> lits;
+    vec<int32_t> scalar, avx;
+    for (int round = 0 ; round < 1000; ++ round) {
+        for (int v = 0 ; v < vars; ++ v) { data[v].value = rand() % 100 < 90 ? rand() % 2 : 2; data[v].level = rand(); }
+        lits.clear();
+        const int size = 2 + rand() % 64;
+        for (int i = 0 ; i < size; ++ i) { lits.push(mkLit(rand() % vars, rand() % 2 == 0)); }
+        const int from = rand() % size;
+
+        const uint8_t* values = &data[0].value;
+        if (Simd::firstNonFalse(&lits[0], from, size, values, sizeof(Data)) != Simd::firstNonFalseAVX2(&lits[0], from, size, values, sizeof(Data))) {
+            printf("c first non-false literal differs in round %d\n", round);
+            return false;
+        }
+        scalar.growTo(size); avx.growTo(size);
+        Simd::gatherFields(&lits[0], size, &data[0].level, sizeof(Data), &scalar[0]);
+        Simd::gatherFieldsAVX2(&lits[0], size, &data[0].level, sizeof(Data), &avx[0]);
+        for (int i = 0 ; i < size; ++ i) {
+            if (scalar[i] != avx[i]) {
+                printf("c gathered level differs in round %d\n", round);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/** run the solver with a conflict budget, return propagations per second */
+static double measure(const Instance& instance, bool simd, uint64_t& propagations, uint64_t& decisions, lbool& result)
+{
+    CoreConfig config;
+    config.parseOptions(simd ? "-simd" : "-no-simd", false);
+    Solver S(&config);
+    addFormula(S, randomFormula(instance.vars, instance.k, instance.clauses, instance.seed), instance.vars);
+    S.setConfBudget(20000);
+    const double start = cpuTime();
+    result = S.solveLimited(vec<Lit>());
+    const double time = cpuTime() - start;
+    propagations = S.propagations;
+    decisions = S.decisions;
+    return time == 0 ? 0 : S.propagations / time;
+}
+
+int main()
+{
+    if (!Simd::avx2Supported()) { printf("c AVX2 is not supported, compare scalar versions only\n"); }
+    else if (!checkKernels()) { return 1; }
+
+    const Instance instances[] = {
+        { 300, 3, 1278, 1 },
+        { 150, 5, 3150, 2 },
+        { 100, 7, 8000, 3 },
+        { 100, 12, 20000, 4 },
+    };
+
+    for (size_t i = 0 ; i < sizeof(instances) / sizeof(instances[0]); ++ i) {
+        uint64_t scalarProps = 0, scalarDecisions = 0, simdProps = 0, simdDecisions = 0;
+        lbool scalarResult = l_Undef, simdResult = l_Undef;
+        const double scalarRate = measure(instances[i], false, scalarProps, scalarDecisions, scalarResult);
+        const double simdRate = measure(instances[i], true, simdProps, simdDecisions, simdResult);
+        printf("c instance %d-SAT %d vars %d clauses: %.0f props/sec scalar, %.0f props/sec simd (%.2fx)\n",
+               instances[i].k, instances[i].vars, instances[i].clauses, scalarRate, simdRate, scalarRate == 0 ? 0 : simdRate / scalarRate);
+
+        // the kernels find the same literals, so the search has to be the same
+        if (scalarResult != simdResult || scalarProps != simdProps || scalarDecisions != simdDecisions) {
+            printf("c search with simd kernels differs: %" PRIu64 " vs %" PRIu64 " propagations\n", scalarProps, simdProps);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2015, Norbert Manthey, LGPL v2, see LICENSE
+ */
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+
+#include "riss/core/Solver.h"
+#include "riss/core/Communication.h"
+
+using namespace std;
+using namespace Riss;
+
+/** accept every literal for receiving */
+struct AllowAll {
+    bool canBeReceived(const Lit& l) const { return true; }
+};
+
+/** statistics of one thread of the stress test */
+struct ThreadStats {
+    uint64_t sent, received, broken, own;
+    double sendTime, receiveTime;
+    ThreadStats() : sent(0), received(0), broken(0), own(0), sendTime(0), receiveTime(0) {}
+};
+
+/** clause number n of author a: first literal is the author, then consecutive variables that encode n */
+static int fillClause(vector<Lit>& clause, int author, uint64_t n)
+{
+    const int base = 64 + (n % 1000) * 32;
+    const int size = 2 + (n % 1000) % 20;
+    clause.resize(size);
+    clause[0] = mkLit(author, false);
+    for (int i = 1 ; i < size; ++ i) { clause[i] = mkLit(base + i - 1, n & 1); }
+    return size;
+}
+
+/** check that a received clause has been written by one producer only */
+static bool wellFormed(const Clause& c)
+{
+    if (c.size() < 2) { return false; }
+    const int n = (var(c[1]) - 64) / 32;
+    if ((var(c[1]) - 64) % 32 != 0 || c.size() != 2 + n % 20) { return false; }
+    for (int i = 2 ; i < c.size(); ++ i) {
+        if (var(c[i]) != var(c[1]) + i - 1 || sign(c[i]) != sign(c[1])) { return false; }
+    }
+    return true;
+}
+
+static void worker(ClauseRingBuffer* buffer, int author, uint64_t clauses, ThreadStats* stats)
+{
+    ClauseAllocator ca;
+    AllowAll allowAll;
+    vector<Lit> clause;
+    vector<CRef> received;
+    vec<Lit> units, equivalences;
+    uint64_t cursor = 0;
+
+    for (uint64_t n = 0 ; n < clauses; ++ n) {
+        const int size = fillClause(clause, author, n);
+        double start = wallClockTime();
+        buffer->addClause(author, clause, size);
+        stats->sent ++;
+        stats->sendTime += wallClockTime() - start;
+
+        if (n % 16 == 0) {
+            start = wallClockTime();
+            cursor = buffer->receiveClauses(author, cursor, ca, received, units, equivalences, allowAll);
+            stats->receiveTime += wallClockTime() - start;
+            for (size_t i = 0 ; i < received.size(); ++ i) {
+                const Clause& c = ca[received[i]];
+                stats->received ++;
+                if (!wellFormed(c) || c.importedFrom() != var(c[0])) { stats->broken ++; }   // receivers know the author of each clause
+                if (var(c[0]) == author) { stats->own ++; }
+                ca.free(received[i]);
+            }
+        }
+    }
+}
+
+/** a clause that has been shared already is dropped, also when its literals are permuted, other clauses pass */
+static bool checkFilter()
+{
+    ClauseRingBuffer buffer(1000);
+    buffer.enableFilter(8);
+    vector<Lit> clause, permuted;
+    fillClause(clause, 1, 7);
+    permuted.assign(clause.rbegin(), clause.rend());
+    if (!buffer.addClause(1, clause, clause.size())) { return false; }
+    if (buffer.addClause(2, permuted, permuted.size())) { return false; }
+    if (!buffer.addClause(2, clause, clause.size() - 1)) { return false; }   // a subset is a different clause
+    permuted[0] = ~permuted[0];
+    if (!buffer.addClause(2, permuted, permuted.size())) { return false; }
+    vector<Lit> unit(1, clause[0]);
+    return buffer.addClause(1, unit, 1, true) && buffer.addClause(1, unit, 1, true);   // multi units are not filtered
+}
+
+int main(int argc, char** argv)
+{
+    const int threads = argc > 1 ? atoi(argv[1]) : 8;
+    const uint64_t clauses = argc > 2 ? atoll(argv[2]) : 200000;
+
+    cout << "Start testing clause ring buffer with " << threads << " threads ... " << endl;
+
+    ClauseRingBuffer buffer(4000 * threads);
+    vector<ThreadStats> stats(threads);
+    vector<thread> workers;
+    const double start = wallClockTime();
+    for (int t = 0 ; t < threads; ++ t) { workers.push_back(thread(worker, &buffer, t, clauses, &stats[t])); }
+    for (int t = 0 ; t < threads; ++ t) { workers[t].join(); }
+    const double time = wallClockTime() - start;
+
+    uint64_t broken = 0, own = 0;
+    cout << "c thread  sent\t|\t sent/s\t|\t received\t|\t received/s" << endl;
+    for (int t = 0 ; t < threads; ++ t) {
+        cout << "c " << t << " : " << stats[t].sent
+             << "  \t|\t" << (stats[t].sendTime > 0 ? stats[t].sent / stats[t].sendTime : 0)
+             << "  \t|\t" << stats[t].received
+             << "  \t|\t" << (stats[t].receiveTime > 0 ? stats[t].received / stats[t].receiveTime : 0) << endl;
+        broken += stats[t].broken;
+        own += stats[t].own;
+    }
+    cout << "c wall time: " << time << " s, broken: " << broken << ", own: " << own << endl;
+
+    const bool filter = checkFilter();
+    cout << "c duplicate filter: " << (filter ? "ok" : "broken") << endl;
+
+    if (broken != 0 || own != 0 || !filter) {
+        cout << "FAILED" << endl;
+        return 1;
+    }
+    cout << "OK" << endl;
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "riss/core/Solver.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+
+/** return true, if each learnt clause is stored exactly once, in one of the tiers */
+static bool storedOnce(const Solver& S)
+{
+    vector<CRef> refs;
+    for (int i = 0 ; i < S.learnts.size(); ++ i) { refs.push_back(S.learnts[i]); }
+    for (int i = 0 ; i < S.tier2Learnts.size(); ++ i) { refs.push_back(S.tier2Learnts[i]); }
+    sort(refs.begin(), refs.end());
+    return adjacent_find(refs.begin(), refs.end()) == refs.end() && (int)refs.size() == S.nLearnts();
+}
+
+int main()
+{
+    const int vars = 200;
+    uint64_t promoted = 0, demoted = 0;
+
+    for (int seed = 1 ; seed <= 8; ++ seed) {
+        CoreConfig config;
+        config.parseOptions("-tier2-lbd=6 -tier2-red=300", false);   // demote unused tier2 clauses often
+        const vector< vector<Lit> > formula = randomFormula(vars, 3, vars * 426 / 100, seed);
+        Solver tiers(&config);
+        addFormula(tiers, formula, vars);
+
+        // solve in slices, such that the tiers can be checked in between
+        lbool result = l_Undef;
+        while (result == l_Undef) {
+            tiers.setConfBudget(2000);
+            result = tiers.solveLimited(vec<Lit>());
+            assert(storedOnce(tiers) && "promoted and demoted clauses must not be stored twice");
+        }
+        promoted += tiers.nbTier2Promoted;
+        demoted += tiers.nbTier2Demoted;
+
+        // compare with the single vector of learnt clauses
+        Solver reference;
+        addFormula(reference, formula, vars);
+        const lbool referenceResult = reference.solveLimited(vec<Lit>());
+        assert(referenceResult == result);
+        assert(reference.nbTier2Promoted == 0 && "tier2 is disabled by default");
+        assert((result != l_True || satisfies(tiers.model, formula)) && "model found with tiers has to satisfy the formula");
+        printf("c seed %d: %s, %llu promoted, %llu demoted\n", seed, result == l_True ? "SAT" : "UNSAT",
+               (unsigned long long)tiers.nbTier2Promoted, (unsigned long long)tiers.nbTier2Demoted);
+    }
+
+    assert(promoted > 0 && demoted > 0 && "clauses have to move between the tiers");
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "riss/core/Solver.h"
+#include "test/RandomFormula.h"
+
+using namespace std;
+using namespace Riss;
+
+#ifdef DRATPROOF
+#define PROOF_CHECK " -proof-oft-check=1"   // check each proof step online
+#else
+#define PROOF_CHECK ""
+#endif
+
+/** solve the formula, with the online proof checker if proofs are compiled in */
+static lbool solve(Solver& S, const vector< vector<Lit> >& formula, int vars)
+{
+    #ifdef DRATPROOF
+    S.proofFile = tmpfile();
+    while (S.nVars() < vars) { S.newVar(); }
+    vec<Lit> ps;
+    for (size_t i = 0 ; i < formula.size(); ++ i) {
+        ps.clear();
+        for (size_t j = 0 ; j < formula[i].size(); ++ j) { ps.push(formula[i][j]); }
+        sort(ps);
+        int kept = 0;   // the checker expects clauses without duplicate literals, and no tautologies
+        bool tautology = false;
+        for (int j = 0 ; j < ps.size(); ++ j) {
+            if (kept > 0 && ps[j] == ps[kept - 1]) { continue; }
+            tautology = tautology || (kept > 0 && ps[j] == ~ps[kept - 1]);
+            ps[kept++] = ps[j];
+        }
+        ps.shrink_(ps.size() - kept);
+        if (!tautology) { S.addInputClause_(ps); }
+    }
+    #endif
+    addFormula(S, formula, vars);
+    const lbool result = S.solveLimited(vec<Lit>());
+    #ifdef DRATPROOF
+    assert((result != l_False || S.checkProof() == l_True) && "vivification has to produce a valid DRAT proof");
+    fclose(S.proofFile);
+    S.proofFile = nullptr;
+    #endif
+    return result;
+}
+
+int main()
+{
+    const int vars = 200;
+    uint64_t tried = 0, strengthened = 0;
+
+    for (int seed = 1 ; seed <= 8; ++ seed) {
+        CoreConfig config;
+        config.parseOptions("-vivi-int=50 -vivi-effort=1000" PROOF_CHECK, false);   // vivify often
+        const vector< vector<Lit> > formula = randomFormula(vars, 3, vars * 426 / 100, seed);
+        Solver vivi(&config);
+        const lbool result = solve(vivi, formula, vars);
+        tried += vivi.vivification.tried;
+        strengthened += vivi.vivification.strengthened;
+
+        // compare with the search without vivification of irredundant clauses
+        CoreConfig referenceConfig;
+        referenceConfig.parseOptions("-vivi-int=0" PROOF_CHECK, false);
+        Solver reference(&referenceConfig);
+        const lbool referenceResult = solve(reference, formula, vars);
+        assert(referenceResult == result);
+        assert(reference.vivification.rounds == 0 && "vivification is disabled");
+        assert((result != l_True || satisfies(vivi.model, formula)) && "model found with vivification has to satisfy the original formula");
+        printf("c seed %d: %s, %llu rounds, %llu clauses tried, %llu strengthened\n", seed, result == l_True ? "SAT" : (result == l_False ? "UNSAT" : "UNKNOWN"),
+               (unsigned long long)vivi.vivification.rounds, (unsigned long long)vivi.vivification.tried, (unsigned long long)vivi.vivification.strengthened);
+    }
+
+    assert(tried > 0 && strengthened > 0 && "some irredundant clauses have to be vivified");
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2015, LGPL v2, see LICENSE
+ */
+
+#include <cassert>
+#include <vector>
+
+#include "riss/utils/ThreadController.h"
+
+using namespace std;
+using namespace Riss;
+
+/** counts how often each index has been visited */
+static vector<int> visits;
+
+static bool visitedOnce()
+{
+    for (size_t i = 0 ; i < visits.size(); ++ i) {
+        if (visits[i] != 1) { return false; }
+        visits[i] = 0;
+    }
+    return true;
+}
+
+int main()
+{
+    const unsigned size = 100000;
+    visits.assign(size, 0);
+
+    ThreadController controller(4);
+    controller.init();
+
+    // scheduler alone: uneven grain, all indexes are handed out exactly once
+    RangeScheduler scheduler(3, 0, size, 7);
+    unsigned start = 0, end = 0;
+    while (scheduler.next(1, start, end)) {
+        assert(start < end && end - start <= 7);
+        for (unsigned i = start; i < end; ++ i) { ++ visits[i]; }
+    }
+    const bool scheduled = visitedOnce();
+    assert(scheduled && "a single worker has to steal all parts of the range");
+
+    // parallel for
+    controller.parallelFor(0, size, 100, [](unsigned worker, unsigned s, unsigned e) {
+        for (unsigned i = s; i < e; ++ i) { __sync_fetch_and_add(&visits[i], 1); }
+    });
+    const bool parallelFor = visitedOnce();
+    assert(parallelFor && "parallel for has to visit each index exactly once");
+
+    // without threads, the calling thread processes the whole range
+    ThreadController sequential(0);
+    sequential.init();
+    sequential.parallelFor(0, size, 100, [](unsigned worker, unsigned s, unsigned e) {
+        assert(worker == 0);
+        for (unsigned i = s; i < e; ++ i) { ++ visits[i]; }
+    });
+    const bool sequentialFor = visitedOnce();
+    assert(sequentialFor && "parallel for without threads has to visit each index exactly once");
+
+    return 0;
+}